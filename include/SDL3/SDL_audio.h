@@ -170,6 +170,24 @@ typedef struct SDL_AudioSpec
 struct SDL_AudioStream;  /* this is opaque to the outside world. */
 typedef struct SDL_AudioStream SDL_AudioStream;
 
+/**
+ * The resampling quality of an SDL_AudioStream.
+ *
+ * Lower quality levels are much cheaper to run, which matters when mixing
+ * a large number of streams, such as UI sounds or voice chat.
+ *
+ * \since This enum is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetAudioStreamProperties
+ */
+typedef enum
+{
+    SDL_AUDIO_RESAMPLE_QUALITY_ZERO_ORDER_HOLD, /**< repeat the most recent input frame */
+    SDL_AUDIO_RESAMPLE_QUALITY_LINEAR,          /**< linear interpolation between two frames */
+    SDL_AUDIO_RESAMPLE_QUALITY_CUBIC,           /**< cubic interpolation between four frames */
+    SDL_AUDIO_RESAMPLE_QUALITY_HIGH             /**< bandlimited interpolation (the default) */
+} SDL_AudioResampleQuality;
+
 
 /* Function prototypes */
 
@@ -351,6 +369,118 @@ extern DECLSPEC char *SDLCALL SDL_GetAudioDeviceName(SDL_AudioDeviceID devid);
  */
 extern DECLSPEC int SDLCALL SDL_GetAudioDeviceFormat(SDL_AudioDeviceID devid, SDL_AudioSpec *spec, int *sample_frames);
 
+/**
+ * Get the properties associated with an audio device.
+ *
+ * These are read-only performance counters for the thread that feeds the
+ * physical device, updated every time this function is called. They count
+ * from when the device was first opened, and are meant for monitoring how
+ * close a device is to running out of data:
+ *
+ * - `SDL_PROP_AUDIO_DEVICE_STATS_ITERATIONS_NUMBER`: the number of buffers
+ *   the device thread has processed.
+ * - `SDL_PROP_AUDIO_DEVICE_STATS_ITERATE_TIME_MIN_NUMBER`,
+ *   `SDL_PROP_AUDIO_DEVICE_STATS_ITERATE_TIME_AVG_NUMBER` and
+ *   `SDL_PROP_AUDIO_DEVICE_STATS_ITERATE_TIME_MAX_NUMBER`: the time, in
+ *   nanoseconds, spent pulling data from bound streams, mixing it and handing
+ *   it to the device (or, for capture devices, feeding bound streams).
+ * - `SDL_PROP_AUDIO_DEVICE_STATS_WAIT_TIME_MIN_NUMBER`,
+ *   `SDL_PROP_AUDIO_DEVICE_STATS_WAIT_TIME_AVG_NUMBER` and
+ *   `SDL_PROP_AUDIO_DEVICE_STATS_WAIT_TIME_MAX_NUMBER`: the time, in
+ *   nanoseconds, between buffers, which is mostly spent waiting for the
+ *   device to want more data.
+ * - `SDL_PROP_AUDIO_DEVICE_STATS_ITERATE_TIME_HISTOGRAM_PREFIX` and
+ *   `SDL_PROP_AUDIO_DEVICE_STATS_WAIT_TIME_HISTOGRAM_PREFIX`, followed by a
+ *   bucket number from 0 to 15: histograms of the above. Bucket 0 counts
+ *   times under 1 microsecond, bucket N counts times under 2^N microseconds
+ *   that didn't fit in an earlier bucket, and bucket 15 counts everything
+ *   else.
+ * - `SDL_PROP_AUDIO_DEVICE_STATS_STREAMS_MIN_NUMBER`,
+ *   `SDL_PROP_AUDIO_DEVICE_STATS_STREAMS_AVG_NUMBER` and
+ *   `SDL_PROP_AUDIO_DEVICE_STATS_STREAMS_MAX_NUMBER`: the number of bound
+ *   streams processed per buffer. Streams on paused logical devices aren't
+ *   counted.
+ * - `SDL_PROP_AUDIO_DEVICE_STATS_BYTES_CONVERTED_NUMBER`: the number of
+ *   bytes pulled from (or, for capture devices, pushed to) bound streams.
+ * - `SDL_PROP_AUDIO_DEVICE_STATS_UNDERRUNS_NUMBER`: the number of times a
+ *   bound stream on an output device had less data than the device needed.
+ *   A stream that is bound but has nothing to play counts, too.
+ * - `SDL_PROP_AUDIO_DEVICE_STATS_FRAMES_NUMBER`: the number of sample frames
+ *   the device has played or recorded.
+ * - `SDL_PROP_AUDIO_DEVICE_STATS_REALTIME_RATIO_FLOAT`: how much audio the
+ *   device got through, divided by the time the device thread took for it.
+ *   This is close to 1.0 for a device that runs in real time, and larger
+ *   for the "disk" and "dummy" drivers when they are set to run as fast as
+ *   possible (see SDL_HINT_AUDIO_DISK_TIMESCALE).
+ * - `SDL_PROP_AUDIO_DEVICE_STATS_OVERRUNS_NUMBER`: for the "disk" and
+ *   "dummy" drivers, which keep time themselves, the number of times the
+ *   device thread fell more than a buffer behind schedule. The driver
+ *   skips the lost time instead of catching up.
+ * - `SDL_PROP_AUDIO_DEVICE_STATS_BUFFER_RESIZES_NUMBER`: the number of times
+ *   SDL changed the device's buffer size while it played (see
+ *   SDL_HINT_AUDIO_DEVICE_ADAPTIVE_SAMPLE_FRAMES). SDL_GetAudioDeviceFormat()
+ *   reports the current size.
+ *
+ * You may also specify SDL_AUDIO_DEVICE_DEFAULT_OUTPUT or
+ * SDL_AUDIO_DEVICE_DEFAULT_CAPTURE here. Logical devices report the
+ * properties of the physical device they are opened on.
+ *
+ * \param devid the instance ID of the device to query.
+ * \returns a valid property ID on success or 0 on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetProperty
+ * \sa SDL_GetAudioStreamProperties
+ */
+extern DECLSPEC SDL_PropertiesID SDLCALL SDL_GetAudioDeviceProperties(SDL_AudioDeviceID devid);
+
+#define SDL_PROP_AUDIO_DEVICE_STATS_ITERATIONS_NUMBER               "SDL.audio.device.stats.iterations"
+#define SDL_PROP_AUDIO_DEVICE_STATS_ITERATE_TIME_MIN_NUMBER         "SDL.audio.device.stats.iterate_time.min_ns"
+#define SDL_PROP_AUDIO_DEVICE_STATS_ITERATE_TIME_AVG_NUMBER         "SDL.audio.device.stats.iterate_time.avg_ns"
+#define SDL_PROP_AUDIO_DEVICE_STATS_ITERATE_TIME_MAX_NUMBER         "SDL.audio.device.stats.iterate_time.max_ns"
+#define SDL_PROP_AUDIO_DEVICE_STATS_ITERATE_TIME_HISTOGRAM_PREFIX   "SDL.audio.device.stats.iterate_time.histogram."
+#define SDL_PROP_AUDIO_DEVICE_STATS_WAIT_TIME_MIN_NUMBER            "SDL.audio.device.stats.wait_time.min_ns"
+#define SDL_PROP_AUDIO_DEVICE_STATS_WAIT_TIME_AVG_NUMBER            "SDL.audio.device.stats.wait_time.avg_ns"
+#define SDL_PROP_AUDIO_DEVICE_STATS_WAIT_TIME_MAX_NUMBER            "SDL.audio.device.stats.wait_time.max_ns"
+#define SDL_PROP_AUDIO_DEVICE_STATS_WAIT_TIME_HISTOGRAM_PREFIX      "SDL.audio.device.stats.wait_time.histogram."
+#define SDL_PROP_AUDIO_DEVICE_STATS_STREAMS_MIN_NUMBER              "SDL.audio.device.stats.streams.min"
+#define SDL_PROP_AUDIO_DEVICE_STATS_STREAMS_AVG_NUMBER              "SDL.audio.device.stats.streams.avg"
+#define SDL_PROP_AUDIO_DEVICE_STATS_STREAMS_MAX_NUMBER              "SDL.audio.device.stats.streams.max"
+#define SDL_PROP_AUDIO_DEVICE_STATS_BYTES_CONVERTED_NUMBER          "SDL.audio.device.stats.bytes_converted"
+#define SDL_PROP_AUDIO_DEVICE_STATS_UNDERRUNS_NUMBER                "SDL.audio.device.stats.underruns"
+#define SDL_PROP_AUDIO_DEVICE_STATS_FRAMES_NUMBER                   "SDL.audio.device.stats.frames"
+#define SDL_PROP_AUDIO_DEVICE_STATS_REALTIME_RATIO_FLOAT            "SDL.audio.device.stats.realtime_ratio"
+#define SDL_PROP_AUDIO_DEVICE_STATS_OVERRUNS_NUMBER                 "SDL.audio.device.stats.overruns"
+#define SDL_PROP_AUDIO_DEVICE_STATS_BUFFER_RESIZES_NUMBER           "SDL.audio.device.stats.buffer_resizes"
+
+/**
+ * Get the current position of an output device, in sample frames.
+ *
+ * This counts every sample frame the device has mixed since it was opened,
+ * silence included, so it is also the device frame where the next buffer
+ * will start. It only moves forward, one device buffer (see
+ * SDL_GetAudioDeviceFormat) at a time, and is the clock that
+ * SDL_SetAudioStreamSchedule works with.
+ *
+ * Logical devices report the position of the physical device they are
+ * opened on. You may also specify SDL_AUDIO_DEVICE_DEFAULT_OUTPUT here.
+ *
+ * \param devid the instance ID of the output device to query.
+ * \returns the device's position in sample frames, or -1 on error; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_SetAudioStreamSchedule
+ */
+extern DECLSPEC Sint64 SDLCALL SDL_GetAudioDevicePosition(SDL_AudioDeviceID devid);
+
 
 /**
  * Open a specific audio device.
@@ -666,9 +796,98 @@ extern DECLSPEC SDL_AudioDeviceID SDLCALL SDL_GetAudioStreamDevice(SDL_AudioStre
  */
 extern DECLSPEC SDL_AudioStream *SDLCALL SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_AudioSpec *dst_spec);
 
+/**
+ * Create a new audio stream with the specified properties.
+ *
+ * These are the supported properties:
+ *
+ * - `SDL_PROP_AUDIOSTREAM_CREATE_SRC_SPEC_POINTER`: an SDL_AudioSpec with
+ *   the format details of the input audio, optional.
+ * - `SDL_PROP_AUDIOSTREAM_CREATE_DST_SPEC_POINTER`: an SDL_AudioSpec with
+ *   the format details of the output audio, optional.
+ * - `SDL_PROP_AUDIOSTREAM_CREATE_SPSC_BOOLEAN`: true if one thread puts data
+ *   into the stream while another one gets it. SDL_PutAudioStreamData will
+ *   copy data into a lock-free ring buffer without taking the stream's lock,
+ *   so it never waits on the thread (or audio device) getting data. Only
+ *   one thread may put data into the stream at a time, and it should be the
+ *   one that changes the input format, too. Data that doesn't fit in the
+ *   ring falls back to locking the stream. A put callback set with
+ *   SDL_SetAudioStreamPutCallback runs when data moves from the ring into
+ *   the stream. That happens on whichever thread drains the ring, usually the
+ *   audio device thread or the look-ahead worker, not the thread that called
+ *   SDL_PutAudioStreamData. The callback must not block, or take any lock the
+ *   producing thread might hold. Defaults to false.
+ * - `SDL_PROP_AUDIOSTREAM_CREATE_SPSC_BUFFER_SIZE_NUMBER`: the size of the
+ *   ring buffer in bytes, rounded up to a power of two. It should hold the
+ *   largest block you put at once. Defaults to 262144.
+ *
+ * \param props the properties to use
+ * \returns a new audio stream on success, or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_CreateAudioStream
+ * \sa SDL_CreateProperties
+ * \sa SDL_PutAudioStreamData
+ * \sa SDL_DestroyAudioStream
+ */
+extern DECLSPEC SDL_AudioStream *SDLCALL SDL_CreateAudioStreamWithProperties(SDL_PropertiesID props);
+
+#define SDL_PROP_AUDIOSTREAM_CREATE_SRC_SPEC_POINTER            "src_spec"
+#define SDL_PROP_AUDIOSTREAM_CREATE_DST_SPEC_POINTER            "dst_spec"
+#define SDL_PROP_AUDIOSTREAM_CREATE_SPSC_BOOLEAN                "spsc"
+#define SDL_PROP_AUDIOSTREAM_CREATE_SPSC_BUFFER_SIZE_NUMBER     "spsc.buffer_size"
+
 /**
  * Get the properties associated with an audio stream.
  *
+ * The following properties are understood by SDL:
+ *
+ * - `SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER`: an SDL_AudioResampleQuality
+ *   value to use when this stream resamples. Defaults to
+ *   SDL_AUDIO_RESAMPLE_QUALITY_HIGH. Changes take effect the next time data
+ *   is read from the stream.
+ * - `SDL_PROP_AUDIOSTREAM_CHUNK_POOL_MAX_BYTES_NUMBER`: the stream keeps the
+ *   memory that queued data was stored in after it has been read, so later
+ *   data can reuse it instead of allocating more. This caps how many bytes
+ *   it may keep. Once it holds as much as the stream's queue moves between
+ *   reads, putting and getting data does no heap allocation at all. Defaults
+ *   to 65536. Changes take effect the next time data is put into or read
+ *   from the stream.
+ * - `SDL_PROP_AUDIOSTREAM_LOOKAHEAD_BYTES_NUMBER`: if greater than zero, a
+ *   background thread converts and resamples queued data ahead of time,
+ *   until this many bytes of output are ready. Reading from the stream (for
+ *   example, by the audio device it is bound to) then mostly copies data
+ *   that's already converted, which keeps expensive resampling off the
+ *   audio device thread and lets it use smaller buffers without running
+ *   dry. Data that is converted ahead of time has already had the stream's
+ *   frequency ratio and channel matrix applied, so changes to those are
+ *   heard after it has been read. Setting this back to zero stops the
+ *   conversion ahead of time. Defaults to 0. Changes take effect the next
+ *   time data is put into or read from the stream.
+ *
+ * These are read-only, and updated every time this function is called:
+ *
+ * - `SDL_PROP_AUDIOSTREAM_CHUNK_POOL_ALLOCATIONS_NUMBER`: the number of
+ *   times the stream had to allocate memory for queued data.
+ * - `SDL_PROP_AUDIOSTREAM_CHUNK_POOL_REUSES_NUMBER`: the number of times the
+ *   stream reused memory from its pool instead.
+ * - `SDL_PROP_AUDIOSTREAM_CHUNK_POOL_FREES_NUMBER`: the number of times the
+ *   stream freed memory because the pool was full.
+ * - `SDL_PROP_AUDIOSTREAM_CHUNK_POOL_POOLED_BYTES_NUMBER`: the number of
+ *   bytes currently in the pool.
+ * - `SDL_PROP_AUDIOSTREAM_STATS_BYTES_CONVERTED_NUMBER`: the number of bytes
+ *   read from the stream, by the app or by a bound audio device.
+ * - `SDL_PROP_AUDIOSTREAM_STATS_UNDERRUNS_NUMBER`: the number of times the
+ *   output device this stream is bound to needed more data than the stream
+ *   had. See SDL_GetAudioDeviceProperties() for the device's totals.
+ * - `SDL_PROP_AUDIOSTREAM_STATS_LOOKAHEAD_BYTES_NUMBER`: the number of bytes
+ *   that have been converted ahead of time and are ready to be read. See
+ *   `SDL_PROP_AUDIOSTREAM_LOOKAHEAD_BYTES_NUMBER`.
+ *
  * \param stream the SDL_AudioStream to query
  * \returns a valid property ID on success or 0 on failure; call
  *          SDL_GetError() for more information.
@@ -677,9 +896,21 @@ extern DECLSPEC SDL_AudioStream *SDLCALL SDL_CreateAudioStream(const SDL_AudioSp
  *
  * \sa SDL_GetProperty
  * \sa SDL_SetProperty
+ * \sa SDL_GetAudioDeviceProperties
  */
 extern DECLSPEC SDL_PropertiesID SDLCALL SDL_GetAudioStreamProperties(SDL_AudioStream *stream);
 
+#define SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER            "SDL.audiostream.resample.quality"
+#define SDL_PROP_AUDIOSTREAM_CHUNK_POOL_MAX_BYTES_NUMBER        "SDL.audiostream.chunk_pool.max_bytes"
+#define SDL_PROP_AUDIOSTREAM_LOOKAHEAD_BYTES_NUMBER             "SDL.audiostream.lookahead.bytes"
+#define SDL_PROP_AUDIOSTREAM_CHUNK_POOL_ALLOCATIONS_NUMBER      "SDL.audiostream.chunk_pool.allocations"
+#define SDL_PROP_AUDIOSTREAM_CHUNK_POOL_REUSES_NUMBER           "SDL.audiostream.chunk_pool.reuses"
+#define SDL_PROP_AUDIOSTREAM_CHUNK_POOL_FREES_NUMBER            "SDL.audiostream.chunk_pool.frees"
+#define SDL_PROP_AUDIOSTREAM_CHUNK_POOL_POOLED_BYTES_NUMBER     "SDL.audiostream.chunk_pool.pooled_bytes"
+#define SDL_PROP_AUDIOSTREAM_STATS_BYTES_CONVERTED_NUMBER       "SDL.audiostream.stats.bytes_converted"
+#define SDL_PROP_AUDIOSTREAM_STATS_UNDERRUNS_NUMBER             "SDL.audiostream.stats.underruns"
+#define SDL_PROP_AUDIOSTREAM_STATS_LOOKAHEAD_BYTES_NUMBER       "SDL.audiostream.stats.lookahead_bytes"
+
 /**
  * Query the current format of an audio stream.
  *
@@ -765,6 +996,162 @@ extern DECLSPEC float SDLCALL SDL_GetAudioStreamFrequencyRatio(SDL_AudioStream *
  */
 extern DECLSPEC int SDLCALL SDL_SetAudioStreamFrequencyRatio(SDL_AudioStream *stream, float ratio);
 
+/**
+ * Get the gain of an audio stream.
+ *
+ * \param stream the SDL_AudioStream to query.
+ * \returns the gain of the stream, or -1.0f on error.
+ *
+ * \threadsafety It is safe to call this function from any thread, as it holds
+ *               a stream-specific mutex while running.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_SetAudioStreamGain
+ */
+extern DECLSPEC float SDLCALL SDL_GetAudioStreamGain(SDL_AudioStream *stream);
+
+/**
+ * Change the gain of an audio stream.
+ *
+ * The gain scales the stream's samples as they are mixed into a bound output
+ * device. 1.0 leaves them unchanged, 0.0 makes the stream silent, and values
+ * greater than 1.0 amplify it (which may clip).
+ *
+ * The gain is not applied by SDL_GetAudioStreamData, only when an output
+ * device mixes the stream. Changes are ramped smoothly over the next buffer
+ * the device mixes, so they can be made at any time without clicks.
+ *
+ * \param stream The stream the gain is being changed.
+ * \param gain The new gain. Must be 0.0 or greater.
+ * \returns 0 on success, or -1 on error.
+ *
+ * \threadsafety It is safe to call this function from any thread, as it holds
+ *               a stream-specific mutex while running.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetAudioStreamGain
+ * \sa SDL_SetAudioStreamPan
+ */
+extern DECLSPEC int SDLCALL SDL_SetAudioStreamGain(SDL_AudioStream *stream, float gain);
+
+/**
+ * Get the stereo pan of an audio stream.
+ *
+ * \param stream the SDL_AudioStream to query.
+ * \returns the pan of the stream, or 0.0f on error.
+ *
+ * \threadsafety It is safe to call this function from any thread, as it holds
+ *               a stream-specific mutex while running.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_SetAudioStreamPan
+ */
+extern DECLSPEC float SDLCALL SDL_GetAudioStreamPan(SDL_AudioStream *stream);
+
+/**
+ * Change the stereo pan of an audio stream.
+ *
+ * The pan works as a balance control when the stream is mixed into a stereo
+ * output device: -1.0 silences the right channel, 1.0 silences the left
+ * channel, and 0.0 leaves both unchanged. Values in between attenuate the
+ * opposite channel linearly. It has no effect on devices that aren't stereo.
+ *
+ * Like the gain, the pan is only applied when an output device mixes the
+ * stream, and changes are ramped smoothly.
+ *
+ * \param stream The stream the pan is being changed.
+ * \param pan The new pan. Must be between -1.0 and 1.0.
+ * \returns 0 on success, or -1 on error.
+ *
+ * \threadsafety It is safe to call this function from any thread, as it holds
+ *               a stream-specific mutex while running.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetAudioStreamPan
+ * \sa SDL_SetAudioStreamGain
+ */
+extern DECLSPEC int SDLCALL SDL_SetAudioStreamPan(SDL_AudioStream *stream, float pan);
+
+/**
+ * Set a custom matrix for remixing the channels of an audio stream.
+ *
+ * When a stream's input and output have different numbers of channels, it
+ * remixes them with a built-in set of coefficients (for example, 5.1 audio
+ * is folded down to stereo with the center channel split between left and
+ * right). This lets the app supply its own coefficients instead.
+ *
+ * `matrix` holds `dst_channels` rows of `src_channels` coefficients each.
+ * Output channel `j` of each sample frame is the sum of every input channel
+ * `k` multiplied by `matrix[j * src_channels + k]`. The matrix is copied, so
+ * the app may free it after this call.
+ *
+ * The matrix is only used while the stream's input has `src_channels`
+ * channels and its output has `dst_channels`; the built-in coefficients are
+ * used for anything else. A matrix is used even if the channel counts are
+ * the same, which allows things like swapping the left and right channels.
+ *
+ * A stream only holds one custom matrix. Setting a new one replaces the
+ * previous one, and passing a NULL `matrix` goes back to the built-in
+ * coefficients.
+ *
+ * Changes take effect the next time data is read from the stream.
+ *
+ * \param stream the stream whose channel remixing is being changed.
+ * \param src_channels the number of input channels, from 1 to 8.
+ * \param dst_channels the number of output channels, from 1 to 8.
+ * \param matrix the `dst_channels * src_channels` coefficients, or NULL.
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread, as it holds
+ *               a stream-specific mutex while running.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_SetAudioStreamFormat
+ */
+extern DECLSPEC int SDLCALL SDL_SetAudioStreamChannelMatrix(SDL_AudioStream *stream, int src_channels, int dst_channels, const float *matrix);
+
+/**
+ * Schedule when an audio stream plays on the output device it is bound to.
+ *
+ * Positions are in the device's sample frames, as reported by
+ * SDL_GetAudioDevicePosition. The device doesn't take any data from the
+ * stream before `start_frame`, and mixes the stream's first sample frame at
+ * exactly that position, even if it falls in the middle of a device buffer.
+ * Likewise, it stops taking data from the stream at `stop_frame`; whatever
+ * is left in the stream stays there. Pass -1 for either one to leave that
+ * end open. A stream that isn't scheduled to play doesn't count as an
+ * underrun.
+ *
+ * A position the device has already passed takes effect right away, so
+ * schedule starts a little ahead of the current position (a device buffer
+ * or more) to make sure they are sample accurate.
+ *
+ * Streams start out unscheduled, with both positions set to -1. The
+ * schedule is only used while the stream is bound to an output device, and
+ * stays in place if the stream is unbound or cleared.
+ *
+ * \param stream the stream to schedule.
+ * \param start_frame the device frame to start playing at, or -1.
+ * \param stop_frame the device frame to stop playing at, or -1.
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread, as it holds
+ *               a stream-specific mutex while running.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetAudioDevicePosition
+ * \sa SDL_BindAudioStream
+ */
+extern DECLSPEC int SDLCALL SDL_SetAudioStreamSchedule(SDL_AudioStream *stream, Sint64 start_frame, Sint64 stop_frame);
+
 /**
  * Add data to be converted/resampled to the stream.
  *
@@ -795,6 +1182,60 @@ extern DECLSPEC int SDLCALL SDL_SetAudioStreamFrequencyRatio(SDL_AudioStream *st
  */
 extern DECLSPEC int SDLCALL SDL_PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len);
 
+/**
+ * A callback that fires when data passed to SDL_PutAudioStreamDataNoCopy is
+ * no longer needed by the stream.
+ *
+ * This can happen because the stream has consumed the data, or because the
+ * stream was cleared or destroyed before it got to it. Either way, SDL will
+ * not touch `buf` again once this is called, so the app may reuse or free it.
+ *
+ * This callback may run from any thread, including the audio device's
+ * thread, while the stream's lock is held. Do as little work as possible.
+ *
+ * \param userdata An opaque pointer provided by the app for their personal
+ *                 use.
+ * \param buf The buffer that was passed to SDL_PutAudioStreamDataNoCopy.
+ * \param buflen The length of `buf`, in bytes.
+ *
+ * \since This datatype is available since SDL 3.0.0.
+ *
+ * \sa SDL_PutAudioStreamDataNoCopy
+ */
+typedef void (SDLCALL *SDL_AudioStreamDataCompleteCallback)(void *userdata, const void *buf, int buflen);
+
+/**
+ * Add data to the stream without copying it.
+ *
+ * This works like SDL_PutAudioStreamData, but the stream keeps a reference to
+ * `buf` instead of copying it. The app must not change or free the buffer
+ * until `callback` fires, which happens once the stream no longer needs it.
+ *
+ * This saves a copy (and the memory for it) when queueing large buffers of
+ * audio that already exist, like a whole decoded sound effect.
+ *
+ * \param stream The stream the audio data is being added to
+ * \param buf A pointer to the audio data to add
+ * \param len The number of bytes to add to the stream
+ * \param callback A callback to fire when the stream is done with `buf`, may
+ *                 be NULL if the buffer will outlive the stream anyhow.
+ * \param userdata An opaque pointer passed to `callback`.
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information. If this fails, `callback`
+ *          will not be called, and the app still owns `buf`.
+ *
+ * \threadsafety It is safe to call this function from any thread, but if the
+ *               stream has a callback set, the caller might need to manage
+ *               extra locking.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_PutAudioStreamData
+ * \sa SDL_ClearAudioStream
+ * \sa SDL_FlushAudioStream
+ */
+extern DECLSPEC int SDLCALL SDL_PutAudioStreamDataNoCopy(SDL_AudioStream *stream, const void *buf, int len, SDL_AudioStreamDataCompleteCallback callback, void *userdata);
+
 /**
  * Get converted/resampled data from the stream.
  *
@@ -824,6 +1265,78 @@ extern DECLSPEC int SDLCALL SDL_PutAudioStreamData(SDL_AudioStream *stream, cons
  */
 extern DECLSPEC int SDLCALL SDL_GetAudioStreamData(SDL_AudioStream *stream, void *buf, int len);
 
+/**
+ * One entry in a batch of audio stream puts or gets.
+ *
+ * \since This struct is available since SDL 3.0.0.
+ *
+ * \sa SDL_PutAudioStreamDataBatch
+ * \sa SDL_GetAudioStreamDataBatch
+ */
+typedef struct SDL_AudioStreamBuffer
+{
+    SDL_AudioStream *stream;    /**< The stream to put data into or get data from */
+    void *buf;                  /**< The audio data to put, or the buffer to fill */
+    int len;                    /**< The number of bytes to put, or the maximum number of bytes to fill */
+    int result;                 /**< Set by SDL: 0 or bytes read on success, -1 on error */
+} SDL_AudioStreamBuffer;
+
+/**
+ * Add data to several streams at once.
+ *
+ * This does the same work as calling SDL_PutAudioStreamData on each entry in
+ * order, but entries for the same stream that sit next to each other in the
+ * array are handled under a single lock of that stream, and its put callback
+ * (if any) runs once for the whole run of entries instead of once per entry.
+ * This makes it cheaper to feed many small buffers, or many streams, from a
+ * mixer or decoder thread.
+ *
+ * Each entry's `result` field is set to 0 on success or -1 on error. A failed
+ * entry doesn't stop the rest of the batch from being processed.
+ *
+ * \param buffers An array of streams, data and lengths to put
+ * \param num_buffers The number of entries in `buffers`
+ * \returns 0 if every entry succeeded, -1 if any failed; call
+ *          SDL_GetError() for more information about the last failure.
+ *
+ * \threadsafety It is safe to call this function from any thread, but if a
+ *               stream has a callback set, the caller might need to manage
+ *               extra locking.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_PutAudioStreamData
+ * \sa SDL_GetAudioStreamDataBatch
+ */
+extern DECLSPEC int SDLCALL SDL_PutAudioStreamDataBatch(SDL_AudioStreamBuffer *buffers, int num_buffers);
+
+/**
+ * Get converted/resampled data from several streams at once.
+ *
+ * This does the same work as calling SDL_GetAudioStreamData on each entry in
+ * order, but entries for the same stream that sit next to each other in the
+ * array are handled under a single lock of that stream.
+ *
+ * Each entry's `result` field is set to the number of bytes read into its
+ * buffer, or -1 on error. A failed entry doesn't stop the rest of the batch
+ * from being processed.
+ *
+ * \param buffers An array of streams, buffers and maximum lengths to fill
+ * \param num_buffers The number of entries in `buffers`
+ * \returns 0 if every entry succeeded, -1 if any failed; call
+ *          SDL_GetError() for more information about the last failure.
+ *
+ * \threadsafety It is safe to call this function from any thread, but if a
+ *               stream has a callback set, the caller might need to manage
+ *               extra locking.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetAudioStreamData
+ * \sa SDL_PutAudioStreamDataBatch
+ */
+extern DECLSPEC int SDLCALL SDL_GetAudioStreamDataBatch(SDL_AudioStreamBuffer *buffers, int num_buffers);
+
 /**
  * Get the number of converted/resampled bytes available.
  *
@@ -1067,6 +1580,11 @@ extern DECLSPEC int SDLCALL SDL_SetAudioStreamGetCallback(SDL_AudioStream *strea
  *
  * Clearing or flushing an audio stream does not call this callback.
  *
+ * On a stream created with `SDL_PROP_AUDIOSTREAM_CREATE_SPSC_BOOLEAN`, this
+ * callback runs on the thread that moves data out of the stream's ring
+ * buffer, not the one that put it there, so it must not block or take locks
+ * the producing thread holds. See SDL_CreateAudioStreamWithProperties.
+ *
  * This function obtains the stream's lock, which means any existing callback
  * (get or put) in progress will finish running before setting the new
  * callback.
@@ -1348,6 +1866,162 @@ extern DECLSPEC int SDLCALL SDL_LoadWAV_IO(SDL_IOStream * src, SDL_bool closeio,
 extern DECLSPEC int SDLCALL SDL_LoadWAV(const char *path, SDL_AudioSpec * spec,
                                         Uint8 ** audio_buf, Uint32 * audio_len);
 
+/**
+ * Load the audio data of a WAVE file, without copying it if possible.
+ *
+ * This works like SDL_LoadWAV_IO(), but if the data doesn't need to be
+ * decoded, `audio_buf` points straight into a memory mapping of the file
+ * instead of a copy of the data. This is the case for 8, 16 and 32-bit PCM
+ * and 32-bit float data. The pages of the file are read in by the operating
+ * system as they are accessed, and are shared with other processes that map
+ * the same file.
+ *
+ * Files opened by SDL_IOFromFile() can be mapped on platforms that support
+ * it. For streams from SDL_IOFromMem() and SDL_IOFromConstMem(), `audio_buf`
+ * points into the stream's memory, which has to stay valid until the audio
+ * data is freed. Anything else, including formats that have to be decoded,
+ * is loaded the same way as SDL_LoadWAV_IO() does.
+ *
+ * Either way, the returned data is read-only and must be freed with
+ * SDL_FreeMappedWAV(). It remains valid after `src` is closed.
+ *
+ * \param src The data source for the WAVE data
+ * \param closeio If SDL_TRUE, calls SDL_CloseIO() on `src` before returning,
+ *                even in the case of an error
+ * \param spec A pointer to an SDL_AudioSpec that will be set to the WAVE
+ *             data's format details on successful return
+ * \param audio_buf A pointer filled with the audio data
+ * \param audio_len A pointer filled with the length of the audio data buffer
+ *                  in bytes
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_FreeMappedWAV
+ * \sa SDL_LoadWAV_IO
+ * \sa SDL_LoadWAVMapped
+ */
+extern DECLSPEC int SDLCALL SDL_LoadWAVMapped_IO(SDL_IOStream *src, SDL_bool closeio, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len);
+
+/**
+ * Load the audio data of a WAVE file from a file path, without copying it if
+ * possible.
+ *
+ * This is a convenience function that is effectively the same as:
+ *
+ * ```c
+ * SDL_LoadWAVMapped_IO(SDL_IOFromFile(path, "rb"), 1, spec, audio_buf, audio_len);
+ * ```
+ *
+ * \param path The file path of the WAV file to open.
+ * \param spec A pointer to an SDL_AudioSpec that will be set to the WAVE
+ *             data's format details on successful return.
+ * \param audio_buf A pointer filled with the audio data.
+ * \param audio_len A pointer filled with the length of the audio data buffer
+ *                  in bytes.
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_FreeMappedWAV
+ * \sa SDL_LoadWAVMapped_IO
+ */
+extern DECLSPEC int SDLCALL SDL_LoadWAVMapped(const char *path, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len);
+
+/**
+ * Free audio data returned by SDL_LoadWAVMapped_IO().
+ *
+ * This unmaps the data if it was mapped, or frees it otherwise. It is also
+ * safe to use this on data from SDL_LoadWAV_IO().
+ *
+ * \param audio_buf The audio data to free, may be NULL.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_LoadWAVMapped_IO
+ */
+extern DECLSPEC void SDLCALL SDL_FreeMappedWAV(Uint8 *audio_buf);
+
+/**
+ * Open a WAVE file as an audio stream that decodes it as it plays.
+ *
+ * Unlike SDL_LoadWAV_IO(), this doesn't load the audio data up front. Only
+ * the headers are read when the stream is opened; after that, the data is
+ * read from `src` and decoded a block at a time, whenever data is requested
+ * from the stream (by SDL_GetAudioStreamData(), or by an audio device the
+ * stream is bound to). This keeps memory use and startup time low, no matter
+ * how long the file is.
+ *
+ * The stream's input format is the format of the decoded data, which is the
+ * same format SDL_LoadWAV_IO() would return, and is also written to `spec`.
+ * Its output format starts out the same, and can be changed with
+ * SDL_SetAudioStreamFormat() or by binding the stream to an audio device.
+ * Once all the data has been decoded, the stream is flushed.
+ *
+ * The stream uses its get callback to decode data, so the app must not
+ * replace it with SDL_SetAudioStreamGetCallback(), change the stream's input
+ * format, or put its own data into the stream. `src` must not be used by the
+ * app until the stream is destroyed.
+ *
+ * The same formats and hints as SDL_LoadWAV_IO() are supported. Errors found
+ * in the headers make this function fail, but errors in the audio data just
+ * end the stream early.
+ *
+ * It is required that the data source supports seeking.
+ *
+ * \param src The data source for the WAVE data
+ * \param closeio If SDL_TRUE, calls SDL_CloseIO() on `src` when the stream
+ *                is destroyed, or before returning if this function fails
+ * \param spec A pointer to an SDL_AudioSpec that will be set to the WAVE
+ *             data's format details on successful return, or NULL
+ * \returns an audio stream on success, ready to use, or NULL on failure; call
+ *          SDL_GetError() for more information. Destroy it with
+ *          SDL_DestroyAudioStream() when done.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_DestroyAudioStream
+ * \sa SDL_LoadWAV_IO
+ * \sa SDL_OpenWAVStream
+ */
+extern DECLSPEC SDL_AudioStream *SDLCALL SDL_OpenWAVStream_IO(SDL_IOStream *src, SDL_bool closeio, SDL_AudioSpec *spec);
+
+/**
+ * Open a WAVE file from a file path as an audio stream that decodes it as it
+ * plays.
+ *
+ * This is a convenience function that is effectively the same as:
+ *
+ * ```c
+ * SDL_OpenWAVStream_IO(SDL_IOFromFile(path, "rb"), 1, spec);
+ * ```
+ *
+ * \param path The file path of the WAV file to open.
+ * \param spec A pointer to an SDL_AudioSpec that will be set to the WAVE
+ *             data's format details on successful return, or NULL.
+ * \returns an audio stream on success, ready to use, or NULL on failure; call
+ *          SDL_GetError() for more information. Destroy it with
+ *          SDL_DestroyAudioStream() when done.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_DestroyAudioStream
+ * \sa SDL_OpenWAVStream_IO
+ */
+extern DECLSPEC SDL_AudioStream *SDLCALL SDL_OpenWAVStream(const char *path, SDL_AudioSpec *spec);
+
 
 
 #define SDL_MIX_MAXVOLUME 128
@@ -229,6 +229,27 @@ extern "C" {
  */
 #define SDL_HINT_AUDIO_DEVICE_APP_NAME "SDL_AUDIO_DEVICE_APP_NAME"
 
+/**
+ * A variable controlling how many extra threads pull data from audio streams.
+ *
+ * This hint is an integer >= 0. If it's greater than zero, an output device
+ * with several bound audio streams will convert them in parallel, using this
+ * many worker threads along with the device's own thread, before mixing the
+ * results in the usual order. This can help when an app has a very large
+ * number of streams, that would otherwise be too much work for a single
+ * thread to finish in time.
+ *
+ * Note that with this enabled, audio stream callbacks may be called from
+ * one of these worker threads while the device thread waits on them, so
+ * they must not call any functions that need to lock the audio device,
+ * like SDL_PauseAudioDevice() or SDL_BindAudioStream().
+ *
+ * The default value is "0", which does all the work on the device thread.
+ *
+ * This hint should be set before an audio device is opened.
+ */
+#define SDL_HINT_AUDIO_DEVICE_MIX_THREADS "SDL_AUDIO_DEVICE_MIX_THREADS"
+
 /**
  * A variable controlling device buffer size.
  *
@@ -249,6 +270,39 @@ extern "C" {
  */
 #define SDL_HINT_AUDIO_DEVICE_SAMPLE_FRAMES "SDL_AUDIO_DEVICE_SAMPLE_FRAMES"
 
+/**
+ * A variable controlling whether SDL tunes an output device's buffer size
+ * while it plays.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": The device keeps the buffer size it was opened with. (default)
+ * - "1": The device starts with the buffer size it was opened with (see
+ *   SDL_HINT_AUDIO_DEVICE_SAMPLE_FRAMES), which also becomes the largest
+ *   size it will use. While it plays, SDL watches for underruns and for the
+ *   device thread running late, halves the buffer size while things run
+ *   smoothly, and doubles it again when they don't, never going below
+ *   SDL_HINT_AUDIO_DEVICE_MIN_SAMPLE_FRAMES. Each change is reported with an
+ *   SDL_EVENT_AUDIO_DEVICE_FORMAT_CHANGED event.
+ *
+ * Only some audio drivers can change their buffer size while a device is
+ * open (currently "dummy" and "disk"); the others ignore this hint.
+ *
+ * This hint should be set before an audio device is opened.
+ */
+#define SDL_HINT_AUDIO_DEVICE_ADAPTIVE_SAMPLE_FRAMES "SDL_AUDIO_DEVICE_ADAPTIVE_SAMPLE_FRAMES"
+
+/**
+ * A variable controlling the smallest buffer size, in sample frames, that
+ * SDL_HINT_AUDIO_DEVICE_ADAPTIVE_SAMPLE_FRAMES may pick.
+ *
+ * The default value is 64 sample frames, or the size the device was opened
+ * with, if that is smaller.
+ *
+ * This hint should be set before an audio device is opened.
+ */
+#define SDL_HINT_AUDIO_DEVICE_MIN_SAMPLE_FRAMES "SDL_AUDIO_DEVICE_MIN_SAMPLE_FRAMES"
+
 /**
  * Specify an audio stream name for an audio device.
  *
@@ -290,6 +344,23 @@ extern "C" {
  */
 #define SDL_HINT_AUDIO_DEVICE_STREAM_ROLE "SDL_AUDIO_DEVICE_STREAM_ROLE"
 
+/**
+ * A variable controlling the speed of the "disk" audio driver.
+ *
+ * The disk driver has no hardware to tell it when to write the next buffer,
+ * so it keeps time itself. This hint is a float that scales the time each
+ * buffer takes: "1.0" runs in real time (the default), "2.0" at half speed,
+ * and "0" runs the mixer as fast as it can, which is useful for rendering
+ * audio offline. See SDL_GetAudioDeviceProperties() for throughput
+ * statistics.
+ *
+ * The SDL_DISKAUDIODELAY environment variable, a fixed number of
+ * milliseconds to wait between buffers, takes precedence over this hint.
+ *
+ * This hint should be set before an audio device is opened.
+ */
+#define SDL_HINT_AUDIO_DISK_TIMESCALE "SDL_AUDIO_DISK_TIMESCALE"
+
 /**
  * A variable that specifies an audio backend to use.
  *
@@ -299,6 +370,16 @@ extern "C" {
  */
 #define SDL_HINT_AUDIO_DRIVER "SDL_AUDIO_DRIVER"
 
+/**
+ * A variable controlling the speed of the "dummy" audio driver.
+ *
+ * This works like SDL_HINT_AUDIO_DISK_TIMESCALE. The SDL_DUMMYAUDIODELAY
+ * environment variable takes precedence over this hint.
+ *
+ * This hint should be set before an audio device is opened.
+ */
+#define SDL_HINT_AUDIO_DUMMY_TIMESCALE "SDL_AUDIO_DUMMY_TIMESCALE"
+
 /**
  * A variable that causes SDL to not ignore audio "monitors"
  *
@@ -1941,6 +2022,19 @@ extern "C" {
  */
 #define SDL_HINT_STORAGE_USER_DRIVER "SDL_STORAGE_USER_DRIVER"
 
+/**
+ * A variable controlling how many worker threads help with large surface blits.
+ *
+ * When this is greater than zero, SDL_BlitSurface(), SDL_BlitSurfaceScaled() and SDL_SoftStretch() split blits covering a few hundred thousand pixels or more into bands of rows, which are blitted in parallel by a pool of this many worker threads along with the calling thread. The call returns once all the bands are done, and the result is the same as blitting on a single thread.
+ *
+ * Only one blit at a time uses the worker threads, blits happening on other threads at the same time run as usual. Blits where the source and destination memory overlap always run on the calling thread.
+ *
+ * The default value is "0", which does every blit on the calling thread.
+ *
+ * This hint can be set anytime.
+ */
+#define SDL_HINT_SURFACE_BLIT_THREADS "SDL_SURFACE_BLIT_THREADS"
+
 /**
  * Specifies whether SDL_THREAD_PRIORITY_TIME_CRITICAL should be treated as realtime.
  *
@@ -2285,6 +2379,20 @@ extern "C" {
  */
 #define SDL_HINT_VITA_TOUCH_MOUSE_DEVICE    "SDL_HINT_VITA_TOUCH_MOUSE_DEVICE"
 
+/**
+ * A variable controlling how many threads are used to decode large ADPCM WAVE files.
+ *
+ * MS ADPCM and IMA ADPCM data is made of blocks that can be decoded independently. When a file has enough of them, SDL splits the blocks between several threads.
+ *
+ * The variable can be set to the following values:
+ *   "0"  - Use as many threads as there are CPU cores, if the file is big enough. (default)
+ *   "1"  - Decode on the calling thread only.
+ *   "N"  - Use up to N threads, regardless of the file size.
+ *
+ * This hint should be set before calling SDL_LoadWAV() or SDL_LoadWAV_IO()
+ */
+#define SDL_HINT_WAVE_DECODE_THREADS   "SDL_WAVE_DECODE_THREADS"
+
 /**
  * A variable controlling how the fact chunk affects the loading of a WAVE file.
  *
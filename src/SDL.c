@@ -541,6 +541,7 @@ void SDL_Quit(void)
     SDL_HelperWindowDestroy();
 #endif
     SDL_QuitSubSystem(SDL_INIT_EVERYTHING);
+    SDL_QuitBlitThreads();
 
     SDL_QuitTicks();
     SDL_QuitTime();
@@ -180,6 +180,41 @@ void OnAudioStreamDestroy(SDL_AudioStream *stream)
     }
 }
 
+// Get the per-channel gains a stream's gain and pan work out to on a device with `channels` channels.
+static void GetAudioStreamMixGains(SDL_AudioStream *stream, int channels, float *gains)
+{
+    SDL_assert(channels <= (int)SDL_arraysize(stream->mix_gains));
+
+    SDL_LockMutex(stream->lock);
+    const float gain = stream->gain;
+    const float pan = stream->pan;
+    SDL_UnlockMutex(stream->lock);
+
+    for (int i = 0; i < channels; i++) {
+        gains[i] = gain;
+    }
+
+    if (channels == 2) {  // pan is a balance control, and only means something for stereo.
+        gains[0] = gain * SDL_min(1.0f, 1.0f - pan);
+        gains[1] = gain * SDL_min(1.0f, 1.0f + pan);
+    }
+}
+
+// device should be locked when calling this. SDL_TRUE if the stream is at unity gain and isn't ramping away from something else.
+static SDL_bool AudioStreamHasUnityGain(SDL_AudioDevice *device, SDL_AudioStream *stream)
+{
+    const int channels = device->spec.channels;
+    float gains[8];
+
+    GetAudioStreamMixGains(stream, channels, gains);
+    for (int i = 0; i < channels; i++) {
+        if ((gains[i] != 1.0f) || (stream->mix_gains[i] != 1.0f)) {
+            return SDL_FALSE;
+        }
+    }
+    return SDL_TRUE;
+}
+
 // device should be locked when calling this.
 static SDL_bool AudioDeviceCanUseSimpleCopy(SDL_AudioDevice *device)
 {
@@ -189,7 +224,8 @@ static SDL_bool AudioDeviceCanUseSimpleCopy(SDL_AudioDevice *device)
         !device->logical_devices->next &&  // there's only _ONE_ logical device
         !device->logical_devices->postmix && // there isn't a postmix callback
         device->logical_devices->bound_streams &&  // there's a bound stream
-        !device->logical_devices->bound_streams->next_binding  // there's only _ONE_ bound stream.
+        !device->logical_devices->bound_streams->next_binding &&  // there's only _ONE_ bound stream.
+        AudioStreamHasUnityGain(device, device->logical_devices->bound_streams)  // the stream's gain and pan don't need the mixer.
     );
 }
 
@@ -210,9 +246,9 @@ static void UpdateAudioStreamFormatsPhysical(SDL_AudioDevice *device)
         for (SDL_LogicalAudioDevice *logdev = device->logical_devices; logdev; logdev = logdev->next) {
             for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
                 // set the proper end of the stream to the device's format.
-                // SDL_SetAudioStreamFormat does a ton of validation just to memcpy an audiospec.
+                // SDL_SetAudioStreamFormat does a ton of validation we don't need here.
                 SDL_LockMutex(stream->lock);
-                SDL_copyp(&stream->dst_spec, &spec);
+                SetAudioStreamDestSpec(stream, &spec);
                 SDL_UnlockMutex(stream->lock);
             }
         }
@@ -490,6 +526,7 @@ static void DestroyPhysicalAudioDevice(SDL_AudioDevice *device)
 
     SDL_UnlockMutex(device->lock);  // don't use ReleaseAudioDevice because we don't want to change refcounts while destroying.
 
+    SDL_DestroyProperties(device->props);
     SDL_DestroyMutex(device->lock);
     SDL_DestroyCondition(device->close_cond);
     SDL_free(device->work_buffer);
@@ -832,6 +869,7 @@ int SDL_InitAudio(const char *driver_name)
     SDL_AtomicCompareAndSwap(&last_device_instance_id, 0, 2);
 
     SDL_ChooseAudioConverters();
+    SDL_ChooseAudioMixers();
     SDL_SetupAudioResampler();
 
     SDL_RWLock *device_hash_lock = SDL_CreateRWLock();  // create this early, so if it fails we don't have to tear down the whole audio subsystem.
@@ -1022,6 +1060,457 @@ static void MixFloat32Audio(float *dst, const float *src, const int buffer_size)
     }
 }
 
+// Mix a bound stream's output, ramping from the gains it was last mixed with to its current gain and pan. Hold device->lock!
+static void MixAudioStreamFloat32(SDL_AudioDevice *device, SDL_AudioStream *stream, float *dst, const float *src, const int buffer_size)
+{
+    const int channels = device->spec.channels;
+    const int num_frames = buffer_size / (int)(sizeof (float) * channels);
+    float gains[8];
+    float steps[8];
+    SDL_bool unity = SDL_TRUE;
+
+    GetAudioStreamMixGains(stream, channels, gains);
+    for (int i = 0; i < channels; i++) {
+        if ((gains[i] != 1.0f) || (stream->mix_gains[i] != 1.0f)) {
+            unity = SDL_FALSE;
+        }
+        steps[i] = (num_frames > 0) ? ((gains[i] - stream->mix_gains[i]) / (float)num_frames) : 0.0f;
+    }
+
+    if (unity) {
+        MixFloat32Audio(dst, src, buffer_size);  // nothing to scale, so use the plain mixer.
+    } else if (num_frames > 0) {
+        SDL_Mix_F32_Gain(dst, src, num_frames, channels, stream->mix_gains, steps);
+        SDL_memcpy(stream->mix_gains, gains, sizeof (float) * channels);
+    }
+}
+
+
+// Worker pool for pulling data from an output device's bound streams in parallel.
+// The device thread fills in one job per stream, everyone (the device thread included) grabs jobs until they're gone,
+// and then the device thread mixes the results in the same order it would have otherwise.
+
+typedef struct SDL_AudioMixJob
+{
+    SDL_AudioStream *stream;
+    Uint8 *buffer;
+    int frame_offset;  // where in the device buffer this stream's data goes, from GetAudioStreamPlayWindow.
+    int request_bytes;
+    int result;
+} SDL_AudioMixJob;
+
+typedef struct SDL_AudioMixPool
+{
+    SDL_Thread **threads;
+    int num_threads;
+    SDL_Semaphore *work_sem;
+    SDL_Semaphore *done_sem;
+    SDL_AtomicInt shutdown;
+
+    // These are only touched by the device thread, except for the jobs themselves while they're running.
+    SDL_AudioMixJob *jobs;
+    int num_jobs;
+    int jobs_allocation;
+    int *logdev_jobs;  // index of each logical device's first job, or -1 if it was paused when the jobs were set up.
+    int logdev_jobs_allocation;
+    Uint8 *buffers;
+    size_t buffers_allocation;
+    SDL_AtomicInt next_job;
+} SDL_AudioMixPool;
+
+static void RunAudioMixJobs(SDL_AudioMixPool *pool)
+{
+    while (SDL_TRUE) {
+        const int i = SDL_AtomicAdd(&pool->next_job, 1);
+        if (i >= pool->num_jobs) {
+            break;
+        }
+        SDL_AudioMixJob *job = &pool->jobs[i];
+        job->result = job->request_bytes ? SDL_GetAudioStreamData(job->stream, job->buffer, job->request_bytes) : 0;
+    }
+}
+
+static int SDLCALL AudioMixWorkerThread(void *data)
+{
+    SDL_AudioMixPool *pool = (SDL_AudioMixPool *) data;
+
+    SDL_SetThreadPriority(SDL_THREAD_PRIORITY_TIME_CRITICAL);
+
+    while (SDL_TRUE) {
+        SDL_WaitSemaphore(pool->work_sem);
+        if (SDL_AtomicGet(&pool->shutdown)) {
+            break;
+        }
+        RunAudioMixJobs(pool);
+        SDL_PostSemaphore(pool->done_sem);
+    }
+
+    return 0;
+}
+
+static void DestroyAudioMixPool(SDL_AudioMixPool *pool)
+{
+    if (!pool) {
+        return;
+    }
+
+    SDL_AtomicSet(&pool->shutdown, 1);
+    for (int i = 0; i < pool->num_threads; i++) {
+        SDL_PostSemaphore(pool->work_sem);
+    }
+    for (int i = 0; i < pool->num_threads; i++) {
+        SDL_WaitThread(pool->threads[i], NULL);
+    }
+
+    SDL_DestroySemaphore(pool->work_sem);
+    SDL_DestroySemaphore(pool->done_sem);
+    SDL_free(pool->threads);
+    SDL_free(pool->jobs);
+    SDL_free(pool->logdev_jobs);
+    SDL_aligned_free(pool->buffers);
+    SDL_free(pool);
+}
+
+static SDL_AudioMixPool *CreateAudioMixPool(SDL_AudioDevice *device, int num_threads)
+{
+    SDL_AudioMixPool *pool = (SDL_AudioMixPool *) SDL_calloc(1, sizeof (SDL_AudioMixPool));
+    if (!pool) {
+        return NULL;
+    }
+
+    pool->threads = (SDL_Thread **) SDL_calloc(num_threads, sizeof (SDL_Thread *));
+    pool->work_sem = SDL_CreateSemaphore(0);
+    pool->done_sem = SDL_CreateSemaphore(0);
+    if (!pool->threads || !pool->work_sem || !pool->done_sem) {
+        DestroyAudioMixPool(pool);
+        return NULL;
+    }
+
+    char threadname[64];
+    SDL_GetAudioThreadName(device, threadname, sizeof (threadname));
+    const size_t namelen = SDL_strlen(threadname);
+
+    for (int i = 0; i < num_threads; i++) {
+        const size_t stacksize = 0;  // just take the system default, since audio streams might have callbacks.
+        SDL_snprintf(threadname + namelen, sizeof (threadname) - namelen, "-mix%d", i);
+        pool->threads[i] = SDL_CreateThreadInternal(AudioMixWorkerThread, threadname, stacksize, pool);
+        if (!pool->threads[i]) {
+            break;
+        }
+        pool->num_threads++;
+    }
+
+    if (pool->num_threads == 0) {
+        DestroyAudioMixPool(pool);
+        return NULL;
+    }
+
+    return pool;
+}
+
+static int GetAudioMixThreadsFromHint(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_AUDIO_DEVICE_MIX_THREADS);
+    if (hint) {
+        const int val = SDL_atoi(hint);
+        if (val > 0) {
+            return SDL_min(val, 64);  // picked arbitrarily.
+        }
+    }
+    return 0;
+}
+
+// Which part of the device buffer starting at `position` a stream plays in, going by SDL_SetAudioStreamSchedule. Returns the number of frames.
+static int GetAudioStreamPlayWindow(SDL_AudioStream *stream, Uint64 position, int num_frames, int *frame_offset)
+{
+    SDL_LockMutex(stream->lock);
+    const Sint64 start_frame = stream->start_frame;
+    const Sint64 stop_frame = stream->stop_frame;
+    SDL_UnlockMutex(stream->lock);
+
+    const Sint64 pos = (Sint64) position;
+    Sint64 begin = 0;
+    Sint64 end = num_frames;
+    if (start_frame > pos) {
+        begin = SDL_min(start_frame - pos, (Sint64) num_frames);
+    }
+    if (stop_frame >= 0) {
+        end = SDL_clamp(stop_frame - pos, 0, (Sint64) num_frames);
+    }
+
+    *frame_offset = (int) begin;
+    return (int) SDL_max(end - begin, 0);
+}
+
+// Set up a job for each stream that needs data. Returns SDL_FALSE if it's not worth doing this in parallel (or we ran out of memory).
+static SDL_bool PrepareAudioMixJobs(SDL_AudioDevice *device, int num_frames)
+{
+    SDL_AudioMixPool *pool = device->mix_pool;
+    int num_jobs = 0;
+    int num_logdevs = 0;
+
+    for (SDL_LogicalAudioDevice *logdev = device->logical_devices; logdev; logdev = logdev->next) {
+        num_logdevs++;
+        for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
+            num_jobs++;
+        }
+    }
+
+    if (num_jobs < 2) {
+        return SDL_FALSE;
+    }
+
+    if (pool->jobs_allocation < num_jobs) {
+        SDL_AudioMixJob *jobs = (SDL_AudioMixJob *) SDL_realloc(pool->jobs, num_jobs * sizeof (SDL_AudioMixJob));
+        if (!jobs) {
+            return SDL_FALSE;
+        }
+        pool->jobs = jobs;
+        pool->jobs_allocation = num_jobs;
+    }
+
+    if (pool->logdev_jobs_allocation < num_logdevs) {
+        int *logdev_jobs = (int *) SDL_realloc(pool->logdev_jobs, num_logdevs * sizeof (int));
+        if (!logdev_jobs) {
+            return SDL_FALSE;
+        }
+        pool->logdev_jobs = logdev_jobs;
+        pool->logdev_jobs_allocation = num_logdevs;
+    }
+
+    const size_t simd_alignment = SDL_SIMDGetAlignment();
+    const size_t buffer_stride = ((size_t) device->work_buffer_size + simd_alignment - 1) & ~(simd_alignment - 1);
+    if (pool->buffers_allocation < (num_jobs * buffer_stride)) {
+        Uint8 *buffers = (Uint8 *) SDL_aligned_alloc(simd_alignment, num_jobs * buffer_stride);
+        if (!buffers) {
+            return SDL_FALSE;
+        }
+        SDL_aligned_free(pool->buffers);
+        pool->buffers = buffers;
+        pool->buffers_allocation = num_jobs * buffer_stride;
+    }
+
+    int i = 0;
+    num_jobs = 0;
+    for (SDL_LogicalAudioDevice *logdev = device->logical_devices; logdev; logdev = logdev->next, i++) {
+        if (SDL_AtomicGet(&logdev->paused)) {
+            pool->logdev_jobs[i] = -1;
+            continue;  // paused? Skip this logical device.
+        }
+        pool->logdev_jobs[i] = num_jobs;
+        for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
+            SDL_AudioMixJob *job = &pool->jobs[num_jobs];
+            job->stream = stream;
+            job->buffer = pool->buffers + (num_jobs * buffer_stride);
+            job->request_bytes = GetAudioStreamPlayWindow(stream, device->position, num_frames, &job->frame_offset) * (int) sizeof (float) * device->spec.channels;
+            job->result = 0;
+            num_jobs++;
+        }
+    }
+
+    pool->num_jobs = num_jobs;
+    return SDL_TRUE;
+}
+
+// Pull data from all the streams set up by PrepareAudioMixJobs, and wait for it to finish.
+static void RunAudioMixPool(SDL_AudioMixPool *pool)
+{
+    const int num_workers = SDL_min(pool->num_threads, pool->num_jobs - 1);
+
+    SDL_AtomicSet(&pool->next_job, 0);
+
+    for (int i = 0; i < num_workers; i++) {
+        SDL_PostSemaphore(pool->work_sem);
+    }
+
+    RunAudioMixJobs(pool);  // the device thread pitches in, too.
+
+    for (int i = 0; i < num_workers; i++) {
+        SDL_WaitSemaphore(pool->done_sem);
+    }
+}
+
+
+// Performance counters for the device threads. These all expect the device lock to be held.
+
+static void RecordAudioTiming(SDL_AudioTimingStats *stats, Uint64 ns)
+{
+    if ((stats->count == 0) || (ns < stats->min_ns)) {
+        stats->min_ns = ns;
+    }
+    if (ns > stats->max_ns) {
+        stats->max_ns = ns;
+    }
+    stats->count++;
+    stats->total_ns += ns;
+
+    const Uint64 us = ns / 1000;
+    int bucket = 0;
+    while ((bucket < (SDL_AUDIO_STATS_HISTOGRAM_BUCKETS - 1)) && (us >= (((Uint64) 1) << bucket))) {
+        bucket++;
+    }
+    stats->histogram[bucket]++;
+}
+
+static Uint64 BeginAudioThreadIterateStats(SDL_AudioDevice *device)
+{
+    const Uint64 now = SDL_GetTicksNS();
+    if (device->stats.last_iterate_end_ns) {
+        RecordAudioTiming(&device->stats.wait_time, now - device->stats.last_iterate_end_ns);
+    }
+    return now;
+}
+
+// `device_bytes` is how much audio the device played or recorded this time. Returns the time since the previous iteration ended, or 0.
+static Uint64 EndAudioThreadIterateStats(SDL_AudioDevice *device, Uint64 start_ns, int num_streams, int device_bytes)
+{
+    SDL_AudioDeviceStats *stats = &device->stats;
+    const Uint64 now = SDL_GetTicksNS();
+    const Uint64 cycle_ns = stats->last_iterate_end_ns ? (now - stats->last_iterate_end_ns) : 0;
+
+    if (device_bytes > 0) {
+        const Uint64 frames = (Uint64) (device_bytes / SDL_AUDIO_FRAMESIZE(device->spec));
+        stats->frames += frames;
+        stats->audio_ns += (frames * SDL_NS_PER_SECOND) / device->spec.freq;
+    }
+
+    if ((stats->iterate_time.count == 0) || (num_streams < stats->min_streams)) {
+        stats->min_streams = num_streams;
+    }
+    if (num_streams > stats->max_streams) {
+        stats->max_streams = num_streams;
+    }
+    stats->total_streams += num_streams;
+
+    RecordAudioTiming(&stats->iterate_time, now - start_ns);
+    stats->last_iterate_end_ns = now;
+
+    return cycle_ns;
+}
+
+// A bound output stream gave us less than we asked for.
+static void RecordAudioStreamUnderrun(SDL_AudioDevice *device, SDL_AudioStream *stream)
+{
+    device->stats.underruns++;
+    SDL_AtomicIncRef(&stream->underruns);
+}
+
+static void InitAudioDeviceAdaptation(SDL_AudioDevice *device)
+{
+    SDL_AudioDeviceAdaptation *adaptation = &device->adaptation;
+
+    SDL_zerop(adaptation);
+    if (device->iscapture || !current_audio.impl.SupportsAdaptiveSampleFrames || !SDL_GetHintBoolean(SDL_HINT_AUDIO_DEVICE_ADAPTIVE_SAMPLE_FRAMES, SDL_FALSE)) {
+        return;
+    }
+
+    int min_sample_frames = 64;
+    const char *hint = SDL_GetHint(SDL_HINT_AUDIO_DEVICE_MIN_SAMPLE_FRAMES);
+    if (hint && (SDL_atoi(hint) > 0)) {
+        min_sample_frames = SDL_atoi(hint);
+    }
+
+    adaptation->enabled = SDL_TRUE;
+    adaptation->max_sample_frames = device->sample_frames;
+    adaptation->min_sample_frames = SDL_min(min_sample_frames, device->sample_frames);
+    adaptation->trouble_count = device->stats.underruns + device->stats.overruns;
+    adaptation->calm_windows_needed = 2;
+}
+
+// Shrink the device buffer while things go smoothly, and grow it back when they don't. Called by the device thread, holding the device lock.
+static void AdaptAudioDeviceSampleFrames(SDL_AudioDevice *device, Uint64 cycle_ns)
+{
+    SDL_AudioDeviceAdaptation *adaptation = &device->adaptation;
+    if (!adaptation->enabled) {
+        return;
+    }
+
+    const Uint64 period_ns = (((Uint64) device->sample_frames) * SDL_NS_PER_SECOND) / device->spec.freq;
+    // A late buffer can be made up by an early one, so track how far behind the device thread has fallen overall.
+    // The first buffer after a resize might still be paced for the old size, so don't hold the first of each window against it.
+    if (adaptation->iterations > 0) {
+        const Uint64 due_ns = adaptation->late_ns + cycle_ns;
+        adaptation->late_ns = (due_ns > period_ns) ? (due_ns - period_ns) : 0;
+        adaptation->max_late_ns = SDL_max(adaptation->max_late_ns, adaptation->late_ns);
+    }
+
+    // Judge about a quarter second at a time, but at least a few buffers.
+    const int window = SDL_max(8, (device->spec.freq / 4) / device->sample_frames);
+    if (++adaptation->iterations < window) {
+        return;
+    }
+
+    const Uint64 trouble_count = device->stats.underruns + device->stats.overruns;
+    const SDL_bool trouble = (trouble_count != adaptation->trouble_count) || (adaptation->max_late_ns > (period_ns / 2));
+    int sample_frames = device->sample_frames;
+
+    if (trouble) {
+        adaptation->calm_windows = 0;
+        if (sample_frames < adaptation->max_sample_frames) {
+            sample_frames = SDL_min(sample_frames * 2, adaptation->max_sample_frames);
+            adaptation->calm_windows_needed = SDL_min(adaptation->calm_windows_needed * 2, 16);  // this size didn't work out, so don't try it again too soon.
+        }
+    } else if (++adaptation->calm_windows >= adaptation->calm_windows_needed) {
+        adaptation->calm_windows = 0;
+        sample_frames = SDL_max(sample_frames / 2, adaptation->min_sample_frames);
+    }
+
+    adaptation->iterations = 0;
+    adaptation->late_ns = 0;
+    adaptation->max_late_ns = 0;
+    adaptation->trouble_count = trouble_count;
+
+    if (sample_frames != device->sample_frames) {
+        SDL_AudioSpec spec;
+        SDL_copyp(&spec, &device->spec);
+        if (SDL_AudioDeviceFormatChangedAlreadyLocked(device, &spec, sample_frames) == 0) {
+            device->stats.buffer_resizes++;
+        }
+    }
+}
+
+
+void SDL_InitAudioDeviceClock(SDL_AudioDeviceClock *clock, const char *timescale_hint, const char *delay_envr)
+{
+    const char *envr = SDL_getenv(delay_envr);
+    const char *hint = SDL_GetHint(timescale_hint);
+
+    SDL_zerop(clock);
+    clock->timescale = 1.0f;
+    if (envr) {
+        clock->fixed_period = SDL_TRUE;
+        clock->period_ns = SDL_MS_TO_NS((Uint64) SDL_max(SDL_atoi(envr), 0));
+    } else if (hint) {
+        clock->timescale = SDL_max((float) SDL_atof(hint), 0.0f);
+    }
+}
+
+void SDL_WaitAudioDeviceClock(SDL_AudioDevice *device, SDL_AudioDeviceClock *clock)
+{
+    Uint64 period_ns = clock->period_ns;
+    if (!clock->fixed_period) {
+        // recalculated every time, in case the device format changed.
+        period_ns = (Uint64) ((((double) device->sample_frames) * SDL_NS_PER_SECOND / device->spec.freq) * clock->timescale);
+    }
+
+    if (period_ns == 0) {
+        return;  // as fast as possible.
+    }
+
+    const Uint64 now = SDL_GetTicksNS();
+    if (clock->next_ns == 0) {
+        clock->next_ns = now;  // the first buffer is due right away, like real hardware that wants to be filled up.
+    } else if (now >= (clock->next_ns + period_ns)) {
+        SDL_LockMutex(device->lock);
+        device->stats.overruns++;
+        SDL_UnlockMutex(device->lock);
+        clock->next_ns = now;
+    } else if (now < clock->next_ns) {
+        SDL_DelayNS(clock->next_ns - now);
+    }
+    clock->next_ns += period_ns;
+}
+
 
 // Output device thread. This is split into chunks, so backends that need to control this directly can use the pieces they need without duplicating effort.
 
@@ -1042,6 +1531,8 @@ SDL_bool SDL_OutputAudioThreadIterate(SDL_AudioDevice *device)
         return SDL_FALSE;  // we're done, shut it down.
     }
 
+    const Uint64 start_ns = BeginAudioThreadIterateStats(device);
+    int num_streams = 0;
     SDL_bool failed = SDL_FALSE;
     int buffer_size = device->buffer_size;
     Uint8 *device_buffer = device->GetDeviceBuf(device, &buffer_size);
@@ -1051,7 +1542,10 @@ SDL_bool SDL_OutputAudioThreadIterate(SDL_AudioDevice *device)
         failed = SDL_TRUE;
     } else {
         SDL_assert(buffer_size <= device->buffer_size);  // you can ask for less, but not more.
-        SDL_assert(AudioDeviceCanUseSimpleCopy(device) == device->simple_copy);  // make sure this hasn't gotten out of sync.
+        // a stream's gain and pan can change without the device lock, so switch to (or back from) mixing here if needed.
+        if (AudioDeviceCanUseSimpleCopy(device) != device->simple_copy) {
+            UpdateAudioStreamFormatsPhysical(device);
+        }
 
         // can we do a basic copy without silencing/mixing the buffer? This is an extremely likely scenario, so we special-case it.
         if (device->simple_copy) {
@@ -1061,12 +1555,33 @@ SDL_bool SDL_OutputAudioThreadIterate(SDL_AudioDevice *device)
             // We should have updated this elsewhere if the format changed!
             SDL_assert(AUDIO_SPECS_EQUAL(stream->dst_spec, device->spec));
 
-            const int br = SDL_AtomicGet(&logdev->paused) ? 0 : SDL_GetAudioStreamData(stream, device_buffer, buffer_size);
+            const int frame_size = SDL_AUDIO_FRAMESIZE(device->spec);
+            const SDL_bool paused = (SDL_AtomicGet(&logdev->paused) != 0);
+            int frame_offset = 0;
+            const int request_bytes = paused ? 0 : (GetAudioStreamPlayWindow(stream, device->position, buffer_size / frame_size, &frame_offset) * frame_size);
+            const int offset_bytes = frame_offset * frame_size;
+            const int br = request_bytes ? SDL_GetAudioStreamData(stream, device_buffer + offset_bytes, request_bytes) : 0;
             if (br < 0) {  // Probably OOM. Kill the audio device; the whole thing is likely dying soon anyhow.
                 failed = SDL_TRUE;
                 SDL_memset(device_buffer, device->silence_value, buffer_size);  // just supply silence to the device before we die.
-            } else if (br < buffer_size) {
-                SDL_memset(device_buffer + br, device->silence_value, buffer_size - br);  // silence whatever we didn't write to.
+            } else {
+                // silence whatever we didn't write to, before and after the part the stream is scheduled to play in.
+                if (offset_bytes > 0) {
+                    SDL_memset(device_buffer, device->silence_value, offset_bytes);
+                }
+                if ((offset_bytes + br) < buffer_size) {
+                    SDL_memset(device_buffer + offset_bytes + br, device->silence_value, buffer_size - (offset_bytes + br));
+                }
+            }
+
+            if (request_bytes) {
+                num_streams = 1;
+                if (br > 0) {
+                    device->stats.bytes_converted += br;
+                }
+                if ((br >= 0) && (br < request_bytes)) {
+                    RecordAudioStreamUnderrun(device, stream);
+                }
             }
         } else {  // need to actually mix (or silence the buffer)
             float *final_mix_buffer = (float *) ((device->spec.format == SDL_AUDIO_F32) ? device_buffer : device->mix_buffer);
@@ -1082,8 +1597,21 @@ SDL_bool SDL_OutputAudioThreadIterate(SDL_AudioDevice *device)
 
             SDL_memset(final_mix_buffer, '\0', work_buffer_size);  // start with silence.
 
-            for (SDL_LogicalAudioDevice *logdev = device->logical_devices; logdev; logdev = logdev->next) {
-                if (SDL_AtomicGet(&logdev->paused)) {
+            // If we have a worker pool, pull data from all the streams up front, in parallel, then mix it below.
+            const int needed_frames = needed_samples / device->spec.channels;
+            SDL_AudioMixPool *pool = device->mix_pool;
+            const SDL_bool parallel = pool && PrepareAudioMixJobs(device, needed_frames);
+            if (parallel) {
+                RunAudioMixPool(pool);
+            }
+
+            int logdev_index = 0;
+
+            for (SDL_LogicalAudioDevice *logdev = device->logical_devices; logdev; logdev = logdev->next, logdev_index++) {
+                // use the same paused state the jobs were set up with, or we might throw away data we already pulled from a stream.
+                int job_index = parallel ? pool->logdev_jobs[logdev_index] : 0;
+                const SDL_bool paused = parallel ? (job_index < 0) : (SDL_AtomicGet(&logdev->paused) != 0);
+                if (paused) {
                     continue;  // paused? Skip this logical device.
                 }
 
@@ -1102,12 +1630,38 @@ SDL_bool SDL_OutputAudioThreadIterate(SDL_AudioDevice *device)
                        for iterating here because the binding linked list can only change while the device lock is held.
                        (we _do_ lock the stream during binding/unbinding to make sure that two threads can't try to bind
                        the same stream to different devices at the same time, though.) */
-                    const int br = SDL_GetAudioStreamData(stream, device->work_buffer, work_buffer_size);
+                    const Uint8 *stream_buffer = device->work_buffer;
+                    int frame_offset = 0;
+                    int request_bytes = 0;
+                    int br = 0;
+                    if (parallel) {
+                        const SDL_AudioMixJob *job = &pool->jobs[job_index++];
+                        stream_buffer = job->buffer;
+                        frame_offset = job->frame_offset;
+                        request_bytes = job->request_bytes;
+                        br = job->result;
+                    } else {
+                        request_bytes = GetAudioStreamPlayWindow(stream, device->position, needed_frames, &frame_offset) * (int) sizeof (float) * outspec.channels;
+                        br = request_bytes ? SDL_GetAudioStreamData(stream, device->work_buffer, request_bytes) : 0;
+                    }
+
+                    if (!request_bytes) {
+                        continue;  // not scheduled to play during this buffer.
+                    }
+
+                    num_streams++;
                     if (br < 0) {  // Probably OOM. Kill the audio device; the whole thing is likely dying soon anyhow.
                         failed = SDL_TRUE;
                         break;
-                    } else if (br > 0) {  // it's okay if we get less than requested, we mix what we have.
-                        MixFloat32Audio(mix_buffer, (float *) device->work_buffer, br);
+                    }
+
+                    if (br < request_bytes) {
+                        RecordAudioStreamUnderrun(device, stream);
+                    }
+
+                    if (br > 0) {  // it's okay if we get less than requested, we mix what we have.
+                        device->stats.bytes_converted += br;
+                        MixAudioStreamFloat32(device, stream, mix_buffer + (frame_offset * outspec.channels), (const float *) stream_buffer, br);
                     }
                 }
 
@@ -1121,7 +1675,7 @@ SDL_bool SDL_OutputAudioThreadIterate(SDL_AudioDevice *device)
             if (((Uint8 *) final_mix_buffer) != device_buffer) {
                 // !!! FIXME: we can't promise the device buf is aligned/padded for SIMD.
                 //ConvertAudio(needed_samples * device->spec.channels, final_mix_buffer, SDL_AUDIO_F32, device->spec.channels, device_buffer, device->spec.format, device->spec.channels, device->work_buffer);
-                ConvertAudio(needed_samples / device->spec.channels, final_mix_buffer, SDL_AUDIO_F32, device->spec.channels, device->work_buffer, device->spec.format, device->spec.channels, NULL);
+                ConvertAudio(needed_samples / device->spec.channels, final_mix_buffer, SDL_AUDIO_F32, device->spec.channels, device->work_buffer, device->spec.format, device->spec.channels, NULL, NULL);
                 SDL_memcpy(device_buffer, device->work_buffer, buffer_size);
             }
         }
@@ -1130,6 +1684,13 @@ SDL_bool SDL_OutputAudioThreadIterate(SDL_AudioDevice *device)
         if (device->PlayDevice(device, device_buffer, buffer_size) < 0) {
             failed = SDL_TRUE;
         }
+
+        device->position += (Uint64) (buffer_size / SDL_AUDIO_FRAMESIZE(device->spec));
+    }
+
+    const Uint64 cycle_ns = EndAudioThreadIterateStats(device, start_ns, num_streams, (device_buffer && !failed) ? buffer_size : 0);
+    if (!failed) {
+        AdaptAudioDeviceSampleFrames(device, cycle_ns);
     }
 
     SDL_UnlockMutex(device->lock);
@@ -1191,6 +1752,9 @@ SDL_bool SDL_CaptureAudioThreadIterate(SDL_AudioDevice *device)
         return SDL_FALSE;  // we're done, shut it down.
     }
 
+    const Uint64 start_ns = BeginAudioThreadIterateStats(device);
+    int num_streams = 0;
+    int captured_bytes = 0;
     SDL_bool failed = SDL_FALSE;
 
     if (!device->logical_devices) {
@@ -1201,6 +1765,7 @@ SDL_bool SDL_CaptureAudioThreadIterate(SDL_AudioDevice *device)
         if (br < 0) {  // uhoh, device failed for some reason!
             failed = SDL_TRUE;
         } else if (br > 0) {  // queue the new data to each bound stream.
+            captured_bytes = br;
             for (SDL_LogicalAudioDevice *logdev = device->logical_devices; logdev; logdev = logdev->next) {
                 if (SDL_AtomicGet(&logdev->paused)) {
                     continue;  // paused? Skip this logical device.
@@ -1218,7 +1783,7 @@ SDL_bool SDL_CaptureAudioThreadIterate(SDL_AudioDevice *device)
                     output_buffer = device->postmix_buffer;
                     const int frames = br / SDL_AUDIO_FRAMESIZE(device->spec);
                     br = frames * SDL_AUDIO_FRAMESIZE(outspec);
-                    ConvertAudio(frames, device->work_buffer, device->spec.format, outspec.channels, device->postmix_buffer, SDL_AUDIO_F32, outspec.channels, NULL);
+                    ConvertAudio(frames, device->work_buffer, device->spec.format, outspec.channels, device->postmix_buffer, SDL_AUDIO_F32, outspec.channels, NULL, NULL);
                     logdev->postmix(logdev->postmix_userdata, &outspec, device->postmix_buffer, br);
                 }
 
@@ -1232,16 +1797,20 @@ SDL_bool SDL_CaptureAudioThreadIterate(SDL_AudioDevice *device)
                        for iterating here because the binding linked list can only change while the device lock is held.
                        (we _do_ lock the stream during binding/unbinding to make sure that two threads can't try to bind
                        the same stream to different devices at the same time, though.) */
+                    num_streams++;
                     if (SDL_PutAudioStreamData(stream, output_buffer, br) < 0) {
                         // oh crud, we probably ran out of memory. This is possibly an overreaction to kill the audio device, but it's likely the whole thing is going down in a moment anyhow.
                         failed = SDL_TRUE;
                         break;
                     }
+                    device->stats.bytes_converted += br;
                 }
             }
         }
     }
 
+    EndAudioThreadIterateStats(device, start_ns, num_streams, captured_bytes);
+
     SDL_UnlockMutex(device->lock);
 
     if (failed) {
@@ -1408,6 +1977,76 @@ int SDL_GetAudioDeviceFormat(SDL_AudioDeviceID devid, SDL_AudioSpec *spec, int *
     return retval;
 }
 
+static void SetAudioTimingProperties(SDL_PropertiesID props, const SDL_AudioTimingStats *stats, const char *min_name, const char *avg_name, const char *max_name, const char *histogram_prefix)
+{
+    SDL_SetNumberProperty(props, min_name, (Sint64) stats->min_ns);
+    SDL_SetNumberProperty(props, avg_name, stats->count ? (Sint64) (stats->total_ns / stats->count) : 0);
+    SDL_SetNumberProperty(props, max_name, (Sint64) stats->max_ns);
+
+    for (int i = 0; i < SDL_AUDIO_STATS_HISTOGRAM_BUCKETS; i++) {
+        char name[128];
+        SDL_snprintf(name, sizeof (name), "%s%d", histogram_prefix, i);
+        SDL_SetNumberProperty(props, name, (Sint64) stats->histogram[i]);
+    }
+}
+
+SDL_PropertiesID SDL_GetAudioDeviceProperties(SDL_AudioDeviceID devid)
+{
+    SDL_PropertiesID props = 0;
+    SDL_AudioDevice *device = ObtainPhysicalAudioDeviceDefaultAllowed(devid);
+    if (device) {
+        if (device->props == 0) {
+            device->props = SDL_CreateProperties();
+        }
+
+        props = device->props;
+        if (props) {
+            const SDL_AudioDeviceStats *stats = &device->stats;
+            const Uint64 iterations = stats->iterate_time.count;
+            SDL_SetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_STATS_ITERATIONS_NUMBER, (Sint64) iterations);
+            SDL_SetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_STATS_STREAMS_MIN_NUMBER, stats->min_streams);
+            SDL_SetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_STATS_STREAMS_AVG_NUMBER, iterations ? (Sint64) (stats->total_streams / iterations) : 0);
+            SDL_SetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_STATS_STREAMS_MAX_NUMBER, stats->max_streams);
+            SDL_SetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_STATS_BYTES_CONVERTED_NUMBER, (Sint64) stats->bytes_converted);
+            SDL_SetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_STATS_UNDERRUNS_NUMBER, (Sint64) stats->underruns);
+            SDL_SetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_STATS_OVERRUNS_NUMBER, (Sint64) stats->overruns);
+            SDL_SetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_STATS_BUFFER_RESIZES_NUMBER, (Sint64) stats->buffer_resizes);
+            SDL_SetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_STATS_FRAMES_NUMBER, (Sint64) stats->frames);
+            const Uint64 busy_ns = stats->iterate_time.total_ns + stats->wait_time.total_ns;
+            SDL_SetFloatProperty(props, SDL_PROP_AUDIO_DEVICE_STATS_REALTIME_RATIO_FLOAT, busy_ns ? (float) ((double) stats->audio_ns / (double) busy_ns) : 0.0f);
+            SetAudioTimingProperties(props, &stats->iterate_time,
+                                     SDL_PROP_AUDIO_DEVICE_STATS_ITERATE_TIME_MIN_NUMBER,
+                                     SDL_PROP_AUDIO_DEVICE_STATS_ITERATE_TIME_AVG_NUMBER,
+                                     SDL_PROP_AUDIO_DEVICE_STATS_ITERATE_TIME_MAX_NUMBER,
+                                     SDL_PROP_AUDIO_DEVICE_STATS_ITERATE_TIME_HISTOGRAM_PREFIX);
+            SetAudioTimingProperties(props, &stats->wait_time,
+                                     SDL_PROP_AUDIO_DEVICE_STATS_WAIT_TIME_MIN_NUMBER,
+                                     SDL_PROP_AUDIO_DEVICE_STATS_WAIT_TIME_AVG_NUMBER,
+                                     SDL_PROP_AUDIO_DEVICE_STATS_WAIT_TIME_MAX_NUMBER,
+                                     SDL_PROP_AUDIO_DEVICE_STATS_WAIT_TIME_HISTOGRAM_PREFIX);
+        }
+    }
+    ReleaseAudioDevice(device);
+
+    return props;
+}
+
+Sint64 SDL_GetAudioDevicePosition(SDL_AudioDeviceID devid)
+{
+    Sint64 retval = -1;
+    SDL_AudioDevice *device = ObtainPhysicalAudioDeviceDefaultAllowed(devid);
+    if (device) {
+        if (device->iscapture) {
+            SDL_SetError("Only output devices have a position");
+        } else {
+            retval = (Sint64) device->position;
+        }
+    }
+    ReleaseAudioDevice(device);
+
+    return retval;
+}
+
 // this is awkward, but this makes sure we can release the device lock
 //  so the device thread can terminate but also not have two things
 //  race to close or open the device while the lock is unprotected.
@@ -1436,6 +2075,9 @@ static void ClosePhysicalAudioDevice(SDL_AudioDevice *device)
         device->thread = NULL;
     }
 
+    DestroyAudioMixPool(device->mix_pool);  // this is safe now that the device thread isn't using it.
+    device->mix_pool = NULL;
+
     if (device->currently_opened) {
         current_audio.impl.CloseDevice(device);  // if ProvidesOwnCallbackThread, this must join on any existing device thread before returning!
         device->currently_opened = SDL_FALSE;
@@ -1458,6 +2100,9 @@ static void ClosePhysicalAudioDevice(SDL_AudioDevice *device)
     SDL_copyp(&device->spec, &device->default_spec);
     device->sample_frames = 0;
     device->silence_value = SDL_GetSilenceValueForFormat(device->spec.format);
+    device->stats.last_iterate_end_ns = 0;  // don't count the time the device was closed as time spent waiting.
+    device->position = 0;
+    SDL_zero(device->adaptation);
 }
 
 void SDL_CloseAudioDevice(SDL_AudioDeviceID devid)
@@ -1588,6 +2233,7 @@ static int OpenPhysicalAudioDevice(SDL_AudioDevice *device, const SDL_AudioSpec
     }
 
     SDL_UpdatedAudioDeviceFormat(device);  // in case the backend changed things and forgot to call this.
+    InitAudioDeviceAdaptation(device);
 
     // Allocate a scratch audio buffer
     device->work_buffer = (Uint8 *)SDL_aligned_alloc(SDL_SIMDGetAlignment(), device->work_buffer_size);
@@ -1604,6 +2250,13 @@ static int OpenPhysicalAudioDevice(SDL_AudioDevice *device, const SDL_AudioSpec
         }
     }
 
+    if (!device->iscapture) {
+        const int mix_threads = GetAudioMixThreadsFromHint();
+        if (mix_threads > 0) {
+            device->mix_pool = CreateAudioMixPool(device, mix_threads);  // if this fails, we just mix everything on the device thread.
+        }
+    }
+
     // Start the audio thread if necessary
     if (!current_audio.impl.ProvidesOwnCallbackThread) {
         const size_t stacksize = 0;  // just take the system default, since audio streams might have callbacks.
@@ -1736,7 +2389,10 @@ int SDL_SetAudioPostmixCallback(SDL_AudioDeviceID devid, SDL_AudioPostmixCallbac
                     // set the proper end of the stream to the device's format.
                     // SDL_SetAudioStreamFormat does a ton of validation just to memcpy an audiospec.
                     SDL_LockMutex(stream->lock);
-                    stream->src_spec.format = callback ? SDL_AUDIO_F32 : device->spec.format;
+                    SDL_AudioSpec spec;
+                    SDL_copyp(&spec, &stream->src_spec);
+                    spec.format = callback ? SDL_AUDIO_F32 : device->spec.format;
+                    SetAudioStreamSourceSpec(stream, &spec);
                     SDL_UnlockMutex(stream->lock);
                 }
             }
@@ -1825,10 +2481,15 @@ int SDL_BindAudioStreams(SDL_AudioDeviceID devid, SDL_AudioStream **streams, int
             logdev->bound_streams = stream;
 
             if (iscapture) {
-                SDL_copyp(&stream->src_spec, &device->spec);
+                SDL_AudioSpec spec;
+                SDL_copyp(&spec, &device->spec);
                 if (logdev->postmix) {
-                    stream->src_spec.format = SDL_AUDIO_F32;
+                    spec.format = SDL_AUDIO_F32;
                 }
+                SetAudioStreamSourceSpec(stream, &spec);
+            } else {
+                // start from the stream's own gains, not whatever it was last mixed with on another device.
+                GetAudioStreamMixGains(stream, device->spec.channels, stream->mix_gains);
             }
 
             SDL_UnlockMutex(stream->lock);
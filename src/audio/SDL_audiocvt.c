@@ -24,6 +24,7 @@
 
 #include "SDL_audioqueue.h"
 #include "SDL_audioresample.h"
+#include "../thread/SDL_systhread.h"
 
 #ifndef SDL_INT_MAX
 #define SDL_INT_MAX ((int)(~0u>>1))
@@ -135,26 +136,13 @@ static void SDL_TARGETING("sse") SDL_ConvertMonoToStereo_SSE(float *dst, const f
 
 static void AudioConvertByteswap(void *dst, const void *src, int num_samples, int bitsize)
 {
-#if DEBUG_AUDIO_CONVERT
-    SDL_Log("SDL_AUDIO_CONVERT: Converting %d-bit byte order", bitsize);
-#endif
-
     switch (bitsize) {
-#define CASESWAP(b) \
-    case b: { \
-        const Uint##b *tsrc = (const Uint##b *)src; \
-        Uint##b *tdst = (Uint##b *)dst; \
-        for (int i = 0; i < num_samples; i++) { \
-            tdst[i] = SDL_Swap##b(tsrc[i]); \
-        } \
-        break; \
-    }
-
-        CASESWAP(16);
-        CASESWAP(32);
-
-#undef CASESWAP
-
+    case 16:
+        SDL_Convert_Swap16((Uint16 *)dst, (const Uint16 *)src, num_samples);
+        break;
+    case 32:
+        SDL_Convert_Swap32((Uint32 *)dst, (const Uint32 *)src, num_samples);
+        break;
     default:
         SDL_assert(!"unhandled byteswap datatype!");
         break;
@@ -219,7 +207,7 @@ static SDL_bool SDL_IsSupportedChannelCount(const int channels)
 // The scratch buffer must be able to store `num_frames * CalculateMaxSampleFrameSize(src_format, src_channels, dst_format, dst_channels)` bytes.
 // If the scratch buffer is NULL, this restriction applies to the output buffer instead.
 void ConvertAudio(int num_frames, const void *src, SDL_AudioFormat src_format, int src_channels,
-                  void *dst, SDL_AudioFormat dst_format, int dst_channels, void* scratch)
+                  void *dst, SDL_AudioFormat dst_format, int dst_channels, void* scratch, const float *channel_matrix)
 {
     SDL_assert(src != NULL);
     SDL_assert(dst != NULL);
@@ -256,7 +244,7 @@ void ConvertAudio(int num_frames, const void *src, SDL_AudioFormat src_format, i
        it was a bloat on SDL compile times and final library size. */
 
     // see if we can skip float conversion entirely.
-    if (src_channels == dst_channels) {
+    if ((src_channels == dst_channels) && !channel_matrix) {
         if (src_format == dst_format) {
             // nothing to do, we're already in the right format, just copy it over if necessary.
             if (src != dst) {
@@ -284,7 +272,7 @@ void ConvertAudio(int num_frames, const void *src, SDL_AudioFormat src_format, i
 
     const SDL_bool srcbyteswap = (SDL_AUDIO_ISBIGENDIAN(src_format) != 0) == (SDL_BYTEORDER == SDL_LIL_ENDIAN) && (src_bitsize > 8);
     const SDL_bool srcconvert = !SDL_AUDIO_ISFLOAT(src_format);
-    const SDL_bool channelconvert = src_channels != dst_channels;
+    const SDL_bool channelconvert = (src_channels != dst_channels) || (channel_matrix != NULL);
     const SDL_bool dstconvert = !SDL_AUDIO_ISFLOAT(dst_format);
     const SDL_bool dstbyteswap = (SDL_AUDIO_ISBIGENDIAN(dst_format) != 0) == (SDL_BYTEORDER == SDL_LIL_ENDIAN) && (dst_bitsize > 8);
 
@@ -304,7 +292,11 @@ void ConvertAudio(int num_frames, const void *src, SDL_AudioFormat src_format, i
 
     // Channel conversion
 
-    if (channelconvert) {
+    if (channelconvert && channel_matrix) {
+        void* buf = (dstconvert || dstbyteswap) ? scratch : dst;
+        SDL_Remix_F32((float *) buf, (const float *) src, num_frames, src_channels, dst_channels, channel_matrix);
+        src = buf;
+    } else if (channelconvert) {
         SDL_AudioChannelConverter channel_converter;
         SDL_AudioChannelConverter override = NULL;
 
@@ -402,20 +394,52 @@ static int UpdateAudioStreamInputSpec(SDL_AudioStream *stream, const SDL_AudioSp
     return 0;
 }
 
-SDL_AudioStream *SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_AudioSpec *dst_spec)
+static SDL_AudioStream *CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_AudioSpec *dst_spec, Sint64 ring_size)
 {
     SDL_ChooseAudioConverters();
+    SDL_ChooseAudioMixers();
     SDL_SetupAudioResampler();
 
+    Uint32 ring_allocation = 0;
+    if (ring_size > 0) {
+        const Sint64 max_ring_size = 0x40000000;  // keep head and tail distances well inside an int.
+        if (ring_size > max_ring_size) {
+            SDL_InvalidParamError("SDL_PROP_AUDIOSTREAM_CREATE_SPSC_BUFFER_SIZE_NUMBER");
+            return NULL;
+        }
+        ring_allocation = 1;
+        while (ring_allocation < (Uint32) ring_size) {
+            ring_allocation <<= 1;
+        }
+    }
+
     SDL_AudioStream *retval = (SDL_AudioStream *)SDL_calloc(1, sizeof(SDL_AudioStream));
     if (!retval) {
         return NULL;
     }
 
+    if (ring_allocation) {
+        retval->ring = (Uint8 *) SDL_malloc(ring_allocation);
+        if (!retval->ring) {
+            SDL_free(retval);
+            return NULL;
+        }
+        retval->ring_size = ring_allocation;
+    }
+
     retval->freq_ratio = 1.0f;
+    retval->gain = 1.0f;
+    retval->start_frame = -1;
+    retval->stop_frame = -1;
+    for (int i = 0; i < (int)SDL_arraysize(retval->mix_gains); i++) {
+        retval->mix_gains[i] = 1.0f;
+    }
+    retval->resample_quality = SDL_AUDIO_RESAMPLE_QUALITY_HIGH;
+    retval->max_pooled_bytes = SDL_AUDIO_QUEUE_DEFAULT_MAX_POOLED_BYTES;
     retval->queue = SDL_CreateAudioQueue(4096);
 
     if (!retval->queue) {
+        SDL_free(retval->ring);
         SDL_free(retval);
         return NULL;
     }
@@ -423,6 +447,7 @@ SDL_AudioStream *SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_
     retval->lock = SDL_CreateMutex();
     if (!retval->lock) {
         SDL_free(retval->queue);
+        SDL_free(retval->ring);
         SDL_free(retval);
         return NULL;
     }
@@ -437,16 +462,57 @@ SDL_AudioStream *SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_
     return retval;
 }
 
+SDL_AudioStream *SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_AudioSpec *dst_spec)
+{
+    return CreateAudioStream(src_spec, dst_spec, 0);
+}
+
+SDL_AudioStream *SDL_CreateAudioStreamWithProperties(SDL_PropertiesID props)
+{
+    const SDL_AudioSpec *src_spec = (const SDL_AudioSpec *) SDL_GetProperty(props, SDL_PROP_AUDIOSTREAM_CREATE_SRC_SPEC_POINTER, NULL);
+    const SDL_AudioSpec *dst_spec = (const SDL_AudioSpec *) SDL_GetProperty(props, SDL_PROP_AUDIOSTREAM_CREATE_DST_SPEC_POINTER, NULL);
+    Sint64 ring_size = 0;
+
+    if (SDL_GetBooleanProperty(props, SDL_PROP_AUDIOSTREAM_CREATE_SPSC_BOOLEAN, SDL_FALSE)) {
+        ring_size = SDL_GetNumberProperty(props, SDL_PROP_AUDIOSTREAM_CREATE_SPSC_BUFFER_SIZE_NUMBER, 256 * 1024);
+        if (ring_size <= 0) {
+            SDL_InvalidParamError("SDL_PROP_AUDIOSTREAM_CREATE_SPSC_BUFFER_SIZE_NUMBER");
+            return NULL;
+        }
+    }
+
+    return CreateAudioStream(src_spec, dst_spec, ring_size);
+}
+
 SDL_PropertiesID SDL_GetAudioStreamProperties(SDL_AudioStream *stream)
 {
     if (!stream) {
         SDL_InvalidParamError("stream");
         return 0;
     }
+
+    SDL_LockMutex(stream->lock);
+
     if (stream->props == 0) {
         stream->props = SDL_CreateProperties();
     }
-    return stream->props;
+
+    const SDL_PropertiesID props = stream->props;
+    if (props) {
+        SDL_AudioQueuePoolStats stats;
+        SDL_GetAudioQueuePoolStats(stream->queue, &stats);
+        SDL_SetNumberProperty(props, SDL_PROP_AUDIOSTREAM_CHUNK_POOL_ALLOCATIONS_NUMBER, (Sint64) stats.allocations);
+        SDL_SetNumberProperty(props, SDL_PROP_AUDIOSTREAM_CHUNK_POOL_REUSES_NUMBER, (Sint64) stats.reuses);
+        SDL_SetNumberProperty(props, SDL_PROP_AUDIOSTREAM_CHUNK_POOL_FREES_NUMBER, (Sint64) stats.frees);
+        SDL_SetNumberProperty(props, SDL_PROP_AUDIOSTREAM_CHUNK_POOL_POOLED_BYTES_NUMBER, (Sint64) stats.pooled_bytes);
+        SDL_SetNumberProperty(props, SDL_PROP_AUDIOSTREAM_STATS_BYTES_CONVERTED_NUMBER, (Sint64) stream->total_bytes_converted);
+        SDL_SetNumberProperty(props, SDL_PROP_AUDIOSTREAM_STATS_UNDERRUNS_NUMBER, SDL_AtomicGet(&stream->underruns));
+        SDL_SetNumberProperty(props, SDL_PROP_AUDIOSTREAM_STATS_LOOKAHEAD_BYTES_NUMBER, (Sint64) stream->lookahead_bytes);
+    }
+
+    SDL_UnlockMutex(stream->lock);
+
+    return props;
 }
 
 int SDL_SetAudioStreamGetCallback(SDL_AudioStream *stream, SDL_AudioStreamCallback callback, void *userdata)
@@ -491,6 +557,129 @@ int SDL_UnlockAudioStream(SDL_AudioStream *stream)
     return 0;
 }
 
+static int GetAudioStreamAvailableBytes(SDL_AudioStream *stream);
+static int SDLCALL AudioStreamLookaheadThread(void *data);
+
+// Let the look-ahead worker know there might be more for it to do. You must hold stream->lock!
+static void WakeAudioStreamLookahead(SDL_AudioStream *stream)
+{
+    if (stream->lookahead_cond) {
+        SDL_SignalCondition(stream->lookahead_cond);
+    }
+}
+
+// If this fails, the stream just converts everything when it's read, like it would without look-ahead. You must hold stream->lock!
+static void StartAudioStreamLookahead(SDL_AudioStream *stream)
+{
+    stream->lookahead_cond = SDL_CreateCondition();
+    if (stream->lookahead_cond) {
+        const size_t stacksize = 0;  // just take the system default, the worker might drain an SPSC ring and run the put callback.
+        stream->lookahead_thread = SDL_CreateThreadInternal(AudioStreamLookaheadThread, "SDLAudioLookahead", stacksize, stream);
+        if (!stream->lookahead_thread) {
+            SDL_DestroyCondition(stream->lookahead_cond);
+            stream->lookahead_cond = NULL;
+        }
+    }
+}
+
+static void StopAudioStreamLookahead(SDL_AudioStream *stream)
+{
+    if (stream->lookahead_thread) {
+        SDL_LockMutex(stream->lock);
+        stream->lookahead_quit = SDL_TRUE;
+        WakeAudioStreamLookahead(stream);
+        SDL_UnlockMutex(stream->lock);
+
+        SDL_WaitThread(stream->lookahead_thread, NULL);
+        stream->lookahead_thread = NULL;
+    }
+
+    // anything still able to reach the stream checks lookahead_cond under the lock.
+    SDL_LockMutex(stream->lock);
+    SDL_DestroyCondition(stream->lookahead_cond);
+    stream->lookahead_cond = NULL;
+    SDL_UnlockMutex(stream->lock);
+}
+
+// Move whatever the producer put in an SPSC stream's ring over to the queue. You must hold stream->lock!
+static int DrainAudioStreamRing(SDL_AudioStream *stream)
+{
+    if (!stream->ring) {
+        return 0;
+    }
+
+    const Uint32 tail = (Uint32) SDL_AtomicGet(&stream->ring_tail);
+    const Uint32 head = (Uint32) SDL_AtomicGet(&stream->ring_head);  // everything up to here has been written.
+    const Uint32 len = head - tail;
+    if (len == 0) {
+        return 0;
+    }
+
+    const int prev_available = stream->put_callback ? GetAudioStreamAvailableBytes(stream) : 0;
+    const Uint32 offset = tail & (stream->ring_size - 1);
+    const Uint32 first = SDL_min(len, stream->ring_size - offset);
+    int retval = SDL_WriteToAudioQueue(stream->queue, &stream->src_spec, stream->ring + offset, first);
+    if ((retval == 0) && (first < len)) {
+        retval = SDL_WriteToAudioQueue(stream->queue, &stream->src_spec, stream->ring, len - first);
+    }
+
+    // Even if the queue ran out of memory, let the producer have the space back; the data is lost either way.
+    SDL_AtomicSet(&stream->ring_tail, (int) head);
+
+    if (retval == 0) {
+        stream->total_bytes_queued += len;
+        WakeAudioStreamLookahead(stream);
+        if (stream->put_callback) {  // the producer didn't take the lock, so the callback runs from whoever moved the data.
+            const int newavail = GetAudioStreamAvailableBytes(stream) - prev_available;
+            stream->put_callback(stream->put_callback_userdata, stream, newavail, newavail);
+        }
+    }
+
+    return retval;
+}
+
+void SetAudioStreamSourceSpec(SDL_AudioStream *stream, const SDL_AudioSpec *spec)
+{
+    DrainAudioStreamRing(stream);  // anything already put in the ring was in the old format.
+    SDL_copyp(&stream->src_spec, spec);
+    SDL_AtomicSet(&stream->ring_frame_size, SDL_AUDIO_FRAMESIZE(*spec));
+}
+
+void SetAudioStreamDestSpec(SDL_AudioStream *stream, const SDL_AudioSpec *spec)
+{
+    SDL_copyp(&stream->dst_spec, spec);
+
+    if (!stream->lookahead_bytes || AUDIO_SPECS_EQUAL(stream->lookahead_spec, *spec)) {
+        return;
+    }
+
+    // Data converted ahead of time is in the old output format; bring it over to the new one.
+    // There's no resampler state for it, so if the rate changed it gets dropped. Devices only change rates when they restart, which glitches anyway.
+    Uint8 *converted = NULL;
+    const SDL_AudioSpec *old = &stream->lookahead_spec;
+    if (old->freq == spec->freq) {
+        const int num_frames = (int) (stream->lookahead_bytes / SDL_AUDIO_FRAMESIZE(*old));
+        const size_t allocation = (size_t) num_frames * sizeof (float) * SDL_max(old->channels, spec->channels);  // ConvertAudio works in place, in float32.
+        converted = (Uint8 *) SDL_malloc(SDL_max(allocation, stream->lookahead_watermark));
+        if (converted) {
+            ConvertAudio(num_frames, stream->lookahead + stream->lookahead_offset, old->format, old->channels,
+                         converted, spec->format, spec->channels, NULL, NULL);
+            SDL_free(stream->lookahead);
+            stream->lookahead = converted;
+            stream->lookahead_allocation = SDL_max(allocation, stream->lookahead_watermark);
+            stream->lookahead_offset = 0;
+            stream->lookahead_bytes = (size_t) num_frames * SDL_AUDIO_FRAMESIZE(*spec);
+        }
+    }
+
+    if (!converted) {
+        stream->lookahead_offset = 0;
+        stream->lookahead_bytes = 0;
+    }
+
+    SDL_copyp(&stream->lookahead_spec, spec);
+}
+
 int SDL_GetAudioStreamFormat(SDL_AudioStream *stream, SDL_AudioSpec *src_spec, SDL_AudioSpec *dst_spec)
 {
     if (!stream) {
@@ -565,11 +754,11 @@ int SDL_SetAudioStreamFormat(SDL_AudioStream *stream, const SDL_AudioSpec *src_s
     }
 
     if (src_spec) {
-        SDL_copyp(&stream->src_spec, src_spec);
+        SetAudioStreamSourceSpec(stream, src_spec);
     }
 
     if (dst_spec) {
-        SDL_copyp(&stream->dst_spec, dst_spec);
+        SetAudioStreamDestSpec(stream, dst_spec);
     }
 
     SDL_UnlockMutex(stream->lock);
@@ -614,6 +803,162 @@ int SDL_SetAudioStreamFrequencyRatio(SDL_AudioStream *stream, float freq_ratio)
     return 0;
 }
 
+float SDL_GetAudioStreamGain(SDL_AudioStream *stream)
+{
+    if (!stream) {
+        SDL_InvalidParamError("stream");
+        return -1.0f;
+    }
+
+    SDL_LockMutex(stream->lock);
+    const float gain = stream->gain;
+    SDL_UnlockMutex(stream->lock);
+
+    return gain;
+}
+
+int SDL_SetAudioStreamGain(SDL_AudioStream *stream, float gain)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (!(gain >= 0.0f)) {  // this catches NaNs, too.
+        return SDL_InvalidParamError("gain");
+    }
+
+    SDL_LockMutex(stream->lock);
+    stream->gain = gain;
+    SDL_UnlockMutex(stream->lock);
+
+    return 0;
+}
+
+float SDL_GetAudioStreamPan(SDL_AudioStream *stream)
+{
+    if (!stream) {
+        SDL_InvalidParamError("stream");
+        return 0.0f;
+    }
+
+    SDL_LockMutex(stream->lock);
+    const float pan = stream->pan;
+    SDL_UnlockMutex(stream->lock);
+
+    return pan;
+}
+
+int SDL_SetAudioStreamPan(SDL_AudioStream *stream, float pan)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (!((pan >= -1.0f) && (pan <= 1.0f))) {  // this catches NaNs, too.
+        return SDL_InvalidParamError("pan");
+    }
+
+    SDL_LockMutex(stream->lock);
+    stream->pan = pan;
+    SDL_UnlockMutex(stream->lock);
+
+    return 0;
+}
+
+int SDL_SetAudioStreamChannelMatrix(SDL_AudioStream *stream, int src_channels, int dst_channels, const float *matrix)
+{
+    float *channel_matrix = NULL;
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (matrix && !SDL_IsSupportedChannelCount(src_channels)) {
+        return SDL_InvalidParamError("src_channels");
+    } else if (matrix && !SDL_IsSupportedChannelCount(dst_channels)) {
+        return SDL_InvalidParamError("dst_channels");
+    }
+
+    if (matrix) {
+        const size_t matrix_size = src_channels * dst_channels * sizeof (float);
+        channel_matrix = (float *) SDL_malloc(matrix_size);
+        if (!channel_matrix) {
+            return -1;
+        }
+        SDL_memcpy(channel_matrix, matrix, matrix_size);
+    }
+
+    SDL_LockMutex(stream->lock);
+    SDL_free(stream->channel_matrix);
+    stream->channel_matrix = channel_matrix;
+    stream->channel_matrix_src_channels = channel_matrix ? src_channels : 0;
+    stream->channel_matrix_dst_channels = channel_matrix ? dst_channels : 0;
+    SDL_UnlockMutex(stream->lock);
+
+    return 0;
+}
+
+int SDL_SetAudioStreamSchedule(SDL_AudioStream *stream, Sint64 start_frame, Sint64 stop_frame)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (start_frame < -1) {
+        return SDL_InvalidParamError("start_frame");
+    } else if ((stop_frame < -1) || ((stop_frame >= 0) && (stop_frame < start_frame))) {
+        return SDL_InvalidParamError("stop_frame");
+    }
+
+    SDL_LockMutex(stream->lock);
+    stream->start_frame = start_frame;
+    stream->stop_frame = stop_frame;
+    SDL_UnlockMutex(stream->lock);
+
+    return 0;
+}
+
+// The custom remix matrix for converting `src_channels` to the stream's output, or NULL to use the default one.
+// You must hold stream->lock before calling this!
+static const float *GetAudioStreamChannelMatrix(SDL_AudioStream *stream, int src_channels)
+{
+    if (stream->channel_matrix && (stream->channel_matrix_src_channels == src_channels) &&
+        (stream->channel_matrix_dst_channels == stream->dst_spec.channels)) {
+        return stream->channel_matrix;
+    }
+    return NULL;
+}
+
+// Latch the settings apps can change through the stream's properties.
+// The resampler quality can't change halfway through a read, or the padding frames won't add up.
+// You must hold stream->lock before calling this!
+static void UpdateAudioStreamProperties(SDL_AudioStream *stream)
+{
+    Sint64 quality = SDL_AUDIO_RESAMPLE_QUALITY_HIGH;
+    Sint64 max_pooled_bytes = SDL_AUDIO_QUEUE_DEFAULT_MAX_POOLED_BYTES;
+    Sint64 lookahead = 0;
+
+    if (stream->props) {
+        quality = SDL_GetNumberProperty(stream->props, SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER, quality);
+        if ((quality < SDL_AUDIO_RESAMPLE_QUALITY_ZERO_ORDER_HOLD) || (quality > SDL_AUDIO_RESAMPLE_QUALITY_HIGH)) {
+            quality = SDL_AUDIO_RESAMPLE_QUALITY_HIGH;
+        }
+
+        max_pooled_bytes = SDL_GetNumberProperty(stream->props, SDL_PROP_AUDIOSTREAM_CHUNK_POOL_MAX_BYTES_NUMBER, max_pooled_bytes);
+        max_pooled_bytes = SDL_max(max_pooled_bytes, 0);
+
+        lookahead = SDL_GetNumberProperty(stream->props, SDL_PROP_AUDIOSTREAM_LOOKAHEAD_BYTES_NUMBER, lookahead);
+        lookahead = SDL_clamp(lookahead, 0, SDL_INT_MAX);
+    }
+
+    stream->resample_quality = (SDL_AudioResampleQuality) quality;
+
+    if ((size_t) max_pooled_bytes != stream->max_pooled_bytes) {
+        stream->max_pooled_bytes = (size_t) max_pooled_bytes;
+        SDL_SetAudioQueueMaxPooledBytes(stream->queue, stream->max_pooled_bytes);
+    }
+
+    if ((size_t) lookahead != stream->lookahead_watermark) {
+        stream->lookahead_watermark = (size_t) lookahead;
+        if (stream->lookahead_watermark && !stream->lookahead_thread) {
+            StartAudioStreamLookahead(stream);
+        }
+        WakeAudioStreamLookahead(stream);
+    }
+}
+
 static int CheckAudioStreamIsFullySetup(SDL_AudioStream *stream)
 {
     if (stream->src_spec.format == 0) {
@@ -625,26 +970,48 @@ static int CheckAudioStreamIsFullySetup(SDL_AudioStream *stream)
     return 0;
 }
 
-int SDL_PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len)
+// Lock a stream and get it ready to put or get data. If this fails, the stream is unlocked again.
+static int LockAudioStreamForData(SDL_AudioStream *stream)
 {
-#if DEBUG_AUDIOSTREAM
-    SDL_Log("AUDIOSTREAM: wants to put %d bytes", len);
-#endif
+    SDL_LockMutex(stream->lock);
 
-    if (!stream) {
-        return SDL_InvalidParamError("stream");
-    } else if (!buf) {
-        return SDL_InvalidParamError("buf");
-    } else if (len < 0) {
-        return SDL_InvalidParamError("len");
-    } else if (len == 0) {
-        return 0; // nothing to do.
+    UpdateAudioStreamProperties(stream);
+
+    if ((CheckAudioStreamIsFullySetup(stream) != 0) || (DrainAudioStreamRing(stream) != 0)) {
+        SDL_UnlockMutex(stream->lock);
+        return -1;
     }
 
-    SDL_LockMutex(stream->lock);
+    return 0;
+}
 
-    if (CheckAudioStreamIsFullySetup(stream) != 0) {
-        SDL_UnlockMutex(stream->lock);
+// Called by the (only) producer of an SPSC stream, without holding stream->lock. SDL_FALSE if the locked path has to handle it.
+static SDL_bool PutAudioStreamRing(SDL_AudioStream *stream, const Uint8 *buf, int len)
+{
+    const int frame_size = SDL_AtomicGet(&stream->ring_frame_size);
+    const Uint32 head = (Uint32) SDL_AtomicGet(&stream->ring_head);
+    const Uint32 tail = (Uint32) SDL_AtomicGet(&stream->ring_tail);  // the consumer might move this forward while we work, that's fine.
+    const Uint32 ulen = (Uint32) len;
+
+    if ((frame_size == 0) || ((len % frame_size) != 0) || (ulen > (stream->ring_size - (head - tail)))) {
+        return SDL_FALSE;  // not set up, partial frames, or not enough room.
+    }
+
+    const Uint32 offset = head & (stream->ring_size - 1);
+    const Uint32 first = SDL_min(ulen, stream->ring_size - offset);
+    SDL_memcpy(stream->ring + offset, buf, first);
+    SDL_memcpy(stream->ring, buf + first, ulen - first);
+
+    SDL_AtomicSet(&stream->ring_head, (int) (head + ulen));  // publish it to the consumer.
+    return SDL_TRUE;
+}
+
+// If `copy` is SDL_FALSE, the stream reads straight from `buf`, and `callback` fires when it's done with it.
+static int PutAudioStreamBuffer(SDL_AudioStream *stream, const void *buf, int len, SDL_bool copy,
+                                SDL_AudioStreamDataCompleteCallback callback, void *userdata)
+{
+    // anything still in an SPSC stream's ring was put before this, so it has to go in the queue first.
+    if (LockAudioStreamForData(stream) != 0) {
         return -1;
     }
 
@@ -659,14 +1026,18 @@ int SDL_PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len)
     // outside of the stream lock, otherwise the output device is likely to be starved.
     const int large_input_thresh = 1024 * 1024;
 
-    if (len >= large_input_thresh) {
+    if (!copy || (len >= large_input_thresh)) {
         SDL_AudioSpec src_spec;
         SDL_copyp(&src_spec, &stream->src_spec);
 
         SDL_UnlockMutex(stream->lock);
 
-        size_t chunk_size = SDL_GetAudioQueueChunkSize(stream->queue);
-        track = SDL_CreateChunkedAudioTrack(&src_spec, (const Uint8 *)buf, len, chunk_size);
+        if (copy) {
+            size_t chunk_size = SDL_GetAudioQueueChunkSize(stream->queue);
+            track = SDL_CreateChunkedAudioTrack(&src_spec, (const Uint8 *)buf, len, chunk_size);
+        } else {
+            track = SDL_CreateBufferAudioTrack(&src_spec, (const Uint8 *)buf, len, callback, userdata);
+        }
 
         if (!track) {
             return -1;
@@ -675,7 +1046,7 @@ int SDL_PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len)
         SDL_LockMutex(stream->lock);
     }
 
-    const int prev_available = stream->put_callback ? SDL_GetAudioStreamAvailable(stream) : 0;
+    const int prev_available = stream->put_callback ? GetAudioStreamAvailableBytes(stream) : 0;
 
     int retval = 0;
 
@@ -687,8 +1058,9 @@ int SDL_PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len)
 
     if (retval == 0) {
         stream->total_bytes_queued += len;
+        WakeAudioStreamLookahead(stream);
         if (stream->put_callback) {
-            const int newavail = SDL_GetAudioStreamAvailable(stream) - prev_available;
+            const int newavail = GetAudioStreamAvailableBytes(stream) - prev_available;
             stream->put_callback(stream->put_callback_userdata, stream, newavail, newavail);
         }
     }
@@ -698,6 +1070,49 @@ int SDL_PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len)
     return retval;
 }
 
+int SDL_PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len)
+{
+#if DEBUG_AUDIOSTREAM
+    SDL_Log("AUDIOSTREAM: wants to put %d bytes", len);
+#endif
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (!buf) {
+        return SDL_InvalidParamError("buf");
+    } else if (len < 0) {
+        return SDL_InvalidParamError("len");
+    } else if (len == 0) {
+        return 0; // nothing to do.
+    } else if (stream->ring && PutAudioStreamRing(stream, (const Uint8 *) buf, len)) {
+        return 0;  // SPSC stream, and it fit in the ring without taking the lock.
+    }
+
+    return PutAudioStreamBuffer(stream, buf, len, SDL_TRUE, NULL, NULL);
+}
+
+int SDL_PutAudioStreamDataNoCopy(SDL_AudioStream *stream, const void *buf, int len, SDL_AudioStreamDataCompleteCallback callback, void *userdata)
+{
+#if DEBUG_AUDIOSTREAM
+    SDL_Log("AUDIOSTREAM: wants to put %d bytes without copying", len);
+#endif
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (!buf) {
+        return SDL_InvalidParamError("buf");
+    } else if (len < 0) {
+        return SDL_InvalidParamError("len");
+    } else if (len == 0) {
+        if (callback) {
+            callback(userdata, buf, len);  // nothing to do, so we're done with it already.
+        }
+        return 0;
+    }
+
+    return PutAudioStreamBuffer(stream, buf, len, SDL_FALSE, callback, userdata);
+}
+
 int SDL_FlushAudioStream(SDL_AudioStream *stream)
 {
     if (!stream) {
@@ -705,7 +1120,9 @@ int SDL_FlushAudioStream(SDL_AudioStream *stream)
     }
 
     SDL_LockMutex(stream->lock);
+    DrainAudioStreamRing(stream);
     SDL_FlushAudioQueue(stream->queue);
+    WakeAudioStreamLookahead(stream);  // a flushed track can be converted all the way to its end.
     SDL_UnlockMutex(stream->lock);
 
     return 0;
@@ -786,7 +1203,7 @@ static Sint64 NextAudioStreamIter(SDL_AudioStream* stream, void** inout_iter,
         // Past the end of the track, the right padding is filled with silence.
         // But we only want to do that if the track is actually finished (flushed).
         if (!flushed) {
-            output_frames -= SDL_GetResamplerPaddingFrames(resample_rate);
+            output_frames -= SDL_GetResamplerPaddingFrames(resample_rate, stream->resample_quality);
         }
 
         output_frames = SDL_GetResamplerOutputFrames(output_frames, resample_rate, &resample_offset);
@@ -843,6 +1260,92 @@ static Sint64 GetAudioStreamHead(SDL_AudioStream* stream, SDL_AudioSpec* out_spe
     return NextAudioStreamIter(stream, &iter, &resample_offset, out_spec, out_flushed);
 }
 
+// The fused resampling path converts, remixes and resamples this many output frames at a time.
+// It's small enough that the float data for a block stays in the L1 cache, even with 7.1 audio.
+#define FUSED_RESAMPLE_BLOCK_FRAMES 256
+
+// Only the common cases go through the fused path; everything else uses separate passes over the whole work buffer.
+static SDL_bool CanFuseAudioStreamResample(SDL_AudioFormat src_format, int src_channels, SDL_AudioFormat dst_format, int dst_channels)
+{
+    if ((src_format != SDL_AUDIO_S16) && (src_format != SDL_AUDIO_F32)) {
+        return SDL_FALSE;
+    } else if (dst_format != SDL_AUDIO_F32) {
+        return SDL_FALSE;
+    }
+
+    switch (src_channels) {
+    case 1: case 2: case 6: case 8: break;
+    default: return SDL_FALSE;
+    }
+
+    switch (dst_channels) {
+    case 1: case 2: case 6: case 8: break;
+    default: return SDL_FALSE;
+    }
+
+    return SDL_TRUE;
+}
+
+// Limit the output block size, so each block needs at most FUSED_RESAMPLE_BLOCK_FRAMES+2 input frames (plus padding).
+static int GetFusedResampleBlockFrames(Sint64 resample_rate)
+{
+    const Sint64 block_frames = ((Sint64)FUSED_RESAMPLE_BLOCK_FRAMES << 32) / resample_rate;
+    return (int) SDL_clamp(block_frames, 1, FUSED_RESAMPLE_BLOCK_FRAMES);
+}
+
+// Converts, remixes and resamples `output_frames` frames, one block at a time.
+// `input_buffer` is in the input format, with `padding_frames` of valid data on either side of it.
+// `block_buffer` must hold (FUSED_RESAMPLE_BLOCK_FRAMES + 2 + padding_frames * 2) frames of the largest frame size, and
+// `block_output` must hold a block of resampled frames, unless they can be written straight to `buf`.
+static void ResampleAudioStreamBlocks(SDL_AudioStream *stream, const Uint8 *input_buffer, int padding_frames,
+                                      Uint8 *buf, int output_frames, Sint64 resample_rate,
+                                      float *block_buffer, float *block_output)
+{
+    const SDL_AudioFormat src_format = stream->input_spec.format;
+    const int src_channels = stream->input_spec.channels;
+    const int src_frame_size = SDL_AUDIO_FRAMESIZE(stream->input_spec);
+    const SDL_AudioFormat dst_format = stream->dst_spec.format;
+    const int dst_channels = stream->dst_spec.channels;
+    const int dst_frame_size = SDL_AUDIO_FRAMESIZE(stream->dst_spec);
+    const int resample_channels = SDL_min(src_channels, dst_channels);
+    const int block_frames = GetFusedResampleBlockFrames(resample_rate);
+
+    // A custom remix happens before resampling, unless it adds channels.
+    const float *channel_matrix = GetAudioStreamChannelMatrix(stream, src_channels);
+    const float *input_matrix = (dst_channels <= src_channels) ? channel_matrix : NULL;
+    const float *output_matrix = (dst_channels <= src_channels) ? NULL : channel_matrix;
+
+    // Already float, with the right channel count? We can resample straight out of the input.
+    const SDL_bool convert_input = (src_format != SDL_AUDIO_F32) || (src_channels != resample_channels) || input_matrix;
+
+    while (output_frames > 0) {
+        const int out_frames = SDL_min(output_frames, block_frames);
+        const int in_frames = (int) SDL_GetResamplerInputFrames(out_frames, resample_rate, stream->resample_offset);
+        const float *resample_input = (const float *) input_buffer;
+
+        SDL_assert(in_frames <= FUSED_RESAMPLE_BLOCK_FRAMES + 2);
+
+        if (convert_input) {
+            ConvertAudio(in_frames + (padding_frames * 2), input_buffer - (padding_frames * src_frame_size), src_format, src_channels,
+                         block_buffer, SDL_AUDIO_F32, resample_channels, NULL, input_matrix);
+            resample_input = block_buffer + (padding_frames * resample_channels);
+        }
+
+        float *resample_output = block_output ? block_output : (float *) buf;
+
+        SDL_ResampleAudio(resample_channels, resample_input, in_frames, resample_output, out_frames,
+                          resample_rate, &stream->resample_offset, stream->resample_quality);
+
+        if (block_output) {
+            ConvertAudio(out_frames, block_output, SDL_AUDIO_F32, resample_channels, buf, dst_format, dst_channels, NULL, output_matrix);
+        }
+
+        input_buffer += in_frames * src_frame_size;
+        buf += out_frames * dst_frame_size;
+        output_frames -= out_frames;
+    }
+}
+
 // You must hold stream->lock and validate your parameters before calling this!
 // Enough input data MUST be available!
 static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int output_frames)
@@ -859,6 +1362,7 @@ static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int ou
 
     const int max_frame_size = CalculateMaxFrameSize(src_format, src_channels, dst_format, dst_channels);
     const Sint64 resample_rate = GetAudioStreamResampleRate(stream, src_spec->freq, stream->resample_offset);
+    const float *channel_matrix = GetAudioStreamChannelMatrix(stream, src_channels);
 
 #if DEBUG_AUDIOSTREAM
     SDL_Log("AUDIOSTREAM: asking for %d frames.", output_frames);
@@ -873,7 +1377,7 @@ static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int ou
         // If no conversion is happening, read straight into the output buffer.
         // Note, this is just to avoid extra copies.
         // Some other formats may fit directly into the output buffer, but i'd rather process data in a SIMD-aligned buffer.
-        if ((src_format == dst_format) && (src_channels == dst_channels)) {
+        if ((src_format == dst_format) && (src_channels == dst_channels) && !channel_matrix) {
             input_buffer = (Uint8 *)buf;
         } else {
             input_buffer = EnsureAudioStreamWorkBufferSize(stream, output_frames * max_frame_size);
@@ -895,7 +1399,7 @@ static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int ou
 
         // Convert the data, if necessary
         if (buf != input_buffer) {
-            ConvertAudio(output_frames, input_buffer, src_format, src_channels, buf, dst_format, dst_channels, input_buffer);
+            ConvertAudio(output_frames, input_buffer, src_format, src_channels, buf, dst_format, dst_channels, input_buffer, channel_matrix);
         }
 
         return 0;
@@ -909,7 +1413,7 @@ static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int ou
     const int input_frames = (int) SDL_GetResamplerInputFrames(output_frames, resample_rate, stream->resample_offset);
     const int input_bytes = input_frames * src_frame_size;
 
-    const int resampler_padding_frames = SDL_GetResamplerPaddingFrames(resample_rate);
+    const int resampler_padding_frames = SDL_GetResamplerPaddingFrames(resample_rate, stream->resample_quality);
 
     // If increasing channels, do it after resampling, since we'd just
     // do more work to resample duplicate channels. If we're decreasing, do
@@ -933,10 +1437,36 @@ static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int ou
     int work_buffer_capacity = work_buffer_frames * max_frame_size;
     int resample_buffer_offset = -1;
 
-    // Check if we can resample directly into the output buffer.
-    // Note, this is just to avoid extra copies.
-    // Some other formats may fit directly into the output buffer, but i'd rather process data in a SIMD-aligned buffer.
-    if ((dst_format != SDL_AUDIO_F32) || (dst_channels != resample_channels)) {
+    // The fused path only keeps the unconverted input around, and then works on it a block at a time:
+    //   src_sample_frame_size * (left_padding+input_buffer+right_padding)
+    //   max_sample_frame_size * (left_padding+block_input+right_padding)
+    //     resample_frame_size * block_output (only if remixing after resampling)
+    const SDL_bool fused = CanFuseAudioStreamResample(src_format, src_channels, dst_format, dst_channels);
+    int block_buffer_offset = -1;
+    int block_output_offset = -1;
+
+    if (fused) {
+        const int simd_alignment = (int) SDL_SIMDGetAlignment();
+
+        work_buffer_capacity = work_buffer_frames * src_frame_size;
+        work_buffer_capacity += simd_alignment - 1;
+        work_buffer_capacity -= work_buffer_capacity % simd_alignment;
+
+        block_buffer_offset = work_buffer_capacity;
+        work_buffer_capacity += (FUSED_RESAMPLE_BLOCK_FRAMES + 2 + (resampler_padding_frames * 2)) * max_frame_size;
+
+        if (dst_channels != resample_channels) {
+            work_buffer_capacity += simd_alignment - 1;
+            work_buffer_capacity -= work_buffer_capacity % simd_alignment;
+
+            block_output_offset = work_buffer_capacity;
+            work_buffer_capacity += GetFusedResampleBlockFrames(resample_rate) * resample_frame_size;
+        }
+    } else if ((dst_format != SDL_AUDIO_F32) || (dst_channels != resample_channels)) {
+        // Check if we can resample directly into the output buffer.
+        // Note, this is just to avoid extra copies.
+        // Some other formats may fit directly into the output buffer, but i'd rather process data in a SIMD-aligned buffer.
+
         // Allocate space for converting the resampled output to the destination format
         int resample_convert_bytes = output_frames * max_frame_size;
         work_buffer_capacity = SDL_max(work_buffer_capacity, resample_convert_bytes);
@@ -990,8 +1520,19 @@ static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int ou
 
     SDL_assert(work_buffer_frames == input_frames + (resampler_padding_frames * 2));
 
+    if (fused) {
+        ResampleAudioStreamBlocks(stream, input_buffer, resampler_padding_frames, (Uint8 *) buf, output_frames, resample_rate,
+                                  (float *) (work_buffer + block_buffer_offset),
+                                  (block_output_offset != -1) ? (float *) (work_buffer + block_output_offset) : NULL);
+        return 0;
+    }
+
+    // A custom remix happens before resampling, unless it adds channels.
+    const float *input_matrix = (dst_channels <= src_channels) ? channel_matrix : NULL;
+    const float *output_matrix = (dst_channels <= src_channels) ? NULL : channel_matrix;
+
     // Resampling! get the work buffer to float32 format, etc, in-place.
-    ConvertAudio(work_buffer_frames, work_buffer, src_format, src_channels, work_buffer, SDL_AUDIO_F32, resample_channels, NULL);
+    ConvertAudio(work_buffer_frames, work_buffer, src_format, src_channels, work_buffer, SDL_AUDIO_F32, resample_channels, NULL, input_matrix);
 
     // Update the work_buffer pointers based on the new frame size
     input_buffer = work_buffer + ((input_buffer - work_buffer) / src_frame_size * resample_frame_size);
@@ -1004,68 +1545,21 @@ static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int ou
     SDL_ResampleAudio(resample_channels,
                   (const float *) input_buffer, input_frames,
                   (float*) resample_buffer, output_frames,
-                  resample_rate, &stream->resample_offset);
+                  resample_rate, &stream->resample_offset, stream->resample_quality);
 
     // Convert to the final format, if necessary
     if (buf != resample_buffer) {
-        ConvertAudio(output_frames, resample_buffer, SDL_AUDIO_F32, resample_channels, buf, dst_format, dst_channels, work_buffer);
+        ConvertAudio(output_frames, resample_buffer, SDL_AUDIO_F32, resample_channels, buf, dst_format, dst_channels, work_buffer, output_matrix);
     }
 
     return 0;
 }
 
-// get converted/resampled data from the stream
-int SDL_GetAudioStreamData(SDL_AudioStream *stream, void *voidbuf, int len)
+// Convert up to `len` bytes (whole output frames) of queued data into `buf`. You must hold stream->lock!
+static int ConvertAudioStreamData(SDL_AudioStream *stream, Uint8 *buf, int len)
 {
-    Uint8 *buf = (Uint8 *) voidbuf;
-
-#if DEBUG_AUDIOSTREAM
-    SDL_Log("AUDIOSTREAM: want to get %d converted bytes", len);
-#endif
-
-    if (!stream) {
-        return SDL_InvalidParamError("stream");
-    } else if (!buf) {
-        return SDL_InvalidParamError("buf");
-    } else if (len < 0) {
-        return SDL_InvalidParamError("len");
-    } else if (len == 0) {
-        return 0; // nothing to do.
-    }
-
-    SDL_LockMutex(stream->lock);
-
-    if (CheckAudioStreamIsFullySetup(stream) != 0) {
-        SDL_UnlockMutex(stream->lock);
-        return -1;
-    }
-
     const int dst_frame_size = SDL_AUDIO_FRAMESIZE(stream->dst_spec);
 
-    len -= len % dst_frame_size;  // chop off any fractional sample frame.
-
-    // give the callback a chance to fill in more stream data if it wants.
-    if (stream->get_callback) {
-        Sint64 total_request = len / dst_frame_size;  // start with sample frames desired
-        Sint64 additional_request = total_request;
-
-        Sint64 resample_offset = 0;
-        Sint64 available_frames = GetAudioStreamAvailableFrames(stream, &resample_offset);
-
-        additional_request -= SDL_min(additional_request, available_frames);
-
-        Sint64 resample_rate = GetAudioStreamResampleRate(stream, stream->src_spec.freq, resample_offset);
-
-        if (resample_rate) {
-            total_request = SDL_GetResamplerInputFrames(total_request, resample_rate, resample_offset);
-            additional_request = SDL_GetResamplerInputFrames(additional_request, resample_rate, resample_offset);
-        }
-
-        total_request *= SDL_AUDIO_FRAMESIZE(stream->src_spec);  // convert sample frames to bytes.
-        additional_request *= SDL_AUDIO_FRAMESIZE(stream->src_spec);  // convert sample frames to bytes.
-        stream->get_callback(stream->get_callback_userdata, stream, (int) SDL_min(additional_request, SDL_INT_MAX), (int) SDL_min(total_request, SDL_INT_MAX));
-    }
-
     // Process the data in chunks to avoid allocating too much memory (and potential integer overflows)
     const int chunk_size = 4096;
 
@@ -1107,6 +1601,156 @@ int SDL_GetAudioStreamData(SDL_AudioStream *stream, void *voidbuf, int len)
         total += output_frames * dst_frame_size;
     }
 
+    return total;
+}
+
+// Convert one small piece of queued data ahead of time. Returns SDL_FALSE if there was nothing to do. You must hold stream->lock!
+static SDL_bool FillAudioStreamLookahead(SDL_AudioStream *stream)
+{
+    // A chunk is small, so a device thread that wants the lock never waits long for the worker.
+    const int max_chunk_frames = 1024;
+
+    if (!stream->lookahead_watermark || (stream->lookahead_bytes >= stream->lookahead_watermark)) {
+        return SDL_FALSE;
+    }
+
+    UpdateAudioStreamProperties(stream);
+    if ((CheckAudioStreamIsFullySetup(stream) != 0) || (DrainAudioStreamRing(stream) != 0)) {
+        return SDL_FALSE;
+    }
+
+    const int dst_frame_size = SDL_AUDIO_FRAMESIZE(stream->dst_spec);
+    const size_t allocation = stream->lookahead_watermark + dst_frame_size;  // so there's always room for a whole frame below the watermark.
+    if (stream->lookahead_allocation < allocation) {
+        Uint8 *ptr = (Uint8 *) SDL_malloc(allocation);
+        if (!ptr) {
+            return SDL_FALSE;  // reading the stream will just convert everything itself.
+        }
+        SDL_memcpy(ptr, stream->lookahead + stream->lookahead_offset, stream->lookahead_bytes);
+        SDL_free(stream->lookahead);
+        stream->lookahead = ptr;
+        stream->lookahead_allocation = allocation;
+        stream->lookahead_offset = 0;
+    } else if (stream->lookahead_offset) {
+        // Readers only ever copy from the front; we move what's left back down here, off the device thread.
+        SDL_memmove(stream->lookahead, stream->lookahead + stream->lookahead_offset, stream->lookahead_bytes);
+        stream->lookahead_offset = 0;
+    }
+
+    const int room = (int) ((stream->lookahead_allocation - stream->lookahead_bytes) / dst_frame_size);
+    const int frames = SDL_min(room, max_chunk_frames);
+    const int converted = ConvertAudioStreamData(stream, stream->lookahead + stream->lookahead_bytes, frames * dst_frame_size);
+    if (converted <= 0) {
+        return SDL_FALSE;
+    }
+
+    if (!stream->lookahead_bytes) {
+        SDL_copyp(&stream->lookahead_spec, &stream->dst_spec);
+    }
+    stream->lookahead_bytes += converted;
+    return SDL_TRUE;
+}
+
+static int SDLCALL AudioStreamLookaheadThread(void *data)
+{
+    SDL_AudioStream *stream = (SDL_AudioStream *) data;
+
+    SDL_LockMutex(stream->lock);
+    while (!stream->lookahead_quit) {
+        if (FillAudioStreamLookahead(stream)) {
+            // let anyone waiting on the stream in between chunks.
+            SDL_UnlockMutex(stream->lock);
+            SDL_LockMutex(stream->lock);
+        } else {
+            SDL_WaitCondition(stream->lookahead_cond, stream->lock);
+        }
+    }
+    SDL_UnlockMutex(stream->lock);
+
+    return 0;
+}
+
+// Everything SDL_GetAudioStreamData does once the stream is locked and set up, and its SPSC ring (if any) is drained.
+static int GetAudioStreamDataLocked(SDL_AudioStream *stream, Uint8 *buf, int len)
+{
+    const int dst_frame_size = SDL_AUDIO_FRAMESIZE(stream->dst_spec);
+
+    len -= len % dst_frame_size;  // chop off any fractional sample frame.
+
+    // give the callback a chance to fill in more stream data if it wants.
+    if (stream->get_callback) {
+        Sint64 total_request = len / dst_frame_size;  // start with sample frames desired
+        Sint64 additional_request = total_request;
+
+        Sint64 resample_offset = 0;
+        Sint64 available_frames = GetAudioStreamAvailableFrames(stream, &resample_offset);
+        available_frames += stream->lookahead_bytes / dst_frame_size;
+
+        additional_request -= SDL_min(additional_request, available_frames);
+
+        Sint64 resample_rate = GetAudioStreamResampleRate(stream, stream->src_spec.freq, resample_offset);
+
+        if (resample_rate) {
+            total_request = SDL_GetResamplerInputFrames(total_request, resample_rate, resample_offset);
+            additional_request = SDL_GetResamplerInputFrames(additional_request, resample_rate, resample_offset);
+        }
+
+        total_request *= SDL_AUDIO_FRAMESIZE(stream->src_spec);  // convert sample frames to bytes.
+        additional_request *= SDL_AUDIO_FRAMESIZE(stream->src_spec);  // convert sample frames to bytes.
+        stream->get_callback(stream->get_callback_userdata, stream, (int) SDL_min(additional_request, SDL_INT_MAX), (int) SDL_min(total_request, SDL_INT_MAX));
+    }
+
+    // Anything the look-ahead worker converted comes first; it's already in dst_spec (see SetAudioStreamDestSpec).
+    int total = (int) SDL_min(stream->lookahead_bytes, (size_t) len);
+    if (total > 0) {
+        SDL_memcpy(buf, stream->lookahead + stream->lookahead_offset, total);
+        stream->lookahead_offset += total;
+        stream->lookahead_bytes -= total;
+    }
+
+    if (total < len) {
+        const int converted = ConvertAudioStreamData(stream, buf + total, len - total);
+        if (converted > 0) {
+            total += converted;
+        } else if ((converted < 0) && (total == 0)) {
+            total = -1;
+        }
+    }
+
+    if (total > 0) {
+        stream->total_bytes_converted += total;
+    }
+
+    WakeAudioStreamLookahead(stream);  // there's room to convert more ahead of time now.
+
+    return total;
+}
+
+// get converted/resampled data from the stream
+int SDL_GetAudioStreamData(SDL_AudioStream *stream, void *voidbuf, int len)
+{
+    Uint8 *buf = (Uint8 *) voidbuf;
+
+#if DEBUG_AUDIOSTREAM
+    SDL_Log("AUDIOSTREAM: want to get %d converted bytes", len);
+#endif
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (!buf) {
+        return SDL_InvalidParamError("buf");
+    } else if (len < 0) {
+        return SDL_InvalidParamError("len");
+    } else if (len == 0) {
+        return 0; // nothing to do.
+    }
+
+    if (LockAudioStreamForData(stream) != 0) {
+        return -1;
+    }
+
+    const int total = GetAudioStreamDataLocked(stream, buf, len);
+
     SDL_UnlockMutex(stream->lock);
 
 #if DEBUG_AUDIOSTREAM
@@ -1116,31 +1760,164 @@ int SDL_GetAudioStreamData(SDL_AudioStream *stream, void *voidbuf, int len)
     return total;
 }
 
-// number of converted/resampled bytes available for output
-int SDL_GetAudioStreamAvailable(SDL_AudioStream *stream)
+int SDL_PutAudioStreamDataBatch(SDL_AudioStreamBuffer *buffers, int num_buffers)
 {
-    if (!stream) {
-        return SDL_InvalidParamError("stream");
+    if (!buffers && (num_buffers > 0)) {
+        return SDL_InvalidParamError("buffers");
+    } else if (num_buffers < 0) {
+        return SDL_InvalidParamError("num_buffers");
     }
 
-    SDL_LockMutex(stream->lock);
+    int retval = 0;
+    int i = 0;
+    while (i < num_buffers) {
+        SDL_AudioStream *stream = buffers[i].stream;
+
+        // Entries for the same stream that are next to each other share the lock, the setup checks and one put callback.
+        int end = i + 1;
+        while ((end < num_buffers) && (buffers[end].stream == stream)) {
+            end++;
+        }
+
+        if (!stream || (LockAudioStreamForData(stream) != 0)) {
+            if (!stream) {
+                SDL_InvalidParamError("stream");
+            }
+            for (; i < end; i++) {
+                buffers[i].result = -1;
+            }
+            retval = -1;
+            continue;
+        }
+
+        const int frame_size = SDL_AUDIO_FRAMESIZE(stream->src_spec);
+        const int prev_available = stream->put_callback ? GetAudioStreamAvailableBytes(stream) : 0;
+        SDL_bool queued = SDL_FALSE;
+
+        for (; i < end; i++) {
+            SDL_AudioStreamBuffer *buffer = &buffers[i];
+            if (!buffer->buf) {
+                buffer->result = SDL_InvalidParamError("buf");
+            } else if (buffer->len < 0) {
+                buffer->result = SDL_InvalidParamError("len");
+            } else if ((buffer->len % frame_size) != 0) {
+                buffer->result = SDL_SetError("Can't add partial sample frames");
+            } else if (buffer->len == 0) {
+                buffer->result = 0;  // nothing to do.
+            } else {
+                buffer->result = SDL_WriteToAudioQueue(stream->queue, &stream->src_spec, (const Uint8 *) buffer->buf, buffer->len);
+                if (buffer->result == 0) {
+                    stream->total_bytes_queued += buffer->len;
+                    queued = SDL_TRUE;
+                }
+            }
+
+            if (buffer->result < 0) {
+                retval = -1;
+            }
+        }
+
+        if (queued) {
+            WakeAudioStreamLookahead(stream);
+            if (stream->put_callback) {
+                const int newavail = GetAudioStreamAvailableBytes(stream) - prev_available;
+                stream->put_callback(stream->put_callback_userdata, stream, newavail, newavail);
+            }
+        }
 
-    if (CheckAudioStreamIsFullySetup(stream) != 0) {
         SDL_UnlockMutex(stream->lock);
+    }
+
+    return retval;
+}
+
+int SDL_GetAudioStreamDataBatch(SDL_AudioStreamBuffer *buffers, int num_buffers)
+{
+    if (!buffers && (num_buffers > 0)) {
+        return SDL_InvalidParamError("buffers");
+    } else if (num_buffers < 0) {
+        return SDL_InvalidParamError("num_buffers");
+    }
+
+    int retval = 0;
+    int i = 0;
+    while (i < num_buffers) {
+        SDL_AudioStream *stream = buffers[i].stream;
+
+        // Entries for the same stream that are next to each other share the lock and the setup checks.
+        int end = i + 1;
+        while ((end < num_buffers) && (buffers[end].stream == stream)) {
+            end++;
+        }
+
+        if (!stream || (LockAudioStreamForData(stream) != 0)) {
+            if (!stream) {
+                SDL_InvalidParamError("stream");
+            }
+            for (; i < end; i++) {
+                buffers[i].result = -1;
+            }
+            retval = -1;
+            continue;
+        }
+
+        for (; i < end; i++) {
+            SDL_AudioStreamBuffer *buffer = &buffers[i];
+            if (!buffer->buf) {
+                buffer->result = SDL_InvalidParamError("buf");
+            } else if (buffer->len < 0) {
+                buffer->result = SDL_InvalidParamError("len");
+            } else if (buffer->len == 0) {
+                buffer->result = 0;  // nothing to do.
+            } else {
+                buffer->result = GetAudioStreamDataLocked(stream, (Uint8 *) buffer->buf, buffer->len);
+            }
+
+            if (buffer->result < 0) {
+                retval = -1;
+            }
+        }
+
+        SDL_UnlockMutex(stream->lock);
+    }
+
+    return retval;
+}
+
+// number of converted/resampled bytes available for output, not counting an SPSC stream's ring. You must hold stream->lock!
+static int GetAudioStreamAvailableBytes(SDL_AudioStream *stream)
+{
+    if (CheckAudioStreamIsFullySetup(stream) != 0) {
         return 0;
     }
 
+    UpdateAudioStreamProperties(stream);
+
     Sint64 count = GetAudioStreamAvailableFrames(stream, NULL);
 
     // convert from sample frames to bytes in destination format.
     count *= SDL_AUDIO_FRAMESIZE(stream->dst_spec);
-
-    SDL_UnlockMutex(stream->lock);
+    count += stream->lookahead_bytes;
 
     // if this overflows an int, just clamp it to a maximum.
     return (int) SDL_min(count, SDL_INT_MAX);
 }
 
+// number of converted/resampled bytes available for output
+int SDL_GetAudioStreamAvailable(SDL_AudioStream *stream)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+
+    SDL_LockMutex(stream->lock);
+    DrainAudioStreamRing(stream);
+    const int retval = GetAudioStreamAvailableBytes(stream);
+    SDL_UnlockMutex(stream->lock);
+
+    return retval;
+}
+
 // number of sample frames that are currently queued as input.
 int SDL_GetAudioStreamQueued(SDL_AudioStream *stream)
 {
@@ -1149,6 +1926,7 @@ int SDL_GetAudioStreamQueued(SDL_AudioStream *stream)
     }
 
     SDL_LockMutex(stream->lock);
+    DrainAudioStreamRing(stream);
     const Uint64 total = stream->total_bytes_queued;
     SDL_UnlockMutex(stream->lock);
 
@@ -1164,10 +1942,13 @@ int SDL_ClearAudioStream(SDL_AudioStream *stream)
 
     SDL_LockMutex(stream->lock);
 
+    SDL_AtomicSet(&stream->ring_tail, SDL_AtomicGet(&stream->ring_head));  // throw away anything in an SPSC stream's ring, too.
     SDL_ClearAudioQueue(stream->queue);
     SDL_zero(stream->input_spec);
     stream->resample_offset = 0;
     stream->total_bytes_queued = 0;
+    stream->lookahead_offset = 0;
+    stream->lookahead_bytes = 0;
 
     SDL_UnlockMutex(stream->lock);
     return 0;
@@ -1193,10 +1974,16 @@ void SDL_DestroyAudioStream(SDL_AudioStream *stream)
         SDL_UnbindAudioStream(stream);
     }
 
+    // only once the device thread can't get to the stream, as it wakes the worker when it reads.
+    StopAudioStreamLookahead(stream);
+
     SDL_aligned_free(stream->history_buffer);
     SDL_aligned_free(stream->work_buffer);
+    SDL_free(stream->channel_matrix);
     SDL_DestroyAudioQueue(stream->queue);
     SDL_DestroyMutex(stream->lock);
+    SDL_free(stream->ring);
+    SDL_free(stream->lookahead);
 
     SDL_free(stream);
 }
@@ -36,13 +36,6 @@ struct SDL_AudioTrack
     void (*destroy)(void *ctx);
 };
 
-struct SDL_AudioQueue
-{
-    SDL_AudioTrack *head;
-    SDL_AudioTrack *tail;
-    size_t chunk_size;
-};
-
 typedef struct SDL_AudioChunk SDL_AudioChunk;
 
 struct SDL_AudioChunk
@@ -53,6 +46,24 @@ struct SDL_AudioChunk
     Uint8 data[SDL_VARIABLE_LENGTH_ARRAY];
 };
 
+// Chunks that have been read get parked here for reuse, so a queue that is being written and read
+// at a steady rate stops going to the heap at all.
+typedef struct SDL_AudioChunkPool
+{
+    SDL_AudioChunk *free_chunks;
+    size_t num_free_chunks;
+    size_t max_free_bytes;
+    SDL_AudioQueuePoolStats stats;
+} SDL_AudioChunkPool;
+
+struct SDL_AudioQueue
+{
+    SDL_AudioTrack *head;
+    SDL_AudioTrack *tail;
+    size_t chunk_size;
+    SDL_AudioChunkPool pool;
+};
+
 typedef struct SDL_ChunkedAudioTrack
 {
     SDL_AudioTrack track;
@@ -63,8 +74,7 @@ typedef struct SDL_ChunkedAudioTrack
     SDL_AudioChunk *tail;
     size_t queued_bytes;
 
-    SDL_AudioChunk *free_chunks;
-    size_t num_free_chunks;
+    SDL_AudioChunkPool *pool;  // NULL until the track is added to a queue.
 } SDL_ChunkedAudioTrack;
 
 static void DestroyAudioChunk(SDL_AudioChunk *chunk)
@@ -81,6 +91,17 @@ static void DestroyAudioChunks(SDL_AudioChunk *chunk)
     }
 }
 
+static void TrimAudioChunkPool(SDL_AudioChunkPool *pool, size_t chunk_size)
+{
+    while (pool->free_chunks && ((chunk_size * pool->num_free_chunks) > pool->max_free_bytes)) {
+        SDL_AudioChunk *chunk = pool->free_chunks;
+        pool->free_chunks = chunk->next;
+        --pool->num_free_chunks;
+        DestroyAudioChunk(chunk);
+        ++pool->stats.frees;
+    }
+}
+
 static void ResetAudioChunk(SDL_AudioChunk *chunk)
 {
     chunk->next = NULL;
@@ -103,33 +124,43 @@ static SDL_AudioChunk *CreateAudioChunk(size_t chunk_size)
 
 static void DestroyAudioTrackChunk(SDL_ChunkedAudioTrack *track, SDL_AudioChunk *chunk)
 {
-    // Keeping a list of free chunks reduces memory allocations,
-    // But also increases the amount of work to perform when freeing the track.
-    const size_t max_free_bytes = 64 * 1024;
+    SDL_AudioChunkPool *pool = track->pool;
 
-    if (track->chunk_size * track->num_free_chunks < max_free_bytes) {
-        chunk->next = track->free_chunks;
-        track->free_chunks = chunk;
-        ++track->num_free_chunks;
+    if (!pool) {
+        DestroyAudioChunk(chunk);
+    } else if (track->chunk_size * (pool->num_free_chunks + 1) <= pool->max_free_bytes) {
+        chunk->next = pool->free_chunks;
+        pool->free_chunks = chunk;
+        ++pool->num_free_chunks;
     } else {
         DestroyAudioChunk(chunk);
+        ++pool->stats.frees;
     }
 }
 
 static SDL_AudioChunk *CreateAudioTrackChunk(SDL_ChunkedAudioTrack *track)
 {
-    if (track->num_free_chunks > 0) {
-        SDL_AudioChunk *chunk = track->free_chunks;
+    SDL_AudioChunkPool *pool = track->pool;
 
-        track->free_chunks = chunk->next;
-        --track->num_free_chunks;
+    if (pool && (pool->num_free_chunks > 0)) {
+        SDL_AudioChunk *chunk = pool->free_chunks;
+
+        pool->free_chunks = chunk->next;
+        --pool->num_free_chunks;
+        ++pool->stats.reuses;
 
         ResetAudioChunk(chunk);
 
         return chunk;
     }
 
-    return CreateAudioChunk(track->chunk_size);
+    SDL_AudioChunk *chunk = CreateAudioChunk(track->chunk_size);
+
+    if (chunk && pool) {
+        ++pool->stats.allocations;
+    }
+
+    return chunk;
 }
 
 static size_t AvailChunkedAudioTrack(void *ctx)
@@ -246,12 +277,19 @@ static size_t ReadFromChunkedAudioTrack(void *ctx, Uint8 *data, size_t len, SDL_
 static void DestroyChunkedAudioTrack(void *ctx)
 {
     SDL_ChunkedAudioTrack *track = (SDL_ChunkedAudioTrack *)ctx;
-    DestroyAudioChunks(track->head);
-    DestroyAudioChunks(track->free_chunks);
+    SDL_AudioChunk *chunk = track->head;
+
+    // Any chunks we were still holding go back to the queue's pool, too.
+    while (chunk) {
+        SDL_AudioChunk *next = chunk->next;
+        DestroyAudioTrackChunk(track, chunk);
+        chunk = next;
+    }
+
     SDL_free(track);
 }
 
-static SDL_AudioTrack *CreateChunkedAudioTrack(const SDL_AudioSpec *spec, size_t chunk_size)
+static SDL_AudioTrack *CreateChunkedAudioTrack(const SDL_AudioSpec *spec, size_t chunk_size, SDL_AudioChunkPool *pool)
 {
     SDL_ChunkedAudioTrack *track = (SDL_ChunkedAudioTrack *)SDL_calloc(1, sizeof(*track));
 
@@ -266,10 +304,69 @@ static SDL_AudioTrack *CreateChunkedAudioTrack(const SDL_AudioSpec *spec, size_t
     track->track.destroy = DestroyChunkedAudioTrack;
 
     track->chunk_size = chunk_size;
+    track->pool = pool;
 
     return &track->track;
 }
 
+typedef struct SDL_BufferAudioTrack
+{
+    SDL_AudioTrack track;
+
+    const Uint8 *data;
+    size_t len;
+    size_t head;
+
+    SDL_AudioStreamDataCompleteCallback callback;
+    void *userdata;
+} SDL_BufferAudioTrack;
+
+static void ReleaseBufferAudioTrack(SDL_BufferAudioTrack *track)
+{
+    SDL_AudioStreamDataCompleteCallback callback = track->callback;
+
+    // Only ever fire the callback once.
+    track->callback = NULL;
+
+    if (callback) {
+        callback(track->userdata, track->data, (int)track->len);
+    }
+}
+
+static size_t AvailBufferAudioTrack(void *ctx)
+{
+    SDL_BufferAudioTrack *track = (SDL_BufferAudioTrack *)ctx;
+
+    return track->len - track->head;
+}
+
+static size_t ReadFromBufferAudioTrack(void *ctx, Uint8 *data, size_t len, SDL_bool advance)
+{
+    SDL_BufferAudioTrack *track = (SDL_BufferAudioTrack *)ctx;
+
+    size_t to_read = track->len - track->head;
+    to_read = SDL_min(to_read, len);
+    SDL_memcpy(data, &track->data[track->head], to_read);
+
+    if (advance) {
+        track->head += to_read;
+
+        // Hand the buffer back as soon as it's all been read, rather than when the next track takes over.
+        if (track->head == track->len) {
+            ReleaseBufferAudioTrack(track);
+        }
+    }
+
+    return to_read;
+}
+
+static void DestroyBufferAudioTrack(void *ctx)
+{
+    SDL_BufferAudioTrack *track = (SDL_BufferAudioTrack *)ctx;
+    ReleaseBufferAudioTrack(track);
+    SDL_free(track);
+}
+
 SDL_AudioQueue *SDL_CreateAudioQueue(size_t chunk_size)
 {
     SDL_AudioQueue *queue = (SDL_AudioQueue *)SDL_calloc(1, sizeof(*queue));
@@ -279,6 +376,7 @@ SDL_AudioQueue *SDL_CreateAudioQueue(size_t chunk_size)
     }
 
     queue->chunk_size = chunk_size;
+    queue->pool.max_free_bytes = SDL_AUDIO_QUEUE_DEFAULT_MAX_POOLED_BYTES;
 
     return queue;
 }
@@ -287,9 +385,23 @@ void SDL_DestroyAudioQueue(SDL_AudioQueue *queue)
 {
     SDL_ClearAudioQueue(queue);
 
+    DestroyAudioChunks(queue->pool.free_chunks);
+
     SDL_free(queue);
 }
 
+void SDL_SetAudioQueueMaxPooledBytes(SDL_AudioQueue *queue, size_t max_bytes)
+{
+    queue->pool.max_free_bytes = max_bytes;
+    TrimAudioChunkPool(&queue->pool, queue->chunk_size);
+}
+
+void SDL_GetAudioQueuePoolStats(SDL_AudioQueue *queue, SDL_AudioQueuePoolStats *stats)
+{
+    SDL_copyp(stats, &queue->pool.stats);
+    stats->pooled_bytes = queue->chunk_size * queue->pool.num_free_chunks;
+}
+
 void SDL_ClearAudioQueue(SDL_AudioQueue *queue)
 {
     SDL_AudioTrack *track = queue->head;
@@ -348,7 +460,8 @@ size_t SDL_GetAudioQueueChunkSize(SDL_AudioQueue *queue)
 
 SDL_AudioTrack *SDL_CreateChunkedAudioTrack(const SDL_AudioSpec *spec, const Uint8 *data, size_t len, size_t chunk_size)
 {
-    SDL_AudioTrack *track = CreateChunkedAudioTrack(spec, chunk_size);
+    // This isn't allowed to touch any queue's pool, since no locks are held. The chunks get pooled once they're read.
+    SDL_AudioTrack *track = CreateChunkedAudioTrack(spec, chunk_size, NULL);
 
     if (!track) {
         return NULL;
@@ -362,10 +475,36 @@ SDL_AudioTrack *SDL_CreateChunkedAudioTrack(const SDL_AudioSpec *spec, const Uin
     return track;
 }
 
+SDL_AudioTrack *SDL_CreateBufferAudioTrack(const SDL_AudioSpec *spec, const Uint8 *data, size_t len, SDL_AudioStreamDataCompleteCallback callback, void *userdata)
+{
+    SDL_BufferAudioTrack *track = (SDL_BufferAudioTrack *)SDL_calloc(1, sizeof(*track));
+
+    if (!track) {
+        return NULL;
+    }
+
+    // There's no write function, so anything queued after this goes into a new track.
+    SDL_copyp(&track->track.spec, spec);
+    track->track.avail = AvailBufferAudioTrack;
+    track->track.read = ReadFromBufferAudioTrack;
+    track->track.destroy = DestroyBufferAudioTrack;
+
+    track->data = data;
+    track->len = len;
+    track->callback = callback;
+    track->userdata = userdata;
+
+    return &track->track;
+}
+
 void SDL_AddTrackToAudioQueue(SDL_AudioQueue *queue, SDL_AudioTrack *track)
 {
     SDL_AudioTrack *tail = queue->tail;
 
+    if ((track->destroy == DestroyChunkedAudioTrack) && (((SDL_ChunkedAudioTrack *)track)->chunk_size == queue->chunk_size)) {
+        ((SDL_ChunkedAudioTrack *)track)->pool = &queue->pool;
+    }
+
     if (tail) {
         // If the spec has changed, make sure to flush the previous track
         if (!AUDIO_SPECS_EQUAL(tail->spec, track->spec)) {
@@ -393,7 +532,7 @@ int SDL_WriteToAudioQueue(SDL_AudioQueue *queue, const SDL_AudioSpec *spec, cons
     }
 
     if ((!track) || (!track->write)) {
-        SDL_AudioTrack *new_track = CreateChunkedAudioTrack(spec, queue->chunk_size);
+        SDL_AudioTrack *new_track = CreateChunkedAudioTrack(spec, queue->chunk_size, &queue->pool);
 
         if (!new_track) {
             return -1;
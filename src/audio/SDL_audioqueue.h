@@ -44,6 +44,23 @@ void SDL_FlushAudioQueue(SDL_AudioQueue *queue);
 // REQUIRES: The head track must exist, and must have been flushed
 void SDL_PopAudioQueueHead(SDL_AudioQueue *queue);
 
+// Chunks that have been read are kept for reuse, up to this many bytes per queue.
+#define SDL_AUDIO_QUEUE_DEFAULT_MAX_POOLED_BYTES (64 * 1024)
+
+typedef struct SDL_AudioQueuePoolStats
+{
+    Uint64 allocations;  // chunks that had to come from the heap.
+    Uint64 reuses;       // chunks that came from the pool instead.
+    Uint64 frees;        // chunks given back to the heap because the pool was full.
+    size_t pooled_bytes; // bytes currently sitting in the pool.
+} SDL_AudioQueuePoolStats;
+
+// Set how many bytes of free chunks the queue may keep around, releasing any extra now
+void SDL_SetAudioQueueMaxPooledBytes(SDL_AudioQueue *queue, size_t max_bytes);
+
+// Get the chunk pool's statistics
+void SDL_GetAudioQueuePoolStats(SDL_AudioQueue *queue, SDL_AudioQueuePoolStats *stats);
+
 // Get the chunk size, mostly for use with SDL_CreateChunkedAudioTrack
 // This can be called from any thread
 size_t SDL_GetAudioQueueChunkSize(SDL_AudioQueue *queue);
@@ -55,6 +72,11 @@ int SDL_WriteToAudioQueue(SDL_AudioQueue *queue, const SDL_AudioSpec *spec, cons
 // Create a track without needing to hold any locks
 SDL_AudioTrack *SDL_CreateChunkedAudioTrack(const SDL_AudioSpec *spec, const Uint8 *data, size_t len, size_t chunk_size);
 
+// Create a track that reads straight from `data` instead of copying it. `callback` (if not NULL) fires once the track
+// is done with `data`, either because it was all read or because the track was destroyed.
+// This can be called without holding any locks
+SDL_AudioTrack *SDL_CreateBufferAudioTrack(const SDL_AudioSpec *spec, const Uint8 *data, size_t len, SDL_AudioStreamDataCompleteCallback callback, void *userdata);
+
 // Add a track to the end of the queue
 // REQUIRES: `track != NULL`
 void SDL_AddTrackToAudioQueue(SDL_AudioQueue *queue, SDL_AudioTrack *track);
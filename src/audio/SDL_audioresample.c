@@ -181,6 +181,193 @@ static void SDL_TARGETING("sse") ResampleFrame_SSE(const float *src, float *dst,
 }
 #endif
 
+// The cheaper quality levels don't need the bandlimited filter at all.
+
+// Zero-order hold has no arithmetic to speak of, so there's no SIMD version of it.
+static void ResampleZeroOrderHold(int chans, const float *src, int inframes, float *dst, int outframes,
+                                  Sint64 srcpos, Sint64 resample_rate)
+{
+    int i, chan;
+
+    for (i = 0; i < outframes; i++) {
+        const int srcindex = (int)(Sint32)(srcpos >> 32);
+        srcpos += resample_rate;
+
+        SDL_assert(srcindex >= -1 && srcindex < inframes);
+
+        const float *frame = &src[srcindex * chans];
+
+        for (chan = 0; chan < chans; chan++) {
+            dst[chan] = frame[chan];
+        }
+
+        dst += chans;
+    }
+}
+
+#define RESAMPLER_FRACTION_SCALE (1.0f / 4294967296.0f)
+
+static void ResampleLinear_Scalar(int chans, const float *src, int inframes, float *dst, int outframes,
+                                  Sint64 srcpos, Sint64 resample_rate)
+{
+    int i, chan;
+
+    for (i = 0; i < outframes; i++) {
+        const int srcindex = (int)(Sint32)(srcpos >> 32);
+        const float interp = (float)(Uint32)(srcpos & 0xFFFFFFFF) * RESAMPLER_FRACTION_SCALE;
+        srcpos += resample_rate;
+
+        SDL_assert(srcindex >= -1 && srcindex < inframes);
+
+        const float *frame = &src[srcindex * chans];
+
+        for (chan = 0; chan < chans; chan++) {
+            dst[chan] = frame[chan] + ((frame[chan + chans] - frame[chan]) * interp);
+        }
+
+        dst += chans;
+    }
+}
+
+// Catmull-Rom weights for the frames at (srcindex - 1) to (srcindex + 2), for each phase between two frames.
+// The phase is rounded to the nearest entry, so there's an extra one for a fraction that rounds up to a whole frame.
+#define CUBIC_RESAMPLER_PHASE_BITS 8
+#define CUBIC_RESAMPLER_PHASES (1 << CUBIC_RESAMPLER_PHASE_BITS)
+
+static float CubicResamplerFilter[(CUBIC_RESAMPLER_PHASES + 1) * 4];
+
+SDL_FORCE_INLINE const float *GetCubicResamplerFilter(Sint64 srcpos)
+{
+    const Uint64 fraction = (Uint64)(srcpos & 0xFFFFFFFF) + (1u << (31 - CUBIC_RESAMPLER_PHASE_BITS));
+    return &CubicResamplerFilter[(fraction >> (32 - CUBIC_RESAMPLER_PHASE_BITS)) * 4];
+}
+
+static void ResampleCubic_Scalar(int chans, const float *src, int inframes, float *dst, int outframes,
+                                 Sint64 srcpos, Sint64 resample_rate)
+{
+    int i, chan;
+
+    for (i = 0; i < outframes; i++) {
+        const int srcindex = (int)(Sint32)(srcpos >> 32);
+        const float *filter = GetCubicResamplerFilter(srcpos);
+        srcpos += resample_rate;
+
+        SDL_assert(srcindex >= -1 && srcindex < inframes);
+
+        const float *frame = &src[(srcindex - 1) * chans];
+
+        for (chan = 0; chan < chans; chan++) {
+            dst[chan] = (frame[chan] * filter[0]) + (frame[chan + chans] * filter[1]) +
+                        (frame[chan + (chans * 2)] * filter[2]) + (frame[chan + (chans * 3)] * filter[3]);
+        }
+
+        dst += chans;
+    }
+}
+
+#ifdef SDL_SSE_INTRINSICS
+static void SDL_TARGETING("sse") ResampleLinear_SSE(int chans, const float *src, int inframes, float *dst, int outframes,
+                                                    Sint64 srcpos, Sint64 resample_rate)
+{
+    int i, chan;
+
+    if (chans == 2) {
+        for (i = 0; i < outframes; i++) {
+            const int srcindex = (int)(Sint32)(srcpos >> 32);
+            const __m128 interp = _mm_set1_ps((float)(Uint32)(srcpos & 0xFFFFFFFF) * RESAMPLER_FRACTION_SCALE);
+            srcpos += resample_rate;
+
+            SDL_assert(srcindex >= -1 && srcindex < inframes);
+
+            // Both frames fit in a single register: [a0 a1 b0 b1]
+            const __m128 a = _mm_loadu_ps(&src[srcindex * 2]);
+            const __m128 b = _mm_movehl_ps(a, a);
+
+            _mm_storel_pi((__m64 *)dst, _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), interp)));
+            dst += 2;
+        }
+        return;
+    }
+
+    for (i = 0; i < outframes; i++) {
+        const int srcindex = (int)(Sint32)(srcpos >> 32);
+        const float interp = (float)(Uint32)(srcpos & 0xFFFFFFFF) * RESAMPLER_FRACTION_SCALE;
+        const __m128 interp4 = _mm_set1_ps(interp);
+        srcpos += resample_rate;
+
+        SDL_assert(srcindex >= -1 && srcindex < inframes);
+
+        const float *frame = &src[srcindex * chans];
+
+        for (chan = 0; chan + 4 <= chans; chan += 4) {
+            const __m128 a = _mm_loadu_ps(&frame[chan]);
+            const __m128 b = _mm_loadu_ps(&frame[chan + chans]);
+            _mm_storeu_ps(&dst[chan], _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), interp4)));
+        }
+
+        for (; chan < chans; chan++) {
+            dst[chan] = frame[chan] + ((frame[chan + chans] - frame[chan]) * interp);
+        }
+
+        dst += chans;
+    }
+}
+
+static void SDL_TARGETING("sse") ResampleCubic_SSE(int chans, const float *src, int inframes, float *dst, int outframes,
+                                                   Sint64 srcpos, Sint64 resample_rate)
+{
+    int i, chan;
+
+    for (i = 0; i < outframes; i++) {
+        const int srcindex = (int)(Sint32)(srcpos >> 32);
+        const float *filter = GetCubicResamplerFilter(srcpos);
+        srcpos += resample_rate;
+
+        SDL_assert(srcindex >= -1 && srcindex < inframes);
+
+        const float *frame = &src[(srcindex - 1) * chans];
+        const __m128 f = _mm_loadu_ps(filter);
+
+        if (chans == 1) {
+            __m128 sum = _mm_mul_ps(f, _mm_loadu_ps(frame));
+            sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+            sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+            _mm_store_ss(dst, sum);
+        } else if (chans == 2) {
+            // Duplicate each of the weights, to match the interleaved channels
+            const __m128 f0 = _mm_unpacklo_ps(f, f);
+            const __m128 f1 = _mm_unpackhi_ps(f, f);
+            __m128 sum = _mm_add_ps(_mm_mul_ps(f0, _mm_loadu_ps(frame)), _mm_mul_ps(f1, _mm_loadu_ps(frame + 4)));
+            sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+            _mm_storel_pi((__m64 *)dst, sum);
+        } else {
+            const __m128 w0 = _mm_shuffle_ps(f, f, _MM_SHUFFLE(0, 0, 0, 0));
+            const __m128 w1 = _mm_shuffle_ps(f, f, _MM_SHUFFLE(1, 1, 1, 1));
+            const __m128 w2 = _mm_shuffle_ps(f, f, _MM_SHUFFLE(2, 2, 2, 2));
+            const __m128 w3 = _mm_shuffle_ps(f, f, _MM_SHUFFLE(3, 3, 3, 3));
+
+            for (chan = 0; chan + 4 <= chans; chan += 4) {
+                __m128 sum = _mm_mul_ps(_mm_loadu_ps(&frame[chan]), w0);
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(&frame[chan + chans]), w1));
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(&frame[chan + (chans * 2)]), w2));
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(&frame[chan + (chans * 3)]), w3));
+                _mm_storeu_ps(&dst[chan], sum);
+            }
+
+            for (; chan < chans; chan++) {
+                dst[chan] = (frame[chan] * filter[0]) + (frame[chan + chans] * filter[1]) +
+                            (frame[chan + (chans * 2)] * filter[2]) + (frame[chan + (chans * 3)] * filter[3]);
+            }
+        }
+
+        dst += chans;
+    }
+}
+#endif
+
+static void (*ResampleLinear)(int chans, const float *src, int inframes, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate);
+static void (*ResampleCubic)(int chans, const float *src, int inframes, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate);
+
 static void (*ResampleFrame)(const float *src, float *dst, const float *raw_filter, float interp, int chans);
 
 static float FullResamplerFilter[RESAMPLER_FULL_FILTER_SIZE];
@@ -214,11 +401,25 @@ void SDL_SetupAudioResampler(void)
         FullResamplerFilter[rwing] = 0.0f;
     }
 
+    for (i = 0; i <= CUBIC_RESAMPLER_PHASES; ++i) {
+        const float t = (float)i / CUBIC_RESAMPLER_PHASES;
+        float *weights = &CubicResamplerFilter[i * 4];
+
+        weights[0] = (((2.0f - t) * t) - 1.0f) * t * 0.5f;
+        weights[1] = ((((3.0f * t) - 5.0f) * t * t) + 2.0f) * 0.5f;
+        weights[2] = ((((4.0f - (3.0f * t)) * t) + 1.0f) * t) * 0.5f;
+        weights[3] = (t - 1.0f) * t * t * 0.5f;
+    }
+
     ResampleFrame = ResampleFrame_Scalar;
+    ResampleLinear = ResampleLinear_Scalar;
+    ResampleCubic = ResampleCubic_Scalar;
 
 #ifdef SDL_SSE_INTRINSICS
     if (SDL_HasSSE()) {
         ResampleFrame = ResampleFrame_SSE;
+        ResampleLinear = ResampleLinear_SSE;
+        ResampleCubic = ResampleCubic_SSE;
     }
 #endif
 
@@ -243,11 +444,24 @@ int SDL_GetResamplerHistoryFrames(void)
     return RESAMPLER_MAX_PADDING_FRAMES;
 }
 
-int SDL_GetResamplerPaddingFrames(Sint64 resample_rate)
+int SDL_GetResamplerPaddingFrames(Sint64 resample_rate, SDL_AudioResampleQuality quality)
 {
     // This must always be <= SDL_GetResamplerHistoryFrames()
 
-    return resample_rate ? RESAMPLER_MAX_PADDING_FRAMES : 0;
+    if (!resample_rate) {
+        return 0;
+    }
+
+    // Note, when upsampling, it is possible to start sampling from `srcpos = -1`.
+    switch (quality) {
+    case SDL_AUDIO_RESAMPLE_QUALITY_ZERO_ORDER_HOLD:
+    case SDL_AUDIO_RESAMPLE_QUALITY_LINEAR:
+        return 1;  // samples `srcpos` and `srcpos + 1`
+    case SDL_AUDIO_RESAMPLE_QUALITY_CUBIC:
+        return 2;  // samples `srcpos - 1` to `srcpos + 2`
+    default:
+        return RESAMPLER_MAX_PADDING_FRAMES;
+    }
 }
 
 // These are not general purpose. They do not check for all possible underflow/overflow
@@ -307,13 +521,10 @@ Sint64 SDL_GetResamplerOutputFrames(Sint64 input_frames, Sint64 resample_rate, S
     return output_frames;
 }
 
-void SDL_ResampleAudio(int chans, const float *src, int inframes, float *dst, int outframes,
-                       Sint64 resample_rate, Sint64 *inout_resample_offset)
+static void ResampleHigh(int chans, const float *src, int inframes, float *dst, int outframes,
+                         Sint64 srcpos, Sint64 resample_rate)
 {
     int i;
-    Sint64 srcpos = *inout_resample_offset;
-
-    SDL_assert(resample_rate > 0);
 
     for (i = 0; i < outframes; i++) {
         int srcindex = (int)(Sint32)(srcpos >> 32);
@@ -330,6 +541,29 @@ void SDL_ResampleAudio(int chans, const float *src, int inframes, float *dst, in
 
         dst += chans;
     }
+}
+
+void SDL_ResampleAudio(int chans, const float *src, int inframes, float *dst, int outframes,
+                       Sint64 resample_rate, Sint64 *inout_resample_offset, SDL_AudioResampleQuality quality)
+{
+    const Sint64 srcpos = *inout_resample_offset;
+
+    SDL_assert(resample_rate > 0);
+
+    switch (quality) {
+    case SDL_AUDIO_RESAMPLE_QUALITY_ZERO_ORDER_HOLD:
+        ResampleZeroOrderHold(chans, src, inframes, dst, outframes, srcpos, resample_rate);
+        break;
+    case SDL_AUDIO_RESAMPLE_QUALITY_LINEAR:
+        ResampleLinear(chans, src, inframes, dst, outframes, srcpos, resample_rate);
+        break;
+    case SDL_AUDIO_RESAMPLE_QUALITY_CUBIC:
+        ResampleCubic(chans, src, inframes, dst, outframes, srcpos, resample_rate);
+        break;
+    default:
+        ResampleHigh(chans, src, inframes, dst, outframes, srcpos, resample_rate);
+        break;
+    }
 
-    *inout_resample_offset = srcpos - ((Sint64)inframes << 32);
+    *inout_resample_offset = srcpos + (outframes * resample_rate) - ((Sint64)inframes << 32);
 }
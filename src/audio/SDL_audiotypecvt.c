@@ -184,6 +184,28 @@ static void SDL_Convert_F32_to_S32_Scalar(Sint32 *dst, const float *src, int num
 
 #undef SIGNMASK
 
+static void SDL_Convert_Swap16_Scalar(Uint16 *dst, const Uint16 *src, int num_samples)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("16-bit", "byteswapped 16-bit");
+
+    for (i = 0; i < num_samples; ++i) {
+        dst[i] = SDL_Swap16(src[i]);
+    }
+}
+
+static void SDL_Convert_Swap32_Scalar(Uint32 *dst, const Uint32 *src, int num_samples)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("32-bit", "byteswapped 32-bit");
+
+    for (i = 0; i < num_samples; ++i) {
+        dst[i] = SDL_Swap32(src[i]);
+    }
+}
+
 // end fallback scalar converters
 
 #ifdef SDL_SSE2_INTRINSICS
@@ -522,6 +544,587 @@ static void SDL_TARGETING("sse2") SDL_Convert_F32_to_S32_SSE2(Sint32 *dst, const
         ++dst;
     }
 }
+
+/* SSE2 has no byte shuffle, so swap the bytes of each 16-bit lane with shifts, after swapping
+   the 16-bit halves of each 32-bit lane for Swap32. dst may be the same buffer as src. */
+static void SDL_TARGETING("sse2") SDL_Convert_Swap16_SSE2(Uint16 *dst, const Uint16 *src, int num_samples)
+{
+    int i = num_samples;
+
+    LOG_DEBUG_AUDIO_CONVERT("16-bit", "byteswapped 16-bit (using SSE2)");
+
+    while (i >= 16) {
+        const __m128i ints1 = _mm_loadu_si128((const __m128i *)&src[0]);
+        const __m128i ints2 = _mm_loadu_si128((const __m128i *)&src[8]);
+
+        _mm_storeu_si128((__m128i *)&dst[0], _mm_or_si128(_mm_slli_epi16(ints1, 8), _mm_srli_epi16(ints1, 8)));
+        _mm_storeu_si128((__m128i *)&dst[8], _mm_or_si128(_mm_slli_epi16(ints2, 8), _mm_srli_epi16(ints2, 8)));
+
+        i -= 16;
+        src += 16;
+        dst += 16;
+    }
+
+    SDL_Convert_Swap16_Scalar(dst, src, i);
+}
+
+static void SDL_TARGETING("sse2") SDL_Convert_Swap32_SSE2(Uint32 *dst, const Uint32 *src, int num_samples)
+{
+    int i = num_samples;
+
+    LOG_DEBUG_AUDIO_CONVERT("32-bit", "byteswapped 32-bit (using SSE2)");
+
+    while (i >= 8) {
+        __m128i ints1 = _mm_loadu_si128((const __m128i *)&src[0]);
+        __m128i ints2 = _mm_loadu_si128((const __m128i *)&src[4]);
+
+        ints1 = _mm_shufflehi_epi16(_mm_shufflelo_epi16(ints1, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+        ints2 = _mm_shufflehi_epi16(_mm_shufflelo_epi16(ints2, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+
+        _mm_storeu_si128((__m128i *)&dst[0], _mm_or_si128(_mm_slli_epi16(ints1, 8), _mm_srli_epi16(ints1, 8)));
+        _mm_storeu_si128((__m128i *)&dst[4], _mm_or_si128(_mm_slli_epi16(ints2, 8), _mm_srli_epi16(ints2, 8)));
+
+        i -= 8;
+        src += 8;
+        dst += 8;
+    }
+
+    SDL_Convert_Swap32_Scalar(dst, src, i);
+}
+#endif
+
+/* The AVX2 and AVX-512 converters do the same math as the SSE2 ones, just on wider registers, so they produce
+   exactly the same output. Leftovers (fewer samples than a full block) are passed down to the next narrower version. */
+#if defined(SDL_AVX2_INTRINSICS) && defined(SDL_SSE2_INTRINSICS)
+static void SDL_TARGETING("avx2") SDL_Convert_S8_to_F32_AVX2(float *dst, const Sint8 *src, int num_samples)
+{
+    int i = num_samples;
+
+    // dst[i] = i2f((src[i] ^ 0x80) | 0x47800000) - 65537.0
+    const __m128i flipper = _mm_set1_epi8(-0x80);
+    const __m256i caster = _mm256_set1_epi32(0x47800000 /* f2i(65536.0) */);
+    const __m256 offset = _mm256_set1_ps(-65537.0);
+
+    LOG_DEBUG_AUDIO_CONVERT("S8", "F32 (using AVX2)");
+
+    while (i >= 32) {
+        i -= 32;
+
+        const __m128i bytes1 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&src[i]), flipper);
+        const __m128i bytes2 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&src[i + 16]), flipper);
+
+        const __m256 floats1 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_cvtepu8_epi32(bytes1), caster)), offset);
+        const __m256 floats2 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_cvtepu8_epi32(_mm_srli_si128(bytes1, 8)), caster)), offset);
+        const __m256 floats3 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_cvtepu8_epi32(bytes2), caster)), offset);
+        const __m256 floats4 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_cvtepu8_epi32(_mm_srli_si128(bytes2, 8)), caster)), offset);
+
+        _mm256_storeu_ps(&dst[i], floats1);
+        _mm256_storeu_ps(&dst[i + 8], floats2);
+        _mm256_storeu_ps(&dst[i + 16], floats3);
+        _mm256_storeu_ps(&dst[i + 24], floats4);
+    }
+
+    SDL_Convert_S8_to_F32_SSE2(dst, src, i);
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_U8_to_F32_AVX2(float *dst, const Uint8 *src, int num_samples)
+{
+    int i = num_samples;
+
+    // dst[i] = i2f(src[i] | 0x47800000) - 65537.0
+    const __m256i caster = _mm256_set1_epi32(0x47800000 /* f2i(65536.0) */);
+    const __m256 offset = _mm256_set1_ps(-65537.0);
+
+    LOG_DEBUG_AUDIO_CONVERT("U8", "F32 (using AVX2)");
+
+    while (i >= 32) {
+        i -= 32;
+
+        const __m128i bytes1 = _mm_loadu_si128((const __m128i *)&src[i]);
+        const __m128i bytes2 = _mm_loadu_si128((const __m128i *)&src[i + 16]);
+
+        const __m256 floats1 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_cvtepu8_epi32(bytes1), caster)), offset);
+        const __m256 floats2 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_cvtepu8_epi32(_mm_srli_si128(bytes1, 8)), caster)), offset);
+        const __m256 floats3 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_cvtepu8_epi32(bytes2), caster)), offset);
+        const __m256 floats4 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_or_si256(_mm256_cvtepu8_epi32(_mm_srli_si128(bytes2, 8)), caster)), offset);
+
+        _mm256_storeu_ps(&dst[i], floats1);
+        _mm256_storeu_ps(&dst[i + 8], floats2);
+        _mm256_storeu_ps(&dst[i + 16], floats3);
+        _mm256_storeu_ps(&dst[i + 24], floats4);
+    }
+
+    SDL_Convert_U8_to_F32_SSE2(dst, src, i);
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_S16_to_F32_AVX2(float *dst, const Sint16 *src, int num_samples)
+{
+    int i = num_samples;
+
+    // dst[i] = i2f((src[i] ^ 0x8000) | 0x43800000) - 257.0
+    const __m256i caster = _mm256_set1_epi32(0x43808000 /* f2i(256.0) | 0x8000 */);
+    const __m256 offset = _mm256_set1_ps(-257.0f);
+
+    LOG_DEBUG_AUDIO_CONVERT("S16", "F32 (using AVX2)");
+
+    while (i >= 32) {
+        i -= 32;
+
+        const __m256i shorts1 = _mm256_loadu_si256((const __m256i *)&src[i]);
+        const __m256i shorts2 = _mm256_loadu_si256((const __m256i *)&src[i + 16]);
+
+        const __m256 floats1 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_xor_si256(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(shorts1)), caster)), offset);
+        const __m256 floats2 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_xor_si256(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(shorts1, 1)), caster)), offset);
+        const __m256 floats3 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_xor_si256(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(shorts2)), caster)), offset);
+        const __m256 floats4 = _mm256_add_ps(_mm256_castsi256_ps(_mm256_xor_si256(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(shorts2, 1)), caster)), offset);
+
+        _mm256_storeu_ps(&dst[i], floats1);
+        _mm256_storeu_ps(&dst[i + 8], floats2);
+        _mm256_storeu_ps(&dst[i + 16], floats3);
+        _mm256_storeu_ps(&dst[i + 24], floats4);
+    }
+
+    SDL_Convert_S16_to_F32_SSE2(dst, src, i);
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_S32_to_F32_AVX2(float *dst, const Sint32 *src, int num_samples)
+{
+    int i = num_samples;
+
+    // dst[i] = f32(src[i]) / f32(0x80000000)
+    const __m256 scaler = _mm256_set1_ps(DIVBY2147483648);
+
+    LOG_DEBUG_AUDIO_CONVERT("S32", "F32 (using AVX2)");
+
+    while (i >= 32) {
+        i -= 32;
+
+        const __m256i ints1 = _mm256_loadu_si256((const __m256i *)&src[i]);
+        const __m256i ints2 = _mm256_loadu_si256((const __m256i *)&src[i + 8]);
+        const __m256i ints3 = _mm256_loadu_si256((const __m256i *)&src[i + 16]);
+        const __m256i ints4 = _mm256_loadu_si256((const __m256i *)&src[i + 24]);
+
+        _mm256_storeu_ps(&dst[i], _mm256_mul_ps(_mm256_cvtepi32_ps(ints1), scaler));
+        _mm256_storeu_ps(&dst[i + 8], _mm256_mul_ps(_mm256_cvtepi32_ps(ints2), scaler));
+        _mm256_storeu_ps(&dst[i + 16], _mm256_mul_ps(_mm256_cvtepi32_ps(ints3), scaler));
+        _mm256_storeu_ps(&dst[i + 24], _mm256_mul_ps(_mm256_cvtepi32_ps(ints4), scaler));
+    }
+
+    SDL_Convert_S32_to_F32_SSE2(dst, src, i);
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_F32_to_S8_AVX2(Sint8 *dst, const float *src, int num_samples)
+{
+    int i = num_samples;
+
+    // dst[i] = clamp(i16(f2i(src[i] + 98304.0) & 0xFFFF), -128, 127)
+    const __m256 offset = _mm256_set1_ps(98304.0f);
+    const __m256i mask = _mm256_set1_epi16(0xFF);
+    // packing works within 128-bit lanes, this puts the groups of 4 samples back in order.
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    LOG_DEBUG_AUDIO_CONVERT("F32", "S8 (using AVX2)");
+
+    while (i >= 32) {
+        const __m256i ints1 = _mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[0]), offset));
+        const __m256i ints2 = _mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[8]), offset));
+        const __m256i ints3 = _mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[16]), offset));
+        const __m256i ints4 = _mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[24]), offset));
+
+        const __m256i shorts1 = _mm256_and_si256(_mm256_packs_epi16(ints1, ints2), mask);
+        const __m256i shorts2 = _mm256_and_si256(_mm256_packs_epi16(ints3, ints4), mask);
+
+        const __m256i bytes = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(shorts1, shorts2), order);
+
+        _mm256_storeu_si256((__m256i *)dst, bytes);
+
+        i -= 32;
+        src += 32;
+        dst += 32;
+    }
+
+    SDL_Convert_F32_to_S8_SSE2(dst, src, i);
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_F32_to_U8_AVX2(Uint8 *dst, const float *src, int num_samples)
+{
+    int i = num_samples;
+
+    // dst[i] = clamp(i16(f2i(src[i] + 98305.0) & 0xFFFF), 0, 255)
+    const __m256 offset = _mm256_set1_ps(98305.0f);
+    const __m256i mask = _mm256_set1_epi16(0xFF);
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    LOG_DEBUG_AUDIO_CONVERT("F32", "U8 (using AVX2)");
+
+    while (i >= 32) {
+        const __m256i ints1 = _mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[0]), offset));
+        const __m256i ints2 = _mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[8]), offset));
+        const __m256i ints3 = _mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[16]), offset));
+        const __m256i ints4 = _mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[24]), offset));
+
+        const __m256i shorts1 = _mm256_and_si256(_mm256_packus_epi16(ints1, ints2), mask);
+        const __m256i shorts2 = _mm256_and_si256(_mm256_packus_epi16(ints3, ints4), mask);
+
+        const __m256i bytes = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(shorts1, shorts2), order);
+
+        _mm256_storeu_si256((__m256i *)dst, bytes);
+
+        i -= 32;
+        src += 32;
+        dst += 32;
+    }
+
+    SDL_Convert_F32_to_U8_SSE2(dst, src, i);
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_F32_to_S16_AVX2(Sint16 *dst, const float *src, int num_samples)
+{
+    int i = num_samples;
+
+    // dst[i] = clamp(f2i(src[i] + 257.0) - 0x43808000, -32768, 32767)
+    const __m256 offset = _mm256_set1_ps(257.0f);
+
+    LOG_DEBUG_AUDIO_CONVERT("F32", "S16 (using AVX2)");
+
+    while (i >= 32) {
+        const __m256i ints1 = _mm256_sub_epi32(_mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[0]), offset)), _mm256_castps_si256(offset));
+        const __m256i ints2 = _mm256_sub_epi32(_mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[8]), offset)), _mm256_castps_si256(offset));
+        const __m256i ints3 = _mm256_sub_epi32(_mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[16]), offset)), _mm256_castps_si256(offset));
+        const __m256i ints4 = _mm256_sub_epi32(_mm256_castps_si256(_mm256_add_ps(_mm256_loadu_ps(&src[24]), offset)), _mm256_castps_si256(offset));
+
+        // packing works within 128-bit lanes, so swap the middle 64-bit groups back in order.
+        const __m256i shorts1 = _mm256_permute4x64_epi64(_mm256_packs_epi32(ints1, ints2), 0xD8);
+        const __m256i shorts2 = _mm256_permute4x64_epi64(_mm256_packs_epi32(ints3, ints4), 0xD8);
+
+        _mm256_storeu_si256((__m256i *)&dst[0], shorts1);
+        _mm256_storeu_si256((__m256i *)&dst[16], shorts2);
+
+        i -= 32;
+        src += 32;
+        dst += 32;
+    }
+
+    SDL_Convert_F32_to_S16_SSE2(dst, src, i);
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_F32_to_S32_AVX2(Sint32 *dst, const float *src, int num_samples)
+{
+    int i = num_samples;
+
+    // dst[i] = i32(src[i] * 2147483648.0) ^ ((src[i] >= 2147483648.0) ? 0xFFFFFFFF : 0x00000000)
+    const __m256 limit = _mm256_set1_ps(2147483648.0f);
+
+    LOG_DEBUG_AUDIO_CONVERT("F32", "S32 (using AVX2)");
+
+    while (i >= 32) {
+        const __m256 values1 = _mm256_mul_ps(_mm256_loadu_ps(&src[0]), limit);
+        const __m256 values2 = _mm256_mul_ps(_mm256_loadu_ps(&src[8]), limit);
+        const __m256 values3 = _mm256_mul_ps(_mm256_loadu_ps(&src[16]), limit);
+        const __m256 values4 = _mm256_mul_ps(_mm256_loadu_ps(&src[24]), limit);
+
+        const __m256i ints1 = _mm256_xor_si256(_mm256_cvttps_epi32(values1), _mm256_castps_si256(_mm256_cmp_ps(values1, limit, _CMP_GE_OS)));
+        const __m256i ints2 = _mm256_xor_si256(_mm256_cvttps_epi32(values2), _mm256_castps_si256(_mm256_cmp_ps(values2, limit, _CMP_GE_OS)));
+        const __m256i ints3 = _mm256_xor_si256(_mm256_cvttps_epi32(values3), _mm256_castps_si256(_mm256_cmp_ps(values3, limit, _CMP_GE_OS)));
+        const __m256i ints4 = _mm256_xor_si256(_mm256_cvttps_epi32(values4), _mm256_castps_si256(_mm256_cmp_ps(values4, limit, _CMP_GE_OS)));
+
+        _mm256_storeu_si256((__m256i *)&dst[0], ints1);
+        _mm256_storeu_si256((__m256i *)&dst[8], ints2);
+        _mm256_storeu_si256((__m256i *)&dst[16], ints3);
+        _mm256_storeu_si256((__m256i *)&dst[24], ints4);
+
+        i -= 32;
+        src += 32;
+        dst += 32;
+    }
+
+    SDL_Convert_F32_to_S32_SSE2(dst, src, i);
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_Swap16_AVX2(Uint16 *dst, const Uint16 *src, int num_samples)
+{
+    int i = num_samples;
+
+    const __m256i shuffle = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                                             1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+
+    LOG_DEBUG_AUDIO_CONVERT("16-bit", "byteswapped 16-bit (using AVX2)");
+
+    while (i >= 32) {
+        const __m256i ints1 = _mm256_loadu_si256((const __m256i *)&src[0]);
+        const __m256i ints2 = _mm256_loadu_si256((const __m256i *)&src[16]);
+
+        _mm256_storeu_si256((__m256i *)&dst[0], _mm256_shuffle_epi8(ints1, shuffle));
+        _mm256_storeu_si256((__m256i *)&dst[16], _mm256_shuffle_epi8(ints2, shuffle));
+
+        i -= 32;
+        src += 32;
+        dst += 32;
+    }
+
+    SDL_Convert_Swap16_SSE2(dst, src, i);
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert_Swap32_AVX2(Uint32 *dst, const Uint32 *src, int num_samples)
+{
+    int i = num_samples;
+
+    const __m256i shuffle = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                             3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+    LOG_DEBUG_AUDIO_CONVERT("32-bit", "byteswapped 32-bit (using AVX2)");
+
+    while (i >= 16) {
+        const __m256i ints1 = _mm256_loadu_si256((const __m256i *)&src[0]);
+        const __m256i ints2 = _mm256_loadu_si256((const __m256i *)&src[8]);
+
+        _mm256_storeu_si256((__m256i *)&dst[0], _mm256_shuffle_epi8(ints1, shuffle));
+        _mm256_storeu_si256((__m256i *)&dst[8], _mm256_shuffle_epi8(ints2, shuffle));
+
+        i -= 16;
+        src += 16;
+        dst += 16;
+    }
+
+    SDL_Convert_Swap32_SSE2(dst, src, i);
+}
+
+#ifdef SDL_AVX512F_INTRINSICS
+/* AVX-512F has no 8-bit or 16-bit packing, but it can narrow 32-bit lanes with saturation,
+   which gives the same results as the SSE2 pack instructions. */
+static void SDL_TARGETING("avx512f") SDL_Convert_S8_to_F32_AVX512(float *dst, const Sint8 *src, int num_samples)
+{
+    int i = num_samples;
+
+    // dst[i] = i2f((src[i] ^ 0x80) | 0x47800000) - 65537.0
+    const __m512i caster = _mm512_set1_epi32(0x47800080 /* f2i(65536.0) | 0x80 */);
+    const __m512 offset = _mm512_set1_ps(-65537.0);
+
+    LOG_DEBUG_AUDIO_CONVERT("S8", "F32 (using AVX-512)");
+
+    while (i >= 64) {
+        i -= 64;
+
+        const __m128i bytes1 = _mm_loadu_si128((const __m128i *)&src[i]);
+        const __m128i bytes2 = _mm_loadu_si128((const __m128i *)&src[i + 16]);
+        const __m128i bytes3 = _mm_loadu_si128((const __m128i *)&src[i + 32]);
+        const __m128i bytes4 = _mm_loadu_si128((const __m128i *)&src[i + 48]);
+
+        _mm512_storeu_ps(&dst[i], _mm512_add_ps(_mm512_castsi512_ps(_mm512_xor_si512(_mm512_cvtepu8_epi32(bytes1), caster)), offset));
+        _mm512_storeu_ps(&dst[i + 16], _mm512_add_ps(_mm512_castsi512_ps(_mm512_xor_si512(_mm512_cvtepu8_epi32(bytes2), caster)), offset));
+        _mm512_storeu_ps(&dst[i + 32], _mm512_add_ps(_mm512_castsi512_ps(_mm512_xor_si512(_mm512_cvtepu8_epi32(bytes3), caster)), offset));
+        _mm512_storeu_ps(&dst[i + 48], _mm512_add_ps(_mm512_castsi512_ps(_mm512_xor_si512(_mm512_cvtepu8_epi32(bytes4), caster)), offset));
+    }
+
+    SDL_Convert_S8_to_F32_AVX2(dst, src, i);
+}
+
+static void SDL_TARGETING("avx512f") SDL_Convert_U8_to_F32_AVX512(float *dst, const Uint8 *src, int num_samples)
+{
+    int i = num_samples;
+
+    // dst[i] = i2f(src[i] | 0x47800000) - 65537.0
+    const __m512i caster = _mm512_set1_epi32(0x47800000 /* f2i(65536.0) */);
+    const __m512 offset = _mm512_set1_ps(-65537.0);
+
+    LOG_DEBUG_AUDIO_CONVERT("U8", "F32 (using AVX-512)");
+
+    while (i >= 64) {
+        i -= 64;
+
+        const __m128i bytes1 = _mm_loadu_si128((const __m128i *)&src[i]);
+        const __m128i bytes2 = _mm_loadu_si128((const __m128i *)&src[i + 16]);
+        const __m128i bytes3 = _mm_loadu_si128((const __m128i *)&src[i + 32]);
+        const __m128i bytes4 = _mm_loadu_si128((const __m128i *)&src[i + 48]);
+
+        _mm512_storeu_ps(&dst[i], _mm512_add_ps(_mm512_castsi512_ps(_mm512_or_si512(_mm512_cvtepu8_epi32(bytes1), caster)), offset));
+        _mm512_storeu_ps(&dst[i + 16], _mm512_add_ps(_mm512_castsi512_ps(_mm512_or_si512(_mm512_cvtepu8_epi32(bytes2), caster)), offset));
+        _mm512_storeu_ps(&dst[i + 32], _mm512_add_ps(_mm512_castsi512_ps(_mm512_or_si512(_mm512_cvtepu8_epi32(bytes3), caster)), offset));
+        _mm512_storeu_ps(&dst[i + 48], _mm512_add_ps(_mm512_castsi512_ps(_mm512_or_si512(_mm512_cvtepu8_epi32(bytes4), caster)), offset));
+    }
+
+    SDL_Convert_U8_to_F32_AVX2(dst, src, i);
+}
+
+static void SDL_TARGETING("avx512f") SDL_Convert_S16_to_F32_AVX512(float *dst, const Sint16 *src, int num_samples)
+{
+    int i = num_samples;
+
+    // dst[i] = i2f((src[i] ^ 0x8000) | 0x43800000) - 257.0
+    const __m512i caster = _mm512_set1_epi32(0x43808000 /* f2i(256.0) | 0x8000 */);
+    const __m512 offset = _mm512_set1_ps(-257.0f);
+
+    LOG_DEBUG_AUDIO_CONVERT("S16", "F32 (using AVX-512)");
+
+    while (i >= 64) {
+        i -= 64;
+
+        const __m256i shorts1 = _mm256_loadu_si256((const __m256i *)&src[i]);
+        const __m256i shorts2 = _mm256_loadu_si256((const __m256i *)&src[i + 16]);
+        const __m256i shorts3 = _mm256_loadu_si256((const __m256i *)&src[i + 32]);
+        const __m256i shorts4 = _mm256_loadu_si256((const __m256i *)&src[i + 48]);
+
+        _mm512_storeu_ps(&dst[i], _mm512_add_ps(_mm512_castsi512_ps(_mm512_xor_si512(_mm512_cvtepu16_epi32(shorts1), caster)), offset));
+        _mm512_storeu_ps(&dst[i + 16], _mm512_add_ps(_mm512_castsi512_ps(_mm512_xor_si512(_mm512_cvtepu16_epi32(shorts2), caster)), offset));
+        _mm512_storeu_ps(&dst[i + 32], _mm512_add_ps(_mm512_castsi512_ps(_mm512_xor_si512(_mm512_cvtepu16_epi32(shorts3), caster)), offset));
+        _mm512_storeu_ps(&dst[i + 48], _mm512_add_ps(_mm512_castsi512_ps(_mm512_xor_si512(_mm512_cvtepu16_epi32(shorts4), caster)), offset));
+    }
+
+    SDL_Convert_S16_to_F32_AVX2(dst, src, i);
+}
+
+static void SDL_TARGETING("avx512f") SDL_Convert_S32_to_F32_AVX512(float *dst, const Sint32 *src, int num_samples)
+{
+    int i = num_samples;
+
+    // dst[i] = f32(src[i]) / f32(0x80000000)
+    const __m512 scaler = _mm512_set1_ps(DIVBY2147483648);
+
+    LOG_DEBUG_AUDIO_CONVERT("S32", "F32 (using AVX-512)");
+
+    while (i >= 64) {
+        i -= 64;
+
+        const __m512i ints1 = _mm512_loadu_si512((const void *)&src[i]);
+        const __m512i ints2 = _mm512_loadu_si512((const void *)&src[i + 16]);
+        const __m512i ints3 = _mm512_loadu_si512((const void *)&src[i + 32]);
+        const __m512i ints4 = _mm512_loadu_si512((const void *)&src[i + 48]);
+
+        _mm512_storeu_ps(&dst[i], _mm512_mul_ps(_mm512_cvtepi32_ps(ints1), scaler));
+        _mm512_storeu_ps(&dst[i + 16], _mm512_mul_ps(_mm512_cvtepi32_ps(ints2), scaler));
+        _mm512_storeu_ps(&dst[i + 32], _mm512_mul_ps(_mm512_cvtepi32_ps(ints3), scaler));
+        _mm512_storeu_ps(&dst[i + 48], _mm512_mul_ps(_mm512_cvtepi32_ps(ints4), scaler));
+    }
+
+    SDL_Convert_S32_to_F32_AVX2(dst, src, i);
+}
+
+static void SDL_TARGETING("avx512f") SDL_Convert_F32_to_S8_AVX512(Sint8 *dst, const float *src, int num_samples)
+{
+    int i = num_samples;
+
+    /* dst[i] = clamp(i16(f2i(src[i] + 98304.0) & 0xFFFF), -128, 127)
+     * The low 16 bits are sign-extended, then narrowed with signed saturation. */
+    const __m512 offset = _mm512_set1_ps(98304.0f);
+
+    LOG_DEBUG_AUDIO_CONVERT("F32", "S8 (using AVX-512)");
+
+    while (i >= 64) {
+        const __m512i ints1 = _mm512_castps_si512(_mm512_add_ps(_mm512_loadu_ps(&src[0]), offset));
+        const __m512i ints2 = _mm512_castps_si512(_mm512_add_ps(_mm512_loadu_ps(&src[16]), offset));
+        const __m512i ints3 = _mm512_castps_si512(_mm512_add_ps(_mm512_loadu_ps(&src[32]), offset));
+        const __m512i ints4 = _mm512_castps_si512(_mm512_add_ps(_mm512_loadu_ps(&src[48]), offset));
+
+        _mm_storeu_si128((__m128i *)&dst[0], _mm512_cvtsepi32_epi8(_mm512_srai_epi32(_mm512_slli_epi32(ints1, 16), 16)));
+        _mm_storeu_si128((__m128i *)&dst[16], _mm512_cvtsepi32_epi8(_mm512_srai_epi32(_mm512_slli_epi32(ints2, 16), 16)));
+        _mm_storeu_si128((__m128i *)&dst[32], _mm512_cvtsepi32_epi8(_mm512_srai_epi32(_mm512_slli_epi32(ints3, 16), 16)));
+        _mm_storeu_si128((__m128i *)&dst[48], _mm512_cvtsepi32_epi8(_mm512_srai_epi32(_mm512_slli_epi32(ints4, 16), 16)));
+
+        i -= 64;
+        src += 64;
+        dst += 64;
+    }
+
+    SDL_Convert_F32_to_S8_AVX2(dst, src, i);
+}
+
+static void SDL_TARGETING("avx512f") SDL_Convert_F32_to_U8_AVX512(Uint8 *dst, const float *src, int num_samples)
+{
+    int i = num_samples;
+
+    /* dst[i] = clamp(i16(f2i(src[i] + 98305.0) & 0xFFFF), 0, 255)
+     * The low 16 bits are sign-extended, clamped, then narrowed. */
+    const __m512 offset = _mm512_set1_ps(98305.0f);
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i max = _mm512_set1_epi32(0xFF);
+
+    LOG_DEBUG_AUDIO_CONVERT("F32", "U8 (using AVX-512)");
+
+    while (i >= 64) {
+        const __m512i ints1 = _mm512_castps_si512(_mm512_add_ps(_mm512_loadu_ps(&src[0]), offset));
+        const __m512i ints2 = _mm512_castps_si512(_mm512_add_ps(_mm512_loadu_ps(&src[16]), offset));
+        const __m512i ints3 = _mm512_castps_si512(_mm512_add_ps(_mm512_loadu_ps(&src[32]), offset));
+        const __m512i ints4 = _mm512_castps_si512(_mm512_add_ps(_mm512_loadu_ps(&src[48]), offset));
+
+        _mm_storeu_si128((__m128i *)&dst[0], _mm512_cvtepi32_epi8(_mm512_min_epi32(_mm512_max_epi32(_mm512_srai_epi32(_mm512_slli_epi32(ints1, 16), 16), zero), max)));
+        _mm_storeu_si128((__m128i *)&dst[16], _mm512_cvtepi32_epi8(_mm512_min_epi32(_mm512_max_epi32(_mm512_srai_epi32(_mm512_slli_epi32(ints2, 16), 16), zero), max)));
+        _mm_storeu_si128((__m128i *)&dst[32], _mm512_cvtepi32_epi8(_mm512_min_epi32(_mm512_max_epi32(_mm512_srai_epi32(_mm512_slli_epi32(ints3, 16), 16), zero), max)));
+        _mm_storeu_si128((__m128i *)&dst[48], _mm512_cvtepi32_epi8(_mm512_min_epi32(_mm512_max_epi32(_mm512_srai_epi32(_mm512_slli_epi32(ints4, 16), 16), zero), max)));
+
+        i -= 64;
+        src += 64;
+        dst += 64;
+    }
+
+    SDL_Convert_F32_to_U8_AVX2(dst, src, i);
+}
+
+static void SDL_TARGETING("avx512f") SDL_Convert_F32_to_S16_AVX512(Sint16 *dst, const float *src, int num_samples)
+{
+    int i = num_samples;
+
+    // dst[i] = clamp(f2i(src[i] + 257.0) - 0x43808000, -32768, 32767)
+    const __m512 offset = _mm512_set1_ps(257.0f);
+
+    LOG_DEBUG_AUDIO_CONVERT("F32", "S16 (using AVX-512)");
+
+    while (i >= 64) {
+        const __m512i ints1 = _mm512_sub_epi32(_mm512_castps_si512(_mm512_add_ps(_mm512_loadu_ps(&src[0]), offset)), _mm512_castps_si512(offset));
+        const __m512i ints2 = _mm512_sub_epi32(_mm512_castps_si512(_mm512_add_ps(_mm512_loadu_ps(&src[16]), offset)), _mm512_castps_si512(offset));
+        const __m512i ints3 = _mm512_sub_epi32(_mm512_castps_si512(_mm512_add_ps(_mm512_loadu_ps(&src[32]), offset)), _mm512_castps_si512(offset));
+        const __m512i ints4 = _mm512_sub_epi32(_mm512_castps_si512(_mm512_add_ps(_mm512_loadu_ps(&src[48]), offset)), _mm512_castps_si512(offset));
+
+        _mm256_storeu_si256((__m256i *)&dst[0], _mm512_cvtsepi32_epi16(ints1));
+        _mm256_storeu_si256((__m256i *)&dst[16], _mm512_cvtsepi32_epi16(ints2));
+        _mm256_storeu_si256((__m256i *)&dst[32], _mm512_cvtsepi32_epi16(ints3));
+        _mm256_storeu_si256((__m256i *)&dst[48], _mm512_cvtsepi32_epi16(ints4));
+
+        i -= 64;
+        src += 64;
+        dst += 64;
+    }
+
+    SDL_Convert_F32_to_S16_AVX2(dst, src, i);
+}
+
+static void SDL_TARGETING("avx512f") SDL_Convert_F32_to_S32_AVX512(Sint32 *dst, const float *src, int num_samples)
+{
+    int i = num_samples;
+
+    // dst[i] = i32(src[i] * 2147483648.0) ^ ((src[i] >= 2147483648.0) ? 0xFFFFFFFF : 0x00000000)
+    const __m512 limit = _mm512_set1_ps(2147483648.0f);
+    const __m512i flipper = _mm512_set1_epi32(-1);
+
+    LOG_DEBUG_AUDIO_CONVERT("F32", "S32 (using AVX-512)");
+
+    while (i >= 64) {
+        const __m512 values1 = _mm512_mul_ps(_mm512_loadu_ps(&src[0]), limit);
+        const __m512 values2 = _mm512_mul_ps(_mm512_loadu_ps(&src[16]), limit);
+        const __m512 values3 = _mm512_mul_ps(_mm512_loadu_ps(&src[32]), limit);
+        const __m512 values4 = _mm512_mul_ps(_mm512_loadu_ps(&src[48]), limit);
+
+        const __m512i ints1 = _mm512_cvttps_epi32(values1);
+        const __m512i ints2 = _mm512_cvttps_epi32(values2);
+        const __m512i ints3 = _mm512_cvttps_epi32(values3);
+        const __m512i ints4 = _mm512_cvttps_epi32(values4);
+
+        _mm512_storeu_si512((void *)&dst[0], _mm512_mask_xor_epi32(ints1, _mm512_cmp_ps_mask(values1, limit, _CMP_GE_OS), ints1, flipper));
+        _mm512_storeu_si512((void *)&dst[16], _mm512_mask_xor_epi32(ints2, _mm512_cmp_ps_mask(values2, limit, _CMP_GE_OS), ints2, flipper));
+        _mm512_storeu_si512((void *)&dst[32], _mm512_mask_xor_epi32(ints3, _mm512_cmp_ps_mask(values3, limit, _CMP_GE_OS), ints3, flipper));
+        _mm512_storeu_si512((void *)&dst[48], _mm512_mask_xor_epi32(ints4, _mm512_cmp_ps_mask(values4, limit, _CMP_GE_OS), ints4, flipper));
+
+        i -= 64;
+        src += 64;
+        dst += 64;
+    }
+
+    SDL_Convert_F32_to_S32_AVX2(dst, src, i);
+}
+
+// Byte shuffles on 512-bit registers need AVX512BW, so this tier byteswaps with AVX2.
+#define SDL_Convert_Swap16_AVX512 SDL_Convert_Swap16_AVX2
+#define SDL_Convert_Swap32_AVX512 SDL_Convert_Swap32_AVX2
+#endif
 #endif
 
 #ifdef SDL_NEON_INTRINSICS
@@ -938,6 +1541,48 @@ static void SDL_Convert_F32_to_S32_NEON(Sint32 *dst, const float *src, int num_s
         dst++;
     }
 }
+
+static void SDL_Convert_Swap16_NEON(Uint16 *dst, const Uint16 *src, int num_samples)
+{
+    int i = num_samples;
+
+    LOG_DEBUG_AUDIO_CONVERT("16-bit", "byteswapped 16-bit (using NEON)");
+
+    while (i >= 16) {
+        const uint8x16_t bytes1 = vld1q_u8((const uint8_t *)&src[0]);
+        const uint8x16_t bytes2 = vld1q_u8((const uint8_t *)&src[8]);
+
+        vst1q_u8((uint8_t *)&dst[0], vrev16q_u8(bytes1));
+        vst1q_u8((uint8_t *)&dst[8], vrev16q_u8(bytes2));
+
+        i -= 16;
+        src += 16;
+        dst += 16;
+    }
+
+    SDL_Convert_Swap16_Scalar(dst, src, i);
+}
+
+static void SDL_Convert_Swap32_NEON(Uint32 *dst, const Uint32 *src, int num_samples)
+{
+    int i = num_samples;
+
+    LOG_DEBUG_AUDIO_CONVERT("32-bit", "byteswapped 32-bit (using NEON)");
+
+    while (i >= 8) {
+        const uint8x16_t bytes1 = vld1q_u8((const uint8_t *)&src[0]);
+        const uint8x16_t bytes2 = vld1q_u8((const uint8_t *)&src[4]);
+
+        vst1q_u8((uint8_t *)&dst[0], vrev32q_u8(bytes1));
+        vst1q_u8((uint8_t *)&dst[4], vrev32q_u8(bytes2));
+
+        i -= 8;
+        src += 8;
+        dst += 8;
+    }
+
+    SDL_Convert_Swap32_Scalar(dst, src, i);
+}
 #endif
 
 // Function pointers set to a CPU-specific implementation.
@@ -949,6 +1594,8 @@ void (*SDL_Convert_F32_to_S8)(Sint8 *dst, const float *src, int num_samples) = N
 void (*SDL_Convert_F32_to_U8)(Uint8 *dst, const float *src, int num_samples) = NULL;
 void (*SDL_Convert_F32_to_S16)(Sint16 *dst, const float *src, int num_samples) = NULL;
 void (*SDL_Convert_F32_to_S32)(Sint32 *dst, const float *src, int num_samples) = NULL;
+void (*SDL_Convert_Swap16)(Uint16 *dst, const Uint16 *src, int num_samples) = NULL;
+void (*SDL_Convert_Swap32)(Uint32 *dst, const Uint32 *src, int num_samples) = NULL;
 
 void SDL_ChooseAudioConverters(void)
 {
@@ -966,8 +1613,24 @@ void SDL_ChooseAudioConverters(void)
     SDL_Convert_F32_to_U8 = SDL_Convert_F32_to_U8_##fntype; \
     SDL_Convert_F32_to_S16 = SDL_Convert_F32_to_S16_##fntype; \
     SDL_Convert_F32_to_S32 = SDL_Convert_F32_to_S32_##fntype; \
+    SDL_Convert_Swap16 = SDL_Convert_Swap16_##fntype; \
+    SDL_Convert_Swap32 = SDL_Convert_Swap32_##fntype; \
     converters_chosen = SDL_TRUE
 
+#if defined(SDL_AVX512F_INTRINSICS) && defined(SDL_AVX2_INTRINSICS) && defined(SDL_SSE2_INTRINSICS)
+    if (SDL_HasAVX512F() && SDL_HasAVX2()) {
+        SET_CONVERTER_FUNCS(AVX512);
+        return;
+    }
+#endif
+
+#if defined(SDL_AVX2_INTRINSICS) && defined(SDL_SSE2_INTRINSICS)
+    if (SDL_HasAVX2()) {
+        SET_CONVERTER_FUNCS(AVX2);
+        return;
+    }
+#endif
+
 #ifdef SDL_SSE2_INTRINSICS
     if (SDL_HasSSE2()) {
         SET_CONVERTER_FUNCS(SSE2);
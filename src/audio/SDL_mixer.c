@@ -81,8 +81,792 @@ static const Uint8 mix8[] = {
 #define ADJUST_VOLUME(type, s, v) ((s) = (type)(((s) * (v)) / SDL_MIX_MAXVOLUME))
 #define ADJUST_VOLUME_U8(s, v)    ((s) = (Uint8)(((((s) - 128) * (v)) / SDL_MIX_MAXVOLUME) + 128))
 
+// The SIMD mixers below divide by SDL_MIX_MAXVOLUME with a shift.
+SDL_COMPILE_TIME_ASSERT(mix_maxvolume, SDL_MIX_MAXVOLUME == 128);
 
-// !!! FIXME: this needs some SIMD magic.
+/* These mix native-endian samples into `dst`, with `volume` in the range [1, SDL_MIX_MAXVOLUME].
+   Every implementation must produce exactly the same output as the scalar versions. */
+
+static void SDL_Mix_S16_Scalar(Sint16 *dst, const Sint16 *src, int num_samples, int volume)
+{
+    int i;
+
+    for (i = 0; i < num_samples; ++i) {
+        Sint16 src_sample = src[i];
+        ADJUST_VOLUME(Sint16, src_sample, volume);
+        dst[i] = (Sint16)SDL_clamp(dst[i] + src_sample, SDL_MIN_SINT16, SDL_MAX_SINT16);
+    }
+}
+
+static void SDL_Mix_S32_Scalar(Sint32 *dst, const Sint32 *src, int num_samples, int volume)
+{
+    int i;
+
+    for (i = 0; i < num_samples; ++i) {
+        Sint64 src_sample = src[i];
+        ADJUST_VOLUME(Sint64, src_sample, volume);
+        dst[i] = (Sint32)SDL_clamp(dst[i] + src_sample, SDL_MIN_SINT32, SDL_MAX_SINT32);
+    }
+}
+
+static void SDL_Mix_F32_Scalar(float *dst, const float *src, int num_samples, int volume)
+{
+    const float fmaxvolume = 1.0f / ((float)SDL_MIX_MAXVOLUME);
+    const float fvolume = (float)volume;
+    int i;
+
+    for (i = 0; i < num_samples; ++i) {
+        const float src_sample = (src[i] * fvolume) * fmaxvolume;
+        const double dst_sample = ((double)src_sample) + ((double)dst[i]);
+        dst[i] = (float)SDL_clamp(dst_sample, -3.402823466e+38F, 3.402823466e+38F);
+    }
+}
+
+/* Channel `c` of frame `f` gets scaled by `start_gains[c] + step_gains[c] * f`, counting frames from `first_frame`.
+   The SIMD versions compute the gains the same way, so they match this exactly. */
+static void SDL_Mix_F32_Gain_Frames(float *dst, const float *src, int first_frame, int num_frames, int channels, const float *start_gains, const float *step_gains)
+{
+    const int last_frame = first_frame + num_frames;
+    int i, c;
+
+    for (i = first_frame; i < last_frame; ++i) {
+        const float frame = (float)i;
+        for (c = 0; c < channels; ++c) {
+            const float src_sample = *(src++) * (start_gains[c] + (step_gains[c] * frame));
+            const double dst_sample = ((double)src_sample) + ((double)*dst);
+            *(dst++) = (float)SDL_clamp(dst_sample, -3.402823466e+38F, 3.402823466e+38F);
+        }
+    }
+}
+
+static void SDL_Mix_F32_Gain_Scalar(float *dst, const float *src, int num_frames, int channels, const float *start_gains, const float *step_gains)
+{
+    SDL_Mix_F32_Gain_Frames(dst, src, 0, num_frames, channels, start_gains, step_gains);
+}
+
+#if defined(SDL_SSE2_INTRINSICS) || defined(SDL_AVX2_INTRINSICS) || defined(SDL_NEON_INTRINSICS)
+#define MAX_GAIN_LANES 64  // lcm(channels, lanes) for up to 8 channels and 8 lanes.
+
+/* The channel each lane of a `lanes` wide vector lands on repeats every lcm(channels, lanes) samples, so lay
+   out the gains, steps and frame offsets for one such period. Returns the number of vectors in the period. */
+
+static int SDL_SetupGainLanes(int channels, int lanes, const float *start_gains, const float *step_gains, float *starts, float *steps, float *frames)
+{
+    int period = lanes;
+    int i;
+
+    SDL_assert((channels >= 1) && (channels <= 8));
+
+    while (period % channels) {
+        period += lanes;
+    }
+
+    SDL_assert(period <= MAX_GAIN_LANES);
+
+    for (i = 0; i < period; ++i) {
+        starts[i] = start_gains[i % channels];
+        steps[i] = step_gains[i % channels];
+        frames[i] = (float)(i / channels);
+    }
+
+    return period / lanes;
+}
+#endif
+
+/* Output channel `j` of each frame is the sum of input channel `k` times `matrix[j * src_channels + k]`, added up
+   in order of `k`. The SIMD versions add things up in the same order, so they match this exactly. */
+static void SDL_Remix_F32_Scalar(float *dst, const float *src, int num_frames, int src_channels, int dst_channels, const float *matrix)
+{
+    const SDL_bool backwards = (dst_channels > src_channels);  // convert backwards if the output is growing, in case this is in-place.
+    float frame[8];
+    int i, j, k;
+
+    SDL_assert((src_channels >= 1) && (src_channels <= 8));
+    SDL_assert((dst_channels >= 1) && (dst_channels <= 8));
+
+    for (i = 0; i < num_frames; ++i) {
+        const int frame_index = backwards ? (num_frames - 1 - i) : i;
+        const float *in = src + (frame_index * src_channels);
+        float *out = dst + (frame_index * dst_channels);
+
+        for (k = 0; k < src_channels; ++k) {
+            frame[k] = in[k];
+        }
+
+        for (j = 0; j < dst_channels; ++j) {
+            const float *row = matrix + (j * src_channels);
+            float sample = 0.0f;
+            for (k = 0; k < src_channels; ++k) {
+                sample += frame[k] * row[k];
+            }
+            out[j] = sample;
+        }
+    }
+}
+
+#if defined(SDL_SSE2_INTRINSICS) || defined(SDL_AVX2_INTRINSICS) || defined(SDL_NEON_INTRINSICS)
+/* Transposes a remix matrix into one vector of 8 coefficients per input channel, so an input sample can be
+   broadcast across a vector and multiplied by its column. Lane `l` gets output channel `l % width`, so a
+   `width` of dst_channels packs several frames into a vector; any lanes past dst_channels are zero. */
+static void SDL_SetupRemixColumns(int src_channels, int dst_channels, int width, const float *matrix, float *columns)
+{
+    int k, l;
+
+    for (k = 0; k < src_channels; ++k) {
+        for (l = 0; l < 8; ++l) {
+            const int j = l % width;
+            columns[(k * 8) + l] = (j < dst_channels) ? matrix[(j * src_channels) + k] : 0.0f;
+        }
+    }
+}
+#endif
+
+#ifdef SDL_SSE2_INTRINSICS
+static SDL_INLINE __m128i SDL_TARGETING("sse2") SDL_Scale_S16_SSE2(__m128i samples, __m128i volume)
+{
+    /* 1) Widen the products to 32 bits
+     * 2) Add (SDL_MIX_MAXVOLUME - 1) to negative products, so the shift rounds toward zero like an integer divide
+     * 3) Divide by SDL_MIX_MAXVOLUME and narrow back to 16 bits (no saturation happens, |result| <= |sample|) */
+    const __m128i bias = _mm_set1_epi32(SDL_MIX_MAXVOLUME - 1);
+    const __m128i lo = _mm_mullo_epi16(samples, volume);
+    const __m128i hi = _mm_mulhi_epi16(samples, volume);
+    __m128i ints1 = _mm_unpacklo_epi16(lo, hi);
+    __m128i ints2 = _mm_unpackhi_epi16(lo, hi);
+
+    ints1 = _mm_srai_epi32(_mm_add_epi32(ints1, _mm_and_si128(_mm_srai_epi32(ints1, 31), bias)), 7);
+    ints2 = _mm_srai_epi32(_mm_add_epi32(ints2, _mm_and_si128(_mm_srai_epi32(ints2, 31), bias)), 7);
+
+    return _mm_packs_epi32(ints1, ints2);
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse2") SDL_Scale_S32_SSE2(__m128i samples, __m128d volume)
+{
+    /* sample * (volume / SDL_MIX_MAXVOLUME) needs at most 40 bits of precision, so this is
+       exact in double precision, and truncation matches the scalar integer divide. */
+    const __m128i lo = _mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtepi32_pd(samples), volume));
+    const __m128i hi = _mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtepi32_pd(_mm_srli_si128(samples, 8)), volume));
+    return _mm_unpacklo_epi64(lo, hi);
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse2") SDL_Adds_S32_SSE2(__m128i a, __m128i b)
+{
+    // Signed overflow happened if a and b have the same sign, but the sum doesn't.
+    const __m128i sum = _mm_add_epi32(a, b);
+    const __m128i overflow = _mm_srai_epi32(_mm_andnot_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, sum)), 31);
+    const __m128i saturated = _mm_xor_si128(_mm_srai_epi32(a, 31), _mm_set1_epi32(SDL_MAX_SINT32));
+    return _mm_or_si128(_mm_and_si128(overflow, saturated), _mm_andnot_si128(overflow, sum));
+}
+
+static void SDL_TARGETING("sse2") SDL_Mix_S16_SSE2(Sint16 *dst, const Sint16 *src, int num_samples, int volume)
+{
+    const __m128i vol = _mm_set1_epi16((Sint16)volume);
+    int i = num_samples;
+
+    while (i >= 16) {
+        const __m128i samples1 = SDL_Scale_S16_SSE2(_mm_loadu_si128((const __m128i *)&src[0]), vol);
+        const __m128i samples2 = SDL_Scale_S16_SSE2(_mm_loadu_si128((const __m128i *)&src[8]), vol);
+
+        _mm_storeu_si128((__m128i *)&dst[0], _mm_adds_epi16(_mm_loadu_si128((const __m128i *)&dst[0]), samples1));
+        _mm_storeu_si128((__m128i *)&dst[8], _mm_adds_epi16(_mm_loadu_si128((const __m128i *)&dst[8]), samples2));
+
+        i -= 16;
+        src += 16;
+        dst += 16;
+    }
+
+    SDL_Mix_S16_Scalar(dst, src, i, volume);
+}
+
+static void SDL_TARGETING("sse2") SDL_Mix_S32_SSE2(Sint32 *dst, const Sint32 *src, int num_samples, int volume)
+{
+    const __m128d vol = _mm_set1_pd((double)volume / SDL_MIX_MAXVOLUME);
+    const SDL_bool scale = (volume != SDL_MIX_MAXVOLUME);
+    int i = num_samples;
+
+    while (i >= 8) {
+        __m128i samples1 = _mm_loadu_si128((const __m128i *)&src[0]);
+        __m128i samples2 = _mm_loadu_si128((const __m128i *)&src[4]);
+
+        if (scale) {
+            samples1 = SDL_Scale_S32_SSE2(samples1, vol);
+            samples2 = SDL_Scale_S32_SSE2(samples2, vol);
+        }
+
+        _mm_storeu_si128((__m128i *)&dst[0], SDL_Adds_S32_SSE2(_mm_loadu_si128((const __m128i *)&dst[0]), samples1));
+        _mm_storeu_si128((__m128i *)&dst[4], SDL_Adds_S32_SSE2(_mm_loadu_si128((const __m128i *)&dst[4]), samples2));
+
+        i -= 8;
+        src += 8;
+        dst += 8;
+    }
+
+    SDL_Mix_S32_Scalar(dst, src, i, volume);
+}
+
+static void SDL_TARGETING("sse2") SDL_Mix_F32_SSE2(float *dst, const float *src, int num_samples, int volume)
+{
+    const __m128 fvolume = _mm_set1_ps((float)volume);
+    const __m128 fmaxvolume = _mm_set1_ps(1.0f / ((float)SDL_MIX_MAXVOLUME));
+    const __m128 max_audioval = _mm_set1_ps(3.402823466e+38F);
+    const __m128 min_audioval = _mm_set1_ps(-3.402823466e+38F);
+    int i = num_samples;
+
+    /* A float sum rounds exactly like the scalar version's double sum does, and
+       the clamp takes care of overflow. The operand order keeps NaNs intact. */
+    while (i >= 8) {
+        const __m128 samples1 = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(&src[0]), fvolume), fmaxvolume);
+        const __m128 samples2 = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(&src[4]), fvolume), fmaxvolume);
+
+        const __m128 sum1 = _mm_add_ps(samples1, _mm_loadu_ps(&dst[0]));
+        const __m128 sum2 = _mm_add_ps(samples2, _mm_loadu_ps(&dst[4]));
+
+        _mm_storeu_ps(&dst[0], _mm_min_ps(max_audioval, _mm_max_ps(min_audioval, sum1)));
+        _mm_storeu_ps(&dst[4], _mm_min_ps(max_audioval, _mm_max_ps(min_audioval, sum2)));
+
+        i -= 8;
+        src += 8;
+        dst += 8;
+    }
+
+    SDL_Mix_F32_Scalar(dst, src, i, volume);
+}
+static void SDL_TARGETING("sse2") SDL_Mix_F32_Gain_SSE2(float *dst, const float *src, int num_frames, int channels, const float *start_gains, const float *step_gains)
+{
+    float starts[MAX_GAIN_LANES], steps[MAX_GAIN_LANES], frames[MAX_GAIN_LANES];
+    const int num_vectors = SDL_SetupGainLanes(channels, 4, start_gains, step_gains, starts, steps, frames);
+    const int period_frames = (num_vectors * 4) / channels;
+    const __m128 period_step = _mm_set1_ps((float)period_frames);
+    const __m128 max_audioval = _mm_set1_ps(3.402823466e+38F);
+    const __m128 min_audioval = _mm_set1_ps(-3.402823466e+38F);
+    __m128 base_frame = _mm_setzero_ps();
+    int frame = 0;
+    int i;
+
+    // Same arithmetic (and rounding) as SDL_Mix_F32_Gain_Frames; the frame numbers are exact in float.
+    while ((num_frames - frame) >= period_frames) {
+        for (i = 0; i < num_vectors; ++i) {
+            const __m128 frame_nums = _mm_add_ps(base_frame, _mm_loadu_ps(&frames[i * 4]));
+            const __m128 gains = _mm_add_ps(_mm_loadu_ps(&starts[i * 4]), _mm_mul_ps(_mm_loadu_ps(&steps[i * 4]), frame_nums));
+            const __m128 samples = _mm_mul_ps(_mm_loadu_ps(src), gains);
+            const __m128 sum = _mm_add_ps(samples, _mm_loadu_ps(dst));
+
+            _mm_storeu_ps(dst, _mm_min_ps(max_audioval, _mm_max_ps(min_audioval, sum)));
+
+            src += 4;
+            dst += 4;
+        }
+
+        base_frame = _mm_add_ps(base_frame, period_step);
+        frame += period_frames;
+    }
+
+    SDL_Mix_F32_Gain_Frames(dst, src, frame, num_frames - frame, channels, start_gains, step_gains);
+}
+
+// Stores the first `channels` (1 to 4) lanes of `samples`, without touching the memory after them.
+static SDL_INLINE void SDL_TARGETING("sse2") SDL_StoreChannels_SSE2(float *dst, __m128 samples, int channels)
+{
+    switch (channels) {
+    case 1:
+        _mm_store_ss(dst, samples);
+        break;
+    case 2:
+        _mm_storel_pi((__m64 *)dst, samples);
+        break;
+    case 3:
+        _mm_storel_pi((__m64 *)dst, samples);
+        _mm_store_ss(dst + 2, _mm_movehl_ps(samples, samples));
+        break;
+    default:
+        _mm_storeu_ps(dst, samples);
+        break;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Remix_F32_SSE2(float *dst, const float *src, int num_frames, int src_channels, int dst_channels, const float *matrix)
+{
+    const SDL_bool backwards = (dst_channels > src_channels);
+    // Downmixing to mono or stereo packs 4 or 2 frames into each vector.
+    const int group_frames = (!backwards && (dst_channels <= 2)) ? (4 / dst_channels) : 1;
+    float columns[8 * 8];
+    int i = 0;
+    int k;
+
+    SDL_SetupRemixColumns(src_channels, dst_channels, (group_frames > 1) ? dst_channels : 8, matrix, columns);
+
+    if (group_frames == 4) {
+        for (; (i + 4) <= num_frames; i += 4) {
+            const float *in = src + (i * src_channels);
+            __m128 sum = _mm_setzero_ps();
+            for (k = 0; k < src_channels; ++k) {
+                const __m128 samples = _mm_setr_ps(in[k], in[src_channels + k], in[(src_channels * 2) + k], in[(src_channels * 3) + k]);
+                sum = _mm_add_ps(sum, _mm_mul_ps(samples, _mm_loadu_ps(&columns[k * 8])));
+            }
+            _mm_storeu_ps(dst + i, sum);
+        }
+    } else if (group_frames == 2) {
+        for (; (i + 2) <= num_frames; i += 2) {
+            const float *in = src + (i * src_channels);
+            __m128 sum = _mm_setzero_ps();
+            for (k = 0; k < src_channels; ++k) {
+                const __m128 samples = _mm_setr_ps(in[k], in[k], in[src_channels + k], in[src_channels + k]);
+                sum = _mm_add_ps(sum, _mm_mul_ps(samples, _mm_loadu_ps(&columns[k * 8])));
+            }
+            _mm_storeu_ps(dst + (i * 2), sum);
+        }
+    }
+
+    // One frame at a time: broadcast each input sample and multiply it by its column.
+    for (; i < num_frames; ++i) {
+        const int frame_index = backwards ? (num_frames - 1 - i) : i;
+        const float *in = src + (frame_index * src_channels);
+        float *out = dst + (frame_index * dst_channels);
+        __m128 lo = _mm_setzero_ps();
+        __m128 hi = _mm_setzero_ps();
+
+        if (dst_channels > 4) {
+            for (k = 0; k < src_channels; ++k) {
+                const __m128 sample = _mm_set1_ps(in[k]);
+                lo = _mm_add_ps(lo, _mm_mul_ps(sample, _mm_loadu_ps(&columns[k * 8])));
+                hi = _mm_add_ps(hi, _mm_mul_ps(sample, _mm_loadu_ps(&columns[(k * 8) + 4])));
+            }
+            _mm_storeu_ps(out, lo);
+            SDL_StoreChannels_SSE2(out + 4, hi, dst_channels - 4);
+        } else {
+            for (k = 0; k < src_channels; ++k) {
+                lo = _mm_add_ps(lo, _mm_mul_ps(_mm_set1_ps(in[k]), _mm_loadu_ps(&columns[k * 8])));
+            }
+            SDL_StoreChannels_SSE2(out, lo, dst_channels);
+        }
+    }
+}
+#endif
+
+#ifdef SDL_AVX2_INTRINSICS
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Scale_S16_AVX2(__m256i samples, __m256i volume)
+{
+    // Same as SDL_Scale_S16_SSE2. Unpacking and packing both work within 128-bit lanes, so the sample order is preserved.
+    const __m256i bias = _mm256_set1_epi32(SDL_MIX_MAXVOLUME - 1);
+    const __m256i lo = _mm256_mullo_epi16(samples, volume);
+    const __m256i hi = _mm256_mulhi_epi16(samples, volume);
+    __m256i ints1 = _mm256_unpacklo_epi16(lo, hi);
+    __m256i ints2 = _mm256_unpackhi_epi16(lo, hi);
+
+    ints1 = _mm256_srai_epi32(_mm256_add_epi32(ints1, _mm256_and_si256(_mm256_srai_epi32(ints1, 31), bias)), 7);
+    ints2 = _mm256_srai_epi32(_mm256_add_epi32(ints2, _mm256_and_si256(_mm256_srai_epi32(ints2, 31), bias)), 7);
+
+    return _mm256_packs_epi32(ints1, ints2);
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Scale_S32_AVX2(__m256i samples, __m256d volume)
+{
+    // Same as SDL_Scale_S32_SSE2.
+    const __m128i lo = _mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(samples)), volume));
+    const __m128i hi = _mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(samples, 1)), volume));
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Adds_S32_AVX2(__m256i a, __m256i b)
+{
+    // Same as SDL_Adds_S32_SSE2.
+    const __m256i sum = _mm256_add_epi32(a, b);
+    const __m256i overflow = _mm256_srai_epi32(_mm256_andnot_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, sum)), 31);
+    const __m256i saturated = _mm256_xor_si256(_mm256_srai_epi32(a, 31), _mm256_set1_epi32(SDL_MAX_SINT32));
+    return _mm256_blendv_epi8(sum, saturated, overflow);
+}
+
+static void SDL_TARGETING("avx2") SDL_Mix_S16_AVX2(Sint16 *dst, const Sint16 *src, int num_samples, int volume)
+{
+    const __m256i vol = _mm256_set1_epi16((Sint16)volume);
+    int i = num_samples;
+
+    while (i >= 32) {
+        const __m256i samples1 = SDL_Scale_S16_AVX2(_mm256_loadu_si256((const __m256i *)&src[0]), vol);
+        const __m256i samples2 = SDL_Scale_S16_AVX2(_mm256_loadu_si256((const __m256i *)&src[16]), vol);
+
+        _mm256_storeu_si256((__m256i *)&dst[0], _mm256_adds_epi16(_mm256_loadu_si256((const __m256i *)&dst[0]), samples1));
+        _mm256_storeu_si256((__m256i *)&dst[16], _mm256_adds_epi16(_mm256_loadu_si256((const __m256i *)&dst[16]), samples2));
+
+        i -= 32;
+        src += 32;
+        dst += 32;
+    }
+
+    SDL_Mix_S16_Scalar(dst, src, i, volume);
+}
+
+static void SDL_TARGETING("avx2") SDL_Mix_S32_AVX2(Sint32 *dst, const Sint32 *src, int num_samples, int volume)
+{
+    const __m256d vol = _mm256_set1_pd((double)volume / SDL_MIX_MAXVOLUME);
+    const SDL_bool scale = (volume != SDL_MIX_MAXVOLUME);
+    int i = num_samples;
+
+    while (i >= 16) {
+        __m256i samples1 = _mm256_loadu_si256((const __m256i *)&src[0]);
+        __m256i samples2 = _mm256_loadu_si256((const __m256i *)&src[8]);
+
+        if (scale) {
+            samples1 = SDL_Scale_S32_AVX2(samples1, vol);
+            samples2 = SDL_Scale_S32_AVX2(samples2, vol);
+        }
+
+        _mm256_storeu_si256((__m256i *)&dst[0], SDL_Adds_S32_AVX2(_mm256_loadu_si256((const __m256i *)&dst[0]), samples1));
+        _mm256_storeu_si256((__m256i *)&dst[8], SDL_Adds_S32_AVX2(_mm256_loadu_si256((const __m256i *)&dst[8]), samples2));
+
+        i -= 16;
+        src += 16;
+        dst += 16;
+    }
+
+    SDL_Mix_S32_Scalar(dst, src, i, volume);
+}
+
+static void SDL_TARGETING("avx2") SDL_Mix_F32_AVX2(float *dst, const float *src, int num_samples, int volume)
+{
+    const __m256 fvolume = _mm256_set1_ps((float)volume);
+    const __m256 fmaxvolume = _mm256_set1_ps(1.0f / ((float)SDL_MIX_MAXVOLUME));
+    const __m256 max_audioval = _mm256_set1_ps(3.402823466e+38F);
+    const __m256 min_audioval = _mm256_set1_ps(-3.402823466e+38F);
+    int i = num_samples;
+
+    // Same as SDL_Mix_F32_SSE2.
+    while (i >= 16) {
+        const __m256 samples1 = _mm256_mul_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[0]), fvolume), fmaxvolume);
+        const __m256 samples2 = _mm256_mul_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[8]), fvolume), fmaxvolume);
+
+        const __m256 sum1 = _mm256_add_ps(samples1, _mm256_loadu_ps(&dst[0]));
+        const __m256 sum2 = _mm256_add_ps(samples2, _mm256_loadu_ps(&dst[8]));
+
+        _mm256_storeu_ps(&dst[0], _mm256_min_ps(max_audioval, _mm256_max_ps(min_audioval, sum1)));
+        _mm256_storeu_ps(&dst[8], _mm256_min_ps(max_audioval, _mm256_max_ps(min_audioval, sum2)));
+
+        i -= 16;
+        src += 16;
+        dst += 16;
+    }
+
+    SDL_Mix_F32_Scalar(dst, src, i, volume);
+}
+static void SDL_TARGETING("avx2") SDL_Mix_F32_Gain_AVX2(float *dst, const float *src, int num_frames, int channels, const float *start_gains, const float *step_gains)
+{
+    float starts[MAX_GAIN_LANES], steps[MAX_GAIN_LANES], frames[MAX_GAIN_LANES];
+    const int num_vectors = SDL_SetupGainLanes(channels, 8, start_gains, step_gains, starts, steps, frames);
+    const int period_frames = (num_vectors * 8) / channels;
+    const __m256 period_step = _mm256_set1_ps((float)period_frames);
+    const __m256 max_audioval = _mm256_set1_ps(3.402823466e+38F);
+    const __m256 min_audioval = _mm256_set1_ps(-3.402823466e+38F);
+    __m256 base_frame = _mm256_setzero_ps();
+    int frame = 0;
+    int i;
+
+    // Same as SDL_Mix_F32_Gain_SSE2.
+    while ((num_frames - frame) >= period_frames) {
+        for (i = 0; i < num_vectors; ++i) {
+            const __m256 frame_nums = _mm256_add_ps(base_frame, _mm256_loadu_ps(&frames[i * 8]));
+            const __m256 gains = _mm256_add_ps(_mm256_loadu_ps(&starts[i * 8]), _mm256_mul_ps(_mm256_loadu_ps(&steps[i * 8]), frame_nums));
+            const __m256 samples = _mm256_mul_ps(_mm256_loadu_ps(src), gains);
+            const __m256 sum = _mm256_add_ps(samples, _mm256_loadu_ps(dst));
+
+            _mm256_storeu_ps(dst, _mm256_min_ps(max_audioval, _mm256_max_ps(min_audioval, sum)));
+
+            src += 8;
+            dst += 8;
+        }
+
+        base_frame = _mm256_add_ps(base_frame, period_step);
+        frame += period_frames;
+    }
+
+    SDL_Mix_F32_Gain_Frames(dst, src, frame, num_frames - frame, channels, start_gains, step_gains);
+}
+
+static void SDL_TARGETING("avx2") SDL_Remix_F32_AVX2(float *dst, const float *src, int num_frames, int src_channels, int dst_channels, const float *matrix)
+{
+    const SDL_bool backwards = (dst_channels > src_channels);
+    // Downmixing to 1, 2 or 4 channels packs 8, 4 or 2 frames into each vector, gathering their input samples.
+    const int group_frames = (!backwards && ((8 % dst_channels) == 0)) ? (8 / dst_channels) : 1;
+    const __m256i store_mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(dst_channels), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    float columns[8 * 8];
+    int offsets[8];
+    int i = 0;
+    int k, l;
+
+    SDL_SetupRemixColumns(src_channels, dst_channels, (group_frames > 1) ? dst_channels : 8, matrix, columns);
+
+    if (group_frames > 1) {
+        for (l = 0; l < 8; ++l) {
+            offsets[l] = (l / dst_channels) * src_channels;
+        }
+
+        const __m256i gather_offsets = _mm256_loadu_si256((const __m256i *)offsets);
+
+        for (; (i + group_frames) <= num_frames; i += group_frames) {
+            const float *in = src + (i * src_channels);
+            __m256 sum = _mm256_setzero_ps();
+            for (k = 0; k < src_channels; ++k) {
+                const __m256 samples = _mm256_i32gather_ps(in + k, gather_offsets, sizeof(float));
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(samples, _mm256_loadu_ps(&columns[k * 8])));
+            }
+            _mm256_storeu_ps(dst + (i * dst_channels), sum);
+        }
+    }
+
+    // One frame at a time: broadcast each input sample and multiply it by its column.
+    for (; i < num_frames; ++i) {
+        const int frame_index = backwards ? (num_frames - 1 - i) : i;
+        const float *in = src + (frame_index * src_channels);
+        __m256 sum = _mm256_setzero_ps();
+
+        for (k = 0; k < src_channels; ++k) {
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_broadcast_ss(&in[k]), _mm256_loadu_ps(&columns[k * 8])));
+        }
+
+        _mm256_maskstore_ps(dst + (frame_index * dst_channels), store_mask, sum);
+    }
+}
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+static void SDL_Mix_S16_NEON(Sint16 *dst, const Sint16 *src, int num_samples, int volume)
+{
+    const int16x4_t vol = vdup_n_s16((int16_t)volume);
+    const int32x4_t bias = vdupq_n_s32(SDL_MIX_MAXVOLUME - 1);
+    int i = num_samples;
+
+    while (i >= 8) {
+        const int16x8_t samples = vld1q_s16((const int16_t *)src);
+        int32x4_t ints1 = vmull_s16(vget_low_s16(samples), vol);
+        int32x4_t ints2 = vmull_s16(vget_high_s16(samples), vol);
+
+        // round toward zero, like the scalar integer divide.
+        ints1 = vshrq_n_s32(vaddq_s32(ints1, vandq_s32(vshrq_n_s32(ints1, 31), bias)), 7);
+        ints2 = vshrq_n_s32(vaddq_s32(ints2, vandq_s32(vshrq_n_s32(ints2, 31), bias)), 7);
+
+        const int16x8_t scaled = vcombine_s16(vmovn_s32(ints1), vmovn_s32(ints2));
+        vst1q_s16((int16_t *)dst, vqaddq_s16(vld1q_s16((const int16_t *)dst), scaled));
+
+        i -= 8;
+        src += 8;
+        dst += 8;
+    }
+
+    SDL_Mix_S16_Scalar(dst, src, i, volume);
+}
+
+static void SDL_Mix_S32_NEON(Sint32 *dst, const Sint32 *src, int num_samples, int volume)
+{
+    const int32x2_t vol = vdup_n_s32(volume);
+    const int64x2_t bias = vdupq_n_s64(SDL_MIX_MAXVOLUME - 1);
+    int i = num_samples;
+
+    while (i >= 4) {
+        const int32x4_t samples = vld1q_s32((const int32_t *)src);
+        int64x2_t longs1 = vmull_s32(vget_low_s32(samples), vol);
+        int64x2_t longs2 = vmull_s32(vget_high_s32(samples), vol);
+
+        // round toward zero, like the scalar integer divide.
+        longs1 = vshrq_n_s64(vaddq_s64(longs1, vandq_s64(vshrq_n_s64(longs1, 63), bias)), 7);
+        longs2 = vshrq_n_s64(vaddq_s64(longs2, vandq_s64(vshrq_n_s64(longs2, 63), bias)), 7);
+
+        const int32x4_t scaled = vcombine_s32(vmovn_s64(longs1), vmovn_s64(longs2));
+        vst1q_s32((int32_t *)dst, vqaddq_s32(vld1q_s32((const int32_t *)dst), scaled));
+
+        i -= 4;
+        src += 4;
+        dst += 4;
+    }
+
+    SDL_Mix_S32_Scalar(dst, src, i, volume);
+}
+
+static void SDL_Mix_F32_NEON(float *dst, const float *src, int num_samples, int volume)
+{
+    const float32x4_t fvolume = vdupq_n_f32((float)volume);
+    const float32x4_t fmaxvolume = vdupq_n_f32(1.0f / ((float)SDL_MIX_MAXVOLUME));
+    const float32x4_t max_audioval = vdupq_n_f32(3.402823466e+38F);
+    const float32x4_t min_audioval = vdupq_n_f32(-3.402823466e+38F);
+    int i = num_samples;
+
+    while (i >= 8) {
+        const float32x4_t samples1 = vmulq_f32(vmulq_f32(vld1q_f32(&src[0]), fvolume), fmaxvolume);
+        const float32x4_t samples2 = vmulq_f32(vmulq_f32(vld1q_f32(&src[4]), fvolume), fmaxvolume);
+
+        const float32x4_t sum1 = vaddq_f32(samples1, vld1q_f32(&dst[0]));
+        const float32x4_t sum2 = vaddq_f32(samples2, vld1q_f32(&dst[4]));
+
+        vst1q_f32(&dst[0], vminq_f32(max_audioval, vmaxq_f32(min_audioval, sum1)));
+        vst1q_f32(&dst[4], vminq_f32(max_audioval, vmaxq_f32(min_audioval, sum2)));
+
+        i -= 8;
+        src += 8;
+        dst += 8;
+    }
+
+    SDL_Mix_F32_Scalar(dst, src, i, volume);
+}
+static void SDL_Mix_F32_Gain_NEON(float *dst, const float *src, int num_frames, int channels, const float *start_gains, const float *step_gains)
+{
+    float starts[MAX_GAIN_LANES], steps[MAX_GAIN_LANES], frames[MAX_GAIN_LANES];
+    const int num_vectors = SDL_SetupGainLanes(channels, 4, start_gains, step_gains, starts, steps, frames);
+    const int period_frames = (num_vectors * 4) / channels;
+    const float32x4_t period_step = vdupq_n_f32((float)period_frames);
+    const float32x4_t max_audioval = vdupq_n_f32(3.402823466e+38F);
+    const float32x4_t min_audioval = vdupq_n_f32(-3.402823466e+38F);
+    float32x4_t base_frame = vdupq_n_f32(0.0f);
+    int frame = 0;
+    int i;
+
+    // Same as SDL_Mix_F32_Gain_SSE2. Separate multiplies and adds (no vmlaq_f32), to round like the scalar version.
+    while ((num_frames - frame) >= period_frames) {
+        for (i = 0; i < num_vectors; ++i) {
+            const float32x4_t frame_nums = vaddq_f32(base_frame, vld1q_f32(&frames[i * 4]));
+            const float32x4_t gains = vaddq_f32(vld1q_f32(&starts[i * 4]), vmulq_f32(vld1q_f32(&steps[i * 4]), frame_nums));
+            const float32x4_t samples = vmulq_f32(vld1q_f32(src), gains);
+            const float32x4_t sum = vaddq_f32(samples, vld1q_f32(dst));
+
+            vst1q_f32(dst, vminq_f32(max_audioval, vmaxq_f32(min_audioval, sum)));
+
+            src += 4;
+            dst += 4;
+        }
+
+        base_frame = vaddq_f32(base_frame, period_step);
+        frame += period_frames;
+    }
+
+    SDL_Mix_F32_Gain_Frames(dst, src, frame, num_frames - frame, channels, start_gains, step_gains);
+}
+
+// Stores the first `channels` (1 to 4) lanes of `samples`, without touching the memory after them.
+static SDL_INLINE void SDL_StoreChannels_NEON(float *dst, float32x4_t samples, int channels)
+{
+    switch (channels) {
+    case 1:
+        vst1q_lane_f32(dst, samples, 0);
+        break;
+    case 2:
+        vst1_f32(dst, vget_low_f32(samples));
+        break;
+    case 3:
+        vst1_f32(dst, vget_low_f32(samples));
+        vst1q_lane_f32(dst + 2, samples, 2);
+        break;
+    default:
+        vst1q_f32(dst, samples);
+        break;
+    }
+}
+
+// Same as SDL_Remix_F32_SSE2, with separate multiplies and adds to round like the scalar version.
+static void SDL_Remix_F32_NEON(float *dst, const float *src, int num_frames, int src_channels, int dst_channels, const float *matrix)
+{
+    const SDL_bool backwards = (dst_channels > src_channels);
+    const int group_frames = (!backwards && (dst_channels <= 2)) ? (4 / dst_channels) : 1;
+    float columns[8 * 8];
+    float samples[4];
+    int i = 0;
+    int k;
+
+    SDL_SetupRemixColumns(src_channels, dst_channels, (group_frames > 1) ? dst_channels : 8, matrix, columns);
+
+    if (group_frames == 4) {
+        for (; (i + 4) <= num_frames; i += 4) {
+            const float *in = src + (i * src_channels);
+            float32x4_t sum = vdupq_n_f32(0.0f);
+            for (k = 0; k < src_channels; ++k) {
+                samples[0] = in[k];
+                samples[1] = in[src_channels + k];
+                samples[2] = in[(src_channels * 2) + k];
+                samples[3] = in[(src_channels * 3) + k];
+                sum = vaddq_f32(sum, vmulq_f32(vld1q_f32(samples), vld1q_f32(&columns[k * 8])));
+            }
+            vst1q_f32(dst + i, sum);
+        }
+    } else if (group_frames == 2) {
+        for (; (i + 2) <= num_frames; i += 2) {
+            const float *in = src + (i * src_channels);
+            float32x4_t sum = vdupq_n_f32(0.0f);
+            for (k = 0; k < src_channels; ++k) {
+                const float32x4_t pair = vcombine_f32(vdup_n_f32(in[k]), vdup_n_f32(in[src_channels + k]));
+                sum = vaddq_f32(sum, vmulq_f32(pair, vld1q_f32(&columns[k * 8])));
+            }
+            vst1q_f32(dst + (i * 2), sum);
+        }
+    }
+
+    for (; i < num_frames; ++i) {
+        const int frame_index = backwards ? (num_frames - 1 - i) : i;
+        const float *in = src + (frame_index * src_channels);
+        float *out = dst + (frame_index * dst_channels);
+        float32x4_t lo = vdupq_n_f32(0.0f);
+        float32x4_t hi = vdupq_n_f32(0.0f);
+
+        if (dst_channels > 4) {
+            for (k = 0; k < src_channels; ++k) {
+                lo = vaddq_f32(lo, vmulq_n_f32(vld1q_f32(&columns[k * 8]), in[k]));
+                hi = vaddq_f32(hi, vmulq_n_f32(vld1q_f32(&columns[(k * 8) + 4]), in[k]));
+            }
+            vst1q_f32(out, lo);
+            SDL_StoreChannels_NEON(out + 4, hi, dst_channels - 4);
+        } else {
+            for (k = 0; k < src_channels; ++k) {
+                lo = vaddq_f32(lo, vmulq_n_f32(vld1q_f32(&columns[k * 8]), in[k]));
+            }
+            SDL_StoreChannels_NEON(out, lo, dst_channels);
+        }
+    }
+}
+#endif
+
+// Function pointers set to a CPU-specific implementation.
+void (*SDL_Mix_S16)(Sint16 *dst, const Sint16 *src, int num_samples, int volume) = NULL;
+void (*SDL_Mix_S32)(Sint32 *dst, const Sint32 *src, int num_samples, int volume) = NULL;
+void (*SDL_Mix_F32)(float *dst, const float *src, int num_samples, int volume) = NULL;
+void (*SDL_Mix_F32_Gain)(float *dst, const float *src, int num_frames, int channels, const float *start_gains, const float *step_gains) = NULL;
+void (*SDL_Remix_F32)(float *dst, const float *src, int num_frames, int src_channels, int dst_channels, const float *matrix) = NULL;
+
+void SDL_ChooseAudioMixers(void)
+{
+    static SDL_bool mixers_chosen = SDL_FALSE;
+    if (mixers_chosen) {
+        return;
+    }
+
+#define SET_MIXER_FUNCS(fntype) \
+    SDL_Mix_S16 = SDL_Mix_S16_##fntype; \
+    SDL_Mix_S32 = SDL_Mix_S32_##fntype; \
+    SDL_Mix_F32 = SDL_Mix_F32_##fntype; \
+    SDL_Mix_F32_Gain = SDL_Mix_F32_Gain_##fntype; \
+    SDL_Remix_F32 = SDL_Remix_F32_##fntype; \
+    mixers_chosen = SDL_TRUE
+
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        SET_MIXER_FUNCS(AVX2);
+        return;
+    }
+#endif
+
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        SET_MIXER_FUNCS(SSE2);
+        return;
+    }
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        SET_MIXER_FUNCS(NEON);
+        return;
+    }
+#endif
+
+    SET_MIXER_FUNCS(Scalar);
+
+#undef SET_MIXER_FUNCS
+
+    SDL_assert(mixers_chosen == SDL_TRUE);
+}
 
 int SDL_MixAudioFormat(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format,
                         Uint32 len, int volume)
@@ -91,6 +875,22 @@ int SDL_MixAudioFormat(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format,
         return 0;
     }
 
+    // Native-endian 16-bit, 32-bit and float data at a sane volume goes through the SIMD mixers.
+    if ((volume > 0) && (volume <= SDL_MIX_MAXVOLUME)) {
+        SDL_ChooseAudioMixers();
+
+        if (format == SDL_AUDIO_S16) {
+            SDL_Mix_S16((Sint16 *)dst, (const Sint16 *)src, (int)(len / sizeof(Sint16)), volume);
+            return 0;
+        } else if (format == SDL_AUDIO_S32) {
+            SDL_Mix_S32((Sint32 *)dst, (const Sint32 *)src, (int)(len / sizeof(Sint32)), volume);
+            return 0;
+        } else if (format == SDL_AUDIO_F32) {
+            SDL_Mix_F32((float *)dst, (const float *)src, (int)(len / sizeof(float)), volume);
+            return 0;
+        }
+    }
+
     switch (format) {
 
     case SDL_AUDIO_U8:
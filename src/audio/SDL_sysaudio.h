@@ -44,6 +44,24 @@ extern void (*SDL_Convert_F32_to_S8)(Sint8 *dst, const float *src, int num_sampl
 extern void (*SDL_Convert_F32_to_U8)(Uint8 *dst, const float *src, int num_samples);
 extern void (*SDL_Convert_F32_to_S16)(Sint16 *dst, const float *src, int num_samples);
 extern void (*SDL_Convert_F32_to_S32)(Sint32 *dst, const float *src, int num_samples);
+// Reverses the byte order of each sample. `dst` may be the same buffer as `src`.
+extern void (*SDL_Convert_Swap16)(Uint16 *dst, const Uint16 *src, int num_samples);
+extern void (*SDL_Convert_Swap32)(Uint32 *dst, const Uint32 *src, int num_samples);
+
+// These pointers get set during SDL_ChooseAudioMixers() to various SIMD implementations. `volume` must be in [1, SDL_MIX_MAXVOLUME].
+extern void (*SDL_Mix_S16)(Sint16 *dst, const Sint16 *src, int num_samples, int volume);
+extern void (*SDL_Mix_S32)(Sint32 *dst, const Sint32 *src, int num_samples, int volume);
+extern void (*SDL_Mix_F32)(float *dst, const float *src, int num_samples, int volume);
+
+/* Mixes interleaved float32 frames into `dst`, scaling channel `c` of frame `f` by `start_gains[c] + step_gains[c] * f`.
+   `channels` must be in [1, 8]. This gets set during SDL_ChooseAudioMixers(), too. */
+extern void (*SDL_Mix_F32_Gain)(float *dst, const float *src, int num_frames, int channels, const float *start_gains, const float *step_gains);
+
+/* Remixes interleaved float32 frames from `src_channels` to `dst_channels` (both in [1, 8]), where output channel `j`
+   is the sum of input channel `k` times `matrix[j * src_channels + k]`. `dst` may be the same buffer as `src`.
+   This gets set during SDL_ChooseAudioMixers(), too. It's used for custom matrices; the generated channel converters
+   are still faster for the default ones, since they skip the zero coefficients. */
+extern void (*SDL_Remix_F32)(float *dst, const float *src, int num_frames, int src_channels, int dst_channels, const float *matrix);
 
 // !!! FIXME: These are wordy and unlocalized...
 #define DEFAULT_OUTPUT_DEVNAME "System audio output device"
@@ -74,6 +92,7 @@ const SDL_AudioFormat *SDL_ClosestAudioFormats(SDL_AudioFormat format);
 
 // Must be called at least once before using converters.
 extern void SDL_ChooseAudioConverters(void);
+extern void SDL_ChooseAudioMixers(void);
 extern void SDL_SetupAudioResampler(void);
 
 /* Backends should call this as devices are added to the system (such as
@@ -110,6 +129,24 @@ extern char *SDL_GetAudioThreadName(SDL_AudioDevice *device, char *buf, size_t b
 extern void RefPhysicalAudioDevice(SDL_AudioDevice *device);
 extern void UnrefPhysicalAudioDevice(SDL_AudioDevice *device);
 
+// Backends with no hardware to wait on (disk, dummy) can use this to pace the device thread. Each buffer is due at an
+//  absolute deadline that moves forward by the buffer's duration, so time spent mixing doesn't make the device drift.
+typedef struct SDL_AudioDeviceClock
+{
+    float timescale;  // multiplies each buffer's duration. Zero runs the device as fast as possible.
+    Uint64 period_ns;  // if `fixed_period`, the time between buffers, regardless of the device's format.
+    SDL_bool fixed_period;
+    Uint64 next_ns;  // SDL_GetTicksNS() value when the next buffer is due, zero if the device hasn't started yet.
+} SDL_AudioDeviceClock;
+
+// Sets up a clock from a timescale hint (a float, "1.0" if not set), or a legacy environment variable with a fixed
+//  number of milliseconds between buffers, which wins if it's set.
+extern void SDL_InitAudioDeviceClock(SDL_AudioDeviceClock *clock, const char *timescale_hint, const char *delay_envr);
+
+// Call this from WaitDevice/WaitCaptureDevice. Sleeps until the next buffer is due. If the device thread fell a whole
+//  buffer behind, this counts an overrun and starts the schedule over, instead of rushing out buffers to catch up.
+extern void SDL_WaitAudioDeviceClock(SDL_AudioDevice *device, SDL_AudioDeviceClock *clock);
+
 // These functions are the heart of the audio threads. Backends can call them directly if they aren't using the SDL-provided thread.
 extern void SDL_OutputAudioThreadSetup(SDL_AudioDevice *device);
 extern SDL_bool SDL_OutputAudioThreadIterate(SDL_AudioDevice *device);
@@ -120,13 +157,20 @@ extern void SDL_CaptureAudioThreadShutdown(SDL_AudioDevice *device);
 extern void SDL_AudioThreadFinalize(SDL_AudioDevice *device);
 
 // this gets used from the audio device threads. It has rules, don't use this if you don't know how to use it!
+// If `channel_matrix` isn't NULL, it's used instead of the default remix, even if the channel counts match (see SDL_Remix_F32).
 extern void ConvertAudio(int num_frames, const void *src, SDL_AudioFormat src_format, int src_channels,
-                         void *dst, SDL_AudioFormat dst_format, int dst_channels, void* scratch);
+                         void *dst, SDL_AudioFormat dst_format, int dst_channels, void* scratch, const float *channel_matrix);
 
 // Special case to let something in SDL_audiocvt.c access something in SDL_audio.c. Don't use this.
 extern void OnAudioStreamCreated(SDL_AudioStream *stream);
 extern void OnAudioStreamDestroy(SDL_AudioStream *stream);
 
+// Changes a stream's input format, taking care of any data still waiting in its SPSC ring. Hold stream->lock!
+extern void SetAudioStreamSourceSpec(SDL_AudioStream *stream, const SDL_AudioSpec *spec);
+
+// Changes a stream's output format, taking care of any data it already converted ahead of time. Hold stream->lock!
+extern void SetAudioStreamDestSpec(SDL_AudioStream *stream, const SDL_AudioSpec *spec);
+
 typedef struct SDL_AudioDriverImpl
 {
     void (*DetectDevices)(SDL_AudioDevice **default_output, SDL_AudioDevice **default_capture);
@@ -149,6 +193,7 @@ typedef struct SDL_AudioDriverImpl
     SDL_bool HasCaptureSupport;
     SDL_bool OnlyHasDefaultOutputDevice;
     SDL_bool OnlyHasDefaultCaptureDevice;   // !!! FIXME: is there ever a time where you'd have a default output and not a default capture (or vice versa)?
+    SDL_bool SupportsAdaptiveSampleFrames;  // GetDeviceBuf/PlayDevice cope with device->sample_frames shrinking (and growing back) while open.
 } SDL_AudioDriverImpl;
 
 
@@ -180,6 +225,49 @@ typedef struct SDL_AudioDriver
 
 struct SDL_AudioQueue; // forward decl.
 
+// Number of histogram buckets in SDL_AudioTimingStats. Bucket N counts samples shorter than 2^N microseconds (that didn't fit in an earlier bucket); the last bucket takes everything else.
+#define SDL_AUDIO_STATS_HISTOGRAM_BUCKETS 16
+
+typedef struct SDL_AudioTimingStats
+{
+    Uint64 count;
+    Uint64 min_ns;
+    Uint64 max_ns;
+    Uint64 total_ns;
+    Uint64 histogram[SDL_AUDIO_STATS_HISTOGRAM_BUCKETS];
+} SDL_AudioTimingStats;
+
+// Counters the device thread keeps about itself, exposed through SDL_GetAudioDeviceProperties. Protected by the device lock.
+typedef struct SDL_AudioDeviceStats
+{
+    SDL_AudioTimingStats iterate_time;  // time spent mixing (or feeding capture streams) and handing the buffer to the backend.
+    SDL_AudioTimingStats wait_time;  // time between iterations, which is mostly spent in WaitDevice.
+    Uint64 last_iterate_end_ns;  // zero if there's no previous iteration to measure wait_time from.
+    int min_streams;
+    int max_streams;
+    Uint64 total_streams;
+    Uint64 bytes_converted;
+    Uint64 underruns;
+    Uint64 frames;  // sample frames played or recorded by the device.
+    Uint64 audio_ns;  // how long those frames take to play at the device's sample rate.
+    Uint64 overruns;  // only for backends using SDL_AudioDeviceClock.
+    Uint64 buffer_resizes;  // changes made by SDL_AudioDeviceAdaptation.
+} SDL_AudioDeviceStats;
+
+// Runtime tuning of an output device's buffer size, for SDL_HINT_AUDIO_DEVICE_ADAPTIVE_SAMPLE_FRAMES. Protected by the device lock.
+typedef struct SDL_AudioDeviceAdaptation
+{
+    SDL_bool enabled;
+    int min_sample_frames;
+    int max_sample_frames;  // what the device was opened with; the backend's buffers are only that big.
+    int iterations;  // buffers played in the current measuring window.
+    Uint64 trouble_count;  // underruns plus overruns when the window started.
+    Uint64 late_ns;  // how far the device thread is behind, where the buffers it played should have taken it.
+    Uint64 max_late_ns;  // the worst that got during the window.
+    int calm_windows;  // windows in a row without trouble.
+    int calm_windows_needed;  // before shrinking the buffer again; this backs off every time a smaller buffer didn't work out.
+} SDL_AudioDeviceAdaptation;
+
 struct SDL_AudioStream
 {
     SDL_Mutex* lock;
@@ -194,12 +282,45 @@ struct SDL_AudioStream
     SDL_AudioSpec src_spec;
     SDL_AudioSpec dst_spec;
     float freq_ratio;
+    float gain;  // applied, along with pan, when mixed by an output device.
+    float pan;
+
+    float *channel_matrix;  // custom remix matrix from SDL_SetAudioStreamChannelMatrix, or NULL.
+    int channel_matrix_src_channels;
+    int channel_matrix_dst_channels;
+
+    Sint64 start_frame;  // from SDL_SetAudioStreamSchedule, in the bound output device's frames, or -1.
+    Sint64 stop_frame;
 
     struct SDL_AudioQueue* queue;
     Uint64 total_bytes_queued;
+    Uint64 total_bytes_converted;  // everything SDL_GetAudioStreamData has returned, for SDL_GetAudioStreamProperties.
+    SDL_AtomicInt underruns;  // times a bound output device wanted more data than this stream had.
+
+    // If non-NULL, SDL_PutAudioStreamData copies into this lock-free ring instead of taking `lock`.
+    // The producer only moves `ring_head`; `ring_tail` only moves while holding `lock`, when data moves to `queue`.
+    Uint8 *ring;
+    Uint32 ring_size;  // always a power of two.
+    SDL_AtomicInt ring_head;
+    SDL_AtomicInt ring_tail;
+    SDL_AtomicInt ring_frame_size;  // SDL_AUDIO_FRAMESIZE(src_spec), so the producer can check data without `lock`.
+
+    // If look-ahead is on, a worker thread converts queued input ahead of time into `lookahead`, so reading the stream is mostly a copy.
+    // All of this is protected by `lock`; the worker only holds it while converting one small chunk at a time.
+    size_t lookahead_watermark;  // latched from the stream properties; the worker stops converting once this many bytes are ready. 0 if off.
+    Uint8 *lookahead;
+    size_t lookahead_allocation;
+    size_t lookahead_offset;  // converted data starts here...
+    size_t lookahead_bytes;   // ...and is this long.
+    SDL_AudioSpec lookahead_spec;  // the dst_spec the ready data was converted to.
+    SDL_Thread *lookahead_thread;
+    SDL_Condition *lookahead_cond;  // signaled when there might be more for the worker to do.
+    SDL_bool lookahead_quit;
 
     SDL_AudioSpec input_spec; // The spec of input data currently being processed
     Sint64 resample_offset;
+    SDL_AudioResampleQuality resample_quality; // latched from the stream properties when reading.
+    size_t max_pooled_bytes;  // latched from the stream properties, too.
 
     Uint8 *work_buffer;    // used for scratch space during data conversion/resampling.
     size_t work_buffer_allocation;
@@ -210,6 +331,7 @@ struct SDL_AudioStream
     SDL_bool simplified;  // SDL_TRUE if created via SDL_OpenAudioDeviceStream
 
     SDL_LogicalAudioDevice *bound_device;
+    float mix_gains[8];  // per-channel gains this stream was last mixed with, to ramp from. Protected by the device lock.
     SDL_AudioStream *next_binding;
     SDL_AudioStream *prev_binding;
 
@@ -290,6 +412,9 @@ struct SDL_AudioDevice
     // Number of sample frames the devices wants per-buffer.
     int sample_frames;
 
+    // Sample frames an output device has mixed since it opened; the next buffer starts here. Protected by the device lock.
+    Uint64 position;
+
     // Value to use for SDL_memset to silence a buffer in this device's format
     int silence_value;
 
@@ -316,6 +441,9 @@ struct SDL_AudioDevice
     // A thread to feed the audio device
     SDL_Thread *thread;
 
+    // Optional worker threads that pull data from bound streams in parallel (see SDL_HINT_AUDIO_DEVICE_MIX_THREADS).
+    struct SDL_AudioMixPool *mix_pool;
+
     // SDL_TRUE if this physical device is currently opened by the backend.
     SDL_bool currently_opened;
 
@@ -324,6 +452,13 @@ struct SDL_AudioDevice
 
     // All logical devices associated with this physical device.
     SDL_LogicalAudioDevice *logical_devices;
+
+    // Performance counters for the device thread, and the properties they're published through (created on demand).
+    SDL_AudioDeviceStats stats;
+    SDL_PropertiesID props;
+
+    // Only used by output devices, if the backend supports it.
+    SDL_AudioDeviceAdaptation adaptation;
 };
 
 typedef struct AudioBootStrap
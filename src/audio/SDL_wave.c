@@ -35,6 +35,9 @@
 
 #include "SDL_wave.h"
 #include "SDL_sysaudio.h"
+#include "../SDL_hashtable.h"
+#include "../file/SDL_iostream_c.h"
+#include "../thread/SDL_systhread.h"
 
 /* Reads the value stored at the location of the f1 pointer, multiplies it
  * with the second argument and then stores the result to f1.
@@ -101,6 +104,145 @@ typedef struct MS_ADPCM_ChannelState
     Sint16 coeff2;
 } MS_ADPCM_ChannelState;
 
+/* Decodes a number of complete ADPCM blocks, starting at the current input
+ * position, into the output. Returns the number of blocks that got decoded,
+ * which is less than requested if a block header was invalid. The state is
+ * advanced past the decoded blocks.
+ */
+typedef size_t (*ADPCM_DecodeBlocksFunc)(ADPCM_DecoderState *state, size_t blockcount);
+
+/* A file needs at least this many blocks for each extra thread, otherwise
+ * starting the thread costs more than it saves.
+ */
+#define ADPCM_MIN_BLOCKS_PER_THREAD 256
+#define ADPCM_MAX_DECODE_THREADS    64
+
+typedef struct ADPCM_DecodeJob
+{
+    ADPCM_DecoderState state;
+    ADPCM_DecodeBlocksFunc decode;
+    size_t blockcount;
+    size_t decoded;
+} ADPCM_DecodeJob;
+
+static int SDLCALL ADPCM_DecodeThread(void *data)
+{
+    ADPCM_DecodeJob *job = (ADPCM_DecodeJob *)data;
+    job->decoded = job->decode(&job->state, job->blockcount);
+    return 0;
+}
+
+static int ADPCM_GetDecodeThreads(size_t blockcount)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_WAVE_DECODE_THREADS);
+    size_t threads = 0;
+
+    if (hint) {
+        threads = (size_t)SDL_atoi(hint);
+    }
+    if (threads == 0) {
+        threads = (size_t)SDL_GetCPUCount();
+        if (threads > blockcount / ADPCM_MIN_BLOCKS_PER_THREAD) {
+            threads = blockcount / ADPCM_MIN_BLOCKS_PER_THREAD;
+        }
+    }
+    if (threads > blockcount) {
+        threads = blockcount;
+    }
+    if (threads > ADPCM_MAX_DECODE_THREADS) {
+        threads = ADPCM_MAX_DECODE_THREADS;
+    }
+    return threads > 0 ? (int)threads : 1;
+}
+
+/* ADPCM blocks don't depend on each other, so all the complete blocks can be
+ * decoded in one go, split into ranges for several threads if there are enough
+ * of them. The last block of the input is always left to the caller, because
+ * it may be truncated and the SIMD decoders are allowed to read a few bytes
+ * past the end of a block.
+ */
+static void ADPCM_DecodeCompleteBlocks(ADPCM_DecoderState *state, ADPCM_DecodeBlocksFunc decode, size_t cstatesize)
+{
+    const size_t framesperblock = state->samplesperblock * state->channels;
+    size_t blockcount = state->input.size / state->blocksize;
+    size_t decoded = 0;
+    ADPCM_DecodeJob *jobs = NULL;
+    SDL_Thread **threads;
+    Uint8 *cstates;
+    int numjobs, i;
+
+    if (blockcount > 0) {
+        blockcount--;
+    }
+    if ((Uint64)blockcount > (Uint64)state->framesleft / state->samplesperblock) {
+        blockcount = (size_t)(state->framesleft / state->samplesperblock);
+    }
+    if (blockcount == 0) {
+        return;
+    }
+
+    numjobs = ADPCM_GetDecodeThreads(blockcount);
+    if (numjobs > 1) {
+        jobs = (ADPCM_DecodeJob *)SDL_malloc(numjobs * (sizeof(ADPCM_DecodeJob) + sizeof(SDL_Thread *) + cstatesize));
+        if (!jobs) {
+            SDL_ClearError();
+            numjobs = 1;
+        }
+    }
+
+    if (numjobs <= 1) {
+        decode(state, blockcount);
+        return;
+    }
+
+    threads = (SDL_Thread **)(jobs + numjobs);
+    cstates = (Uint8 *)(threads + numjobs);
+
+    for (i = 0; i < numjobs; i++) {
+        ADPCM_DecodeJob *job = &jobs[i];
+        const size_t first = blockcount * i / numjobs;
+        job->blockcount = blockcount * (i + 1) / numjobs - first;
+        job->decode = decode;
+        job->decoded = 0;
+        job->state = *state;
+        job->state.cstate = cstates + i * cstatesize;
+        job->state.input.pos += first * state->blocksize;
+        job->state.output.pos += first * framesperblock;
+        job->state.framesleft = (Sint64)(job->blockcount * state->samplesperblock);
+    }
+
+    /* The calling thread takes the first range itself. If a thread can't be
+     * started, its range gets decoded here as well.
+     */
+    for (i = 1; i < numjobs; i++) {
+        threads[i] = SDL_CreateThreadInternal(ADPCM_DecodeThread, "SDLWaveDecode", 0, &jobs[i]);
+    }
+    ADPCM_DecodeThread(&jobs[0]);
+    for (i = 1; i < numjobs; i++) {
+        if (threads[i]) {
+            SDL_WaitThread(threads[i], NULL);
+        } else {
+            ADPCM_DecodeThread(&jobs[i]);
+        }
+    }
+
+    /* Everything after an invalid block is left to the caller, which will
+     * stop at that block with an error.
+     */
+    for (i = 0; i < numjobs; i++) {
+        decoded += jobs[i].decoded;
+        if (jobs[i].decoded < jobs[i].blockcount) {
+            break;
+        }
+    }
+
+    SDL_free(jobs);
+
+    state->input.pos += decoded * state->blocksize;
+    state->output.pos += decoded * framesperblock;
+    state->framesleft -= (Sint64)(decoded * state->samplesperblock);
+}
+
 #ifdef SDL_WAVE_DEBUG_LOG_FORMAT
 static void WaveDebugLogFormat(WaveFile *file)
 {
@@ -633,6 +775,157 @@ static int MS_ADPCM_DecodeBlockData(ADPCM_DecoderState *state)
     return 0;
 }
 
+static size_t MS_ADPCM_DecodeBlocks_Scalar(ADPCM_DecoderState *state, size_t blockcount)
+{
+    size_t i;
+
+    for (i = 0; i < blockcount; i++) {
+        const size_t outpos = state->output.pos;
+
+        state->block.data = state->input.data + state->input.pos;
+        state->block.size = state->blocksize;
+        state->block.pos = 0;
+
+        if (MS_ADPCM_DecodeBlockHeader(state) < 0) {
+            /* The caller reports the error when it gets to this block. */
+            state->output.pos = outpos;
+            break;
+        }
+        /* Can't run out of data, the block is complete. */
+        MS_ADPCM_DecodeBlockData(state);
+
+        state->input.pos += state->blocksize;
+    }
+
+    return i;
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+/* Decodes eight channels at once, one per 32-bit lane. A lane is a channel of
+ * one of the 8 / channels blocks that are decoded side by side. It's the same
+ * math as MS_ADPCM_ProcessNibble, and produces the exact same samples.
+ */
+static size_t SDL_TARGETING("avx2") MS_ADPCM_DecodeBlocks_AVX2(ADPCM_DecoderState *state, size_t blockcount)
+{
+    const Uint32 channels = state->channels;
+    const size_t blocksperpass = 8 / channels;
+    const size_t blocksize = state->blocksize;
+    const size_t samplesperblock = state->samplesperblock;
+    const size_t datasamples = samplesperblock - 2;
+    const size_t datawords = (datasamples * channels + 7) / 8;
+    const size_t samplesperword = 8 / channels;
+    const MS_ADPCM_CoeffData *ddata = (const MS_ADPCM_CoeffData *)state->ddata;
+    const __m256i adaptive_lo = _mm256_setr_epi32(230, 230, 230, 230, 307, 409, 512, 614);
+    const __m256i adaptive_hi = _mm256_setr_epi32(768, 614, 512, 409, 307, 230, 230, 230);
+    const __m256i min_audioval = _mm256_set1_epi32(-32768);
+    const __m256i max_audioval = _mm256_set1_epi32(32767);
+    const __m256i min_deltaval = _mm256_set1_epi32(16);
+    const __m256i max_deltaval = _mm256_set1_epi32(65535);
+    const __m256i nybblemask = _mm256_set1_epi32(0x0f);
+    const __m256i signbit = _mm256_set1_epi32(0x08);
+    Sint32 offsets[8], coeff1[8], coeff2[8], delta[8], sample1[8], sample2[8], shifts[8], samples[8];
+    Sint16 *outlane[8];
+    size_t done = 0;
+    size_t l, w, j;
+
+    if (channels > 2) {
+        return MS_ADPCM_DecodeBlocks_Scalar(state, blockcount);
+    }
+
+    while (blockcount - done >= blocksperpass) {
+        const Uint8 *blocks = state->input.data + state->input.pos;
+        Sint16 *output = state->output.data + state->output.pos;
+        __m256i vcoeff1, vcoeff2, vdelta, vsample1, vsample2, voffsets, vshifts;
+
+        /* The block headers are loaded like MS_ADPCM_DecodeBlockHeader does. */
+        for (l = 0; l < 8; l++) {
+            const size_t b = l / channels;
+            const size_t c = l % channels;
+            const Uint8 *header = blocks + b * blocksize;
+            const Uint8 coeffindex = header[c];
+            if (coeffindex > ddata->coeffcount) {
+                /* Leave the invalid block to the scalar decoder, which reports the error. */
+                return done + MS_ADPCM_DecodeBlocks_Scalar(state, blockcount - done);
+            }
+            coeff1[l] = ddata->coeff[coeffindex * 2];
+            coeff2[l] = ddata->coeff[coeffindex * 2 + 1];
+            delta[l] = header[channels + c * 2] | ((Uint16)header[channels + c * 2 + 1] << 8);
+            sample1[l] = (Sint16)(header[channels * 3 + c * 2] | ((Uint16)header[channels * 3 + c * 2 + 1] << 8));
+            sample2[l] = (Sint16)(header[channels * 5 + c * 2] | ((Uint16)header[channels * 5 + c * 2 + 1] << 8));
+            offsets[l] = (Sint32)(b * blocksize + state->blockheadersize);
+            /* In stereo blocks, the left channel has the upper nibble. */
+            shifts[l] = (channels == 2 && c == 0) ? 4 : 0;
+
+            outlane[l] = output + b * samplesperblock * channels + c;
+            outlane[l][0] = (Sint16)sample2[l];
+            outlane[l][channels] = (Sint16)sample1[l];
+            outlane[l] += channels * 2;
+        }
+
+        vcoeff1 = _mm256_loadu_si256((const __m256i *)coeff1);
+        vcoeff2 = _mm256_loadu_si256((const __m256i *)coeff2);
+        vdelta = _mm256_loadu_si256((const __m256i *)delta);
+        vsample1 = _mm256_loadu_si256((const __m256i *)sample1);
+        vsample2 = _mm256_loadu_si256((const __m256i *)sample2);
+        voffsets = _mm256_loadu_si256((const __m256i *)offsets);
+        vshifts = _mm256_loadu_si256((const __m256i *)shifts);
+
+        for (w = 0; w < datawords; w++) {
+            const __m256i words = _mm256_i32gather_epi32((const int *)blocks, voffsets, 1);
+            const size_t wordsamples = SDL_min(samplesperword, datasamples - w * samplesperword);
+
+            for (j = 0; j < wordsamples; j++) {
+                /* The nibbles are stored upper nibble first. */
+                const int nybblepos = (int)(j * channels);
+                const int shift = (nybblepos / 2) * 8 + ((channels == 1 && !(nybblepos & 1)) ? 4 : 0);
+                const __m256i nybble = _mm256_and_si256(_mm256_srlv_epi32(words, _mm256_add_epi32(vshifts, _mm256_set1_epi32(shift))), nybblemask);
+                const __m256i errordelta = _mm256_srai_epi32(_mm256_slli_epi32(nybble, 28), 28);
+                const __m256i adaptive = _mm256_blendv_epi8(_mm256_permutevar8x32_epi32(adaptive_lo, nybble),
+                                                            _mm256_permutevar8x32_epi32(adaptive_hi, nybble),
+                                                            _mm256_cmpeq_epi32(_mm256_and_si256(nybble, signbit), signbit));
+                __m256i new_sample = _mm256_add_epi32(_mm256_mullo_epi32(vsample1, vcoeff1), _mm256_mullo_epi32(vsample2, vcoeff2));
+
+                /* Division by 256 that rounds towards zero, like in C. */
+                new_sample = _mm256_srai_epi32(_mm256_add_epi32(new_sample, _mm256_and_si256(_mm256_srai_epi32(new_sample, 31), _mm256_set1_epi32(255))), 8);
+                new_sample = _mm256_add_epi32(new_sample, _mm256_mullo_epi32(vdelta, errordelta));
+                new_sample = _mm256_min_epi32(_mm256_max_epi32(new_sample, min_audioval), max_audioval);
+
+                vdelta = _mm256_srli_epi32(_mm256_mullo_epi32(vdelta, adaptive), 8);
+                vdelta = _mm256_min_epi32(_mm256_max_epi32(vdelta, min_deltaval), max_deltaval);
+
+                vsample2 = vsample1;
+                vsample1 = new_sample;
+
+                _mm256_storeu_si256((__m256i *)samples, new_sample);
+                for (l = 0; l < 8; l++) {
+                    *outlane[l] = (Sint16)samples[l];
+                    outlane[l] += channels;
+                }
+            }
+
+            voffsets = _mm256_add_epi32(voffsets, _mm256_set1_epi32(4));
+        }
+
+        state->input.pos += blocksperpass * blocksize;
+        state->output.pos += blocksperpass * samplesperblock * channels;
+        state->framesleft -= (Sint64)(blocksperpass * samplesperblock);
+        done += blocksperpass;
+    }
+
+    return done + MS_ADPCM_DecodeBlocks_Scalar(state, blockcount - done);
+}
+#endif
+
+static ADPCM_DecodeBlocksFunc MS_ADPCM_GetBlocksDecoder(void)
+{
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        return MS_ADPCM_DecodeBlocks_AVX2;
+    }
+#endif
+    return MS_ADPCM_DecodeBlocks_Scalar;
+}
+
 static int MS_ADPCM_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 {
     int result;
@@ -688,7 +981,9 @@ static int MS_ADPCM_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 
     state.cstate = cstate;
 
-    /* Decode block by block. A truncated block will stop the decoding. */
+    ADPCM_DecodeCompleteBlocks(&state, MS_ADPCM_GetBlocksDecoder(), sizeof(cstate));
+
+    /* Decode the rest block by block. A truncated block will stop the decoding. */
     bytesleft = state.input.size - state.input.pos;
     while (state.framesleft > 0 && bytesleft >= state.blockheadersize) {
         state.block.data = state.input.data + state.input.pos;
@@ -1027,6 +1322,144 @@ static int IMA_ADPCM_DecodeBlockData(ADPCM_DecoderState *state)
     return retval;
 }
 
+static size_t IMA_ADPCM_DecodeBlocks_Scalar(ADPCM_DecoderState *state, size_t blockcount)
+{
+    size_t i;
+
+    for (i = 0; i < blockcount; i++) {
+        state->block.data = state->input.data + state->input.pos;
+        state->block.size = state->blocksize;
+        state->block.pos = 0;
+
+        /* Can't fail, the block is complete and its sub-blocks were checked. */
+        IMA_ADPCM_DecodeBlockHeader(state);
+        IMA_ADPCM_DecodeBlockData(state);
+
+        state->input.pos += state->blocksize;
+    }
+
+    return i;
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+/* Decodes eight channels at once, one per 32-bit lane. A lane is a channel of
+ * one of the 8 / channels blocks that are decoded side by side. It's the same
+ * math as IMA_ADPCM_ProcessNibble, and produces the exact same samples.
+ */
+static size_t SDL_TARGETING("avx2") IMA_ADPCM_DecodeBlocks_AVX2(ADPCM_DecoderState *state, size_t blockcount)
+{
+    static const Sint32 step_table[89] = {
+        7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
+        34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130,
+        143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408,
+        449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282,
+        1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+        3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630,
+        9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350,
+        22385, 24623, 27086, 29794, 32767
+    };
+    const Uint32 channels = state->channels;
+    const size_t blocksize = state->blocksize;
+    const size_t samplesperblock = state->samplesperblock;
+    const size_t datasamples = samplesperblock - 1;
+    const size_t subblockframesize = (size_t)channels * 4;
+    /* The index table only depends on the lower three bits of the nibble. */
+    const __m256i index_table = _mm256_setr_epi32(-1, -1, -1, -1, 2, 4, 6, 8);
+    const __m256i min_audioval = _mm256_set1_epi32(-32768);
+    const __m256i max_audioval = _mm256_set1_epi32(32767);
+    const __m256i min_index = _mm256_setzero_si256();
+    const __m256i max_index = _mm256_set1_epi32(88);
+    const __m256i nybblemask = _mm256_set1_epi32(0x0f);
+    const __m256i bit0 = _mm256_set1_epi32(0x01);
+    const __m256i bit1 = _mm256_set1_epi32(0x02);
+    const __m256i bit2 = _mm256_set1_epi32(0x04);
+    const __m256i bit3 = _mm256_set1_epi32(0x08);
+    Sint32 offsets[8], indices[8], lastsamples[8], samples[8];
+    Sint16 *outlane[8];
+    size_t blocksperpass, done = 0;
+    size_t l, k, i;
+
+    /* The lanes must hold whole blocks. */
+    if (channels > 8 || 8 % channels) {
+        return IMA_ADPCM_DecodeBlocks_Scalar(state, blockcount);
+    }
+    blocksperpass = 8 / channels;
+
+    while (blockcount - done >= blocksperpass) {
+        const Uint8 *blocks = state->input.data + state->input.pos;
+        Sint16 *output = state->output.data + state->output.pos;
+        __m256i vindex, vsample, voffsets;
+
+        /* The block headers are loaded like IMA_ADPCM_DecodeBlockHeader does. */
+        for (l = 0; l < 8; l++) {
+            const size_t b = l / channels;
+            const size_t c = l % channels;
+            const Uint8 *header = blocks + b * blocksize + c * 4;
+            lastsamples[l] = (Sint16)(header[0] | ((Uint16)header[1] << 8));
+            indices[l] = (Sint8)header[2];
+            offsets[l] = (Sint32)(b * blocksize + state->blockheadersize + c * 4);
+
+            outlane[l] = output + b * samplesperblock * channels + c;
+            outlane[l][0] = (Sint16)lastsamples[l];
+            outlane[l] += channels;
+        }
+
+        vindex = _mm256_loadu_si256((const __m256i *)indices);
+        vsample = _mm256_loadu_si256((const __m256i *)lastsamples);
+        voffsets = _mm256_loadu_si256((const __m256i *)offsets);
+
+        for (k = 0; k < datasamples; k += 8) {
+            const __m256i words = _mm256_i32gather_epi32((const int *)blocks, voffsets, 1);
+            const size_t subblocksamples = SDL_min(8, datasamples - k);
+
+            for (i = 0; i < subblocksamples; i++) {
+                /* The nibbles are stored lower nibble first. */
+                const __m256i nybble = _mm256_and_si256(_mm256_srli_epi32(words, (int)(i * 4)), nybblemask);
+                __m256i step, delta, negative;
+
+                vindex = _mm256_min_epi32(_mm256_max_epi32(vindex, min_index), max_index);
+                step = _mm256_i32gather_epi32((const int *)step_table, vindex, 4);
+                vindex = _mm256_add_epi32(vindex, _mm256_permutevar8x32_epi32(index_table, nybble));
+
+                delta = _mm256_srli_epi32(step, 3);
+                delta = _mm256_add_epi32(delta, _mm256_and_si256(step, _mm256_cmpeq_epi32(_mm256_and_si256(nybble, bit2), bit2)));
+                delta = _mm256_add_epi32(delta, _mm256_and_si256(_mm256_srli_epi32(step, 1), _mm256_cmpeq_epi32(_mm256_and_si256(nybble, bit1), bit1)));
+                delta = _mm256_add_epi32(delta, _mm256_and_si256(_mm256_srli_epi32(step, 2), _mm256_cmpeq_epi32(_mm256_and_si256(nybble, bit0), bit0)));
+                negative = _mm256_cmpeq_epi32(_mm256_and_si256(nybble, bit3), bit3);
+                delta = _mm256_sub_epi32(_mm256_xor_si256(delta, negative), negative);
+
+                vsample = _mm256_min_epi32(_mm256_max_epi32(_mm256_add_epi32(vsample, delta), min_audioval), max_audioval);
+
+                _mm256_storeu_si256((__m256i *)samples, vsample);
+                for (l = 0; l < 8; l++) {
+                    *outlane[l] = (Sint16)samples[l];
+                    outlane[l] += channels;
+                }
+            }
+
+            voffsets = _mm256_add_epi32(voffsets, _mm256_set1_epi32((int)subblockframesize));
+        }
+
+        state->input.pos += blocksperpass * blocksize;
+        state->output.pos += blocksperpass * samplesperblock * channels;
+        state->framesleft -= (Sint64)(blocksperpass * samplesperblock);
+        done += blocksperpass;
+    }
+
+    return done + IMA_ADPCM_DecodeBlocks_Scalar(state, blockcount - done);
+}
+#endif
+
+static ADPCM_DecodeBlocksFunc IMA_ADPCM_GetBlocksDecoder(void)
+{
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        return IMA_ADPCM_DecodeBlocks_AVX2;
+    }
+#endif
+    return IMA_ADPCM_DecodeBlocks_Scalar;
+}
+
 static int IMA_ADPCM_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 {
     int result;
@@ -1084,7 +1517,14 @@ static int IMA_ADPCM_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len
     }
     state.cstate = cstate;
 
-    /* Decode block by block. A truncated block will stop the decoding. */
+    /* If wSamplesPerBlock doesn't fit the sub-blocks, every block counts as
+     * truncated and only the loop below knows how to deal with that.
+     */
+    if ((state.samplesperblock + 6) / 8 * state.channels * 4 <= state.blocksize - state.blockheadersize) {
+        ADPCM_DecodeCompleteBlocks(&state, IMA_ADPCM_GetBlocksDecoder(), state.channels * sizeof(Sint8));
+    }
+
+    /* Decode the rest block by block. A truncated block will stop the decoding. */
     bytesleft = state.input.size - state.input.pos;
     while (state.framesleft > 0 && bytesleft >= state.blockheadersize) {
         state.block.data = state.input.data + state.input.pos;
@@ -1158,7 +1598,10 @@ static int LAW_Init(WaveFile *file, size_t datalength)
     return 0;
 }
 
-static int LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+/* Expands `sample_count` companded 8-bit samples in `buf` to 16-bit samples in
+ * place. `buf` must have space for `sample_count` Sint16 values.
+ */
+static int LAW_Expand(Uint16 encoding, Uint8 *buf, size_t sample_count)
 {
 #ifdef SDL_WAVE_LAW_LUT
     const Sint16 alaw_lut[256] = {
@@ -1199,53 +1642,13 @@ static int LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
     };
 #endif
 
-    WaveFormat *format = &file->format;
-    WaveChunk *chunk = &file->chunk;
-    size_t i, sample_count, expanded_len;
-    Uint8 *src;
-    Sint16 *dst;
-
-    if (chunk->length != chunk->size) {
-        file->sampleframes = WaveAdjustToFactValue(file, chunk->size / format->blockalign);
-        if (file->sampleframes < 0) {
-            return -1;
-        }
-    }
-
-    /* Nothing to decode, nothing to return. */
-    if (file->sampleframes == 0) {
-        *audio_buf = NULL;
-        *audio_len = 0;
-        return 0;
-    }
-
-    sample_count = (size_t)file->sampleframes;
-    if (SafeMult(&sample_count, format->channels)) {
-        return SDL_SetError("WAVE file too big");
-    }
-
-    expanded_len = sample_count;
-    if (SafeMult(&expanded_len, sizeof(Sint16))) {
-        return SDL_SetError("WAVE file too big");
-    } else if (expanded_len > SDL_MAX_UINT32 || file->sampleframes > SIZE_MAX) {
-        return SDL_SetError("WAVE file too big");
-    }
-
-    /* 1 to avoid allocating zero bytes, to keep static analysis happy. */
-    src = (Uint8 *)SDL_realloc(chunk->data, expanded_len ? expanded_len : 1);
-    if (!src) {
-        return -1;
-    }
-    chunk->data = NULL;
-    chunk->size = 0;
-
-    dst = (Sint16 *)src;
+    const Uint8 *src = buf;
+    Sint16 *dst = (Sint16 *)buf;
+    size_t i;
 
-    /* Work backwards, since we're expanding in-place. `format` will
-     * inform the caller about the byte order.
-     */
+    /* Work backwards, since we're expanding in-place. */
     i = sample_count;
-    switch (file->format.encoding) {
+    switch (encoding) {
 #ifdef SDL_WAVE_LAW_LUT
     case ALAW_CODE:
         while (i--) {
@@ -1290,10 +1693,59 @@ static int LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
         break;
 #endif
     default:
-        SDL_free(src);
         return SDL_SetError("Unknown companded encoding");
     }
 
+    return 0;
+}
+
+static int LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+    size_t sample_count, expanded_len;
+    Uint8 *src;
+
+    if (chunk->length != chunk->size) {
+        file->sampleframes = WaveAdjustToFactValue(file, chunk->size / format->blockalign);
+        if (file->sampleframes < 0) {
+            return -1;
+        }
+    }
+
+    /* Nothing to decode, nothing to return. */
+    if (file->sampleframes == 0) {
+        *audio_buf = NULL;
+        *audio_len = 0;
+        return 0;
+    }
+
+    sample_count = (size_t)file->sampleframes;
+    if (SafeMult(&sample_count, format->channels)) {
+        return SDL_SetError("WAVE file too big");
+    }
+
+    expanded_len = sample_count;
+    if (SafeMult(&expanded_len, sizeof(Sint16))) {
+        return SDL_SetError("WAVE file too big");
+    } else if (expanded_len > SDL_MAX_UINT32 || file->sampleframes > SIZE_MAX) {
+        return SDL_SetError("WAVE file too big");
+    }
+
+    /* 1 to avoid allocating zero bytes, to keep static analysis happy. */
+    src = (Uint8 *)SDL_realloc(chunk->data, expanded_len ? expanded_len : 1);
+    if (!src) {
+        return -1;
+    }
+    chunk->data = NULL;
+    chunk->size = 0;
+
+    /* `format` will inform the caller about the byte order. */
+    if (LAW_Expand(format->encoding, src, sample_count) < 0) {
+        SDL_free(src);
+        return -1;
+    }
+
     *audio_buf = src;
     *audio_len = (Uint32)expanded_len;
 
@@ -1343,37 +1795,12 @@ static int PCM_Init(WaveFile *file, size_t datalength)
     return 0;
 }
 
-static int PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+/* Shifts the first `sample_count` 24-bit samples in `ptr` to 32 bits in place.
+ * The SIMD versions below expand blocks from the end and leave the rest to this.
+ */
+static void PCM_ExpandSint24ToSint32_Scalar(Uint8 *ptr, size_t sample_count)
 {
-    WaveFormat *format = &file->format;
-    WaveChunk *chunk = &file->chunk;
-    size_t i, expanded_len, sample_count;
-    Uint8 *ptr;
-
-    sample_count = (size_t)file->sampleframes;
-    if (SafeMult(&sample_count, format->channels)) {
-        return SDL_SetError("WAVE file too big");
-    }
-
-    expanded_len = sample_count;
-    if (SafeMult(&expanded_len, sizeof(Sint32))) {
-        return SDL_SetError("WAVE file too big");
-    } else if (expanded_len > SDL_MAX_UINT32 || file->sampleframes > SIZE_MAX) {
-        return SDL_SetError("WAVE file too big");
-    }
-
-    /* 1 to avoid allocating zero bytes, to keep static analysis happy. */
-    ptr = (Uint8 *)SDL_realloc(chunk->data, expanded_len ? expanded_len : 1);
-    if (!ptr) {
-        return -1;
-    }
-
-    /* This pointer is now invalid. */
-    chunk->data = NULL;
-    chunk->size = 0;
-
-    *audio_buf = ptr;
-    *audio_len = (Uint32)expanded_len;
+    size_t i;
 
     /* work from end to start, since we're expanding in-place. */
     for (i = sample_count; i > 0; i--) {
@@ -1390,19 +1817,156 @@ static int PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32 *
         ptr[o * 4 + 2] = b[2];
         ptr[o * 4 + 3] = b[3];
     }
-
-    return 0;
 }
 
-static int PCM_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+/* Each pass reads 16 packed samples (48 bytes) before writing them back out as
+ * 64 bytes. Passes go from the end to the start, and a pass never writes below
+ * where its own input starts, so no input gets overwritten before it's read.
+ */
+#ifdef SDL_AVX2_INTRINSICS
+static size_t SDL_TARGETING("avx2") PCM_ExpandSint24ToSint32_AVX2(Uint8 *ptr, size_t sample_count)
 {
-    WaveFormat *format = &file->format;
-    WaveChunk *chunk = &file->chunk;
-    size_t outputsize;
+    const __m256i shuffle = _mm256_setr_epi8(-1, 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11,
+                                             -1, 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11);
+    size_t i = sample_count;
 
-    if (chunk->length != chunk->size) {
-        file->sampleframes = WaveAdjustToFactValue(file, chunk->size / format->blockalign);
-        if (file->sampleframes < 0) {
+    while (i >= 16) {
+        i -= 16;
+
+        /* Line up four samples at the start of each 128-bit lane */
+        const __m128i in1 = _mm_loadu_si128((const __m128i *)&ptr[i * 3]);
+        const __m128i in2 = _mm_loadu_si128((const __m128i *)&ptr[i * 3 + 16]);
+        const __m128i in3 = _mm_loadu_si128((const __m128i *)&ptr[i * 3 + 32]);
+        const __m256i samples1 = _mm256_inserti128_si256(_mm256_castsi128_si256(in1), _mm_alignr_epi8(in2, in1, 12), 1);
+        const __m256i samples2 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_alignr_epi8(in3, in2, 8)), _mm_srli_si128(in3, 4), 1);
+
+        _mm256_storeu_si256((__m256i *)&ptr[i * 4], _mm256_shuffle_epi8(samples1, shuffle));
+        _mm256_storeu_si256((__m256i *)&ptr[i * 4 + 32], _mm256_shuffle_epi8(samples2, shuffle));
+    }
+
+    return i;
+}
+#endif
+
+#ifdef SDL_SSE4_1_INTRINSICS
+/* This only needs SSSE3's pshufb and palignr, but SSE4.1 is the closest thing SDL detects. */
+static size_t SDL_TARGETING("sse4.1") PCM_ExpandSint24ToSint32_SSE41(Uint8 *ptr, size_t sample_count)
+{
+    const __m128i shuffle = _mm_setr_epi8(-1, 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11);
+    size_t i = sample_count;
+
+    while (i >= 16) {
+        i -= 16;
+
+        const __m128i in1 = _mm_loadu_si128((const __m128i *)&ptr[i * 3]);
+        const __m128i in2 = _mm_loadu_si128((const __m128i *)&ptr[i * 3 + 16]);
+        const __m128i in3 = _mm_loadu_si128((const __m128i *)&ptr[i * 3 + 32]);
+
+        _mm_storeu_si128((__m128i *)&ptr[i * 4], _mm_shuffle_epi8(in1, shuffle));
+        _mm_storeu_si128((__m128i *)&ptr[i * 4 + 16], _mm_shuffle_epi8(_mm_alignr_epi8(in2, in1, 12), shuffle));
+        _mm_storeu_si128((__m128i *)&ptr[i * 4 + 32], _mm_shuffle_epi8(_mm_alignr_epi8(in3, in2, 8), shuffle));
+        _mm_storeu_si128((__m128i *)&ptr[i * 4 + 48], _mm_shuffle_epi8(_mm_srli_si128(in3, 4), shuffle));
+    }
+
+    return i;
+}
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+static size_t PCM_ExpandSint24ToSint32_NEON(Uint8 *ptr, size_t sample_count)
+{
+    size_t i = sample_count;
+
+    while (i >= 16) {
+        uint8x16x4_t out;
+        uint8x16x3_t in;
+
+        i -= 16;
+
+        /* De-interleave the three bytes of each sample, then interleave them again after a zero byte */
+        in = vld3q_u8(&ptr[i * 3]);
+        out.val[0] = vdupq_n_u8(0);
+        out.val[1] = in.val[0];
+        out.val[2] = in.val[1];
+        out.val[3] = in.val[2];
+        vst4q_u8(&ptr[i * 4], out);
+    }
+
+    return i;
+}
+#endif
+
+/* Shifts `sample_count` 24-bit samples in `ptr` to 32 bits in place. `ptr`
+ * must have space for `sample_count` Sint32 values.
+ */
+static void PCM_ExpandSint24ToSint32(Uint8 *ptr, size_t sample_count)
+{
+    /* Each of these leaves fewer than 16 samples at the start for the next one. */
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        sample_count = PCM_ExpandSint24ToSint32_AVX2(ptr, sample_count);
+    }
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    if (SDL_HasSSE41()) {
+        sample_count = PCM_ExpandSint24ToSint32_SSE41(ptr, sample_count);
+    }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        sample_count = PCM_ExpandSint24ToSint32_NEON(ptr, sample_count);
+    }
+#endif
+
+    PCM_ExpandSint24ToSint32_Scalar(ptr, sample_count);
+}
+
+static int PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+    size_t expanded_len, sample_count;
+    Uint8 *ptr;
+
+    sample_count = (size_t)file->sampleframes;
+    if (SafeMult(&sample_count, format->channels)) {
+        return SDL_SetError("WAVE file too big");
+    }
+
+    expanded_len = sample_count;
+    if (SafeMult(&expanded_len, sizeof(Sint32))) {
+        return SDL_SetError("WAVE file too big");
+    } else if (expanded_len > SDL_MAX_UINT32 || file->sampleframes > SIZE_MAX) {
+        return SDL_SetError("WAVE file too big");
+    }
+
+    /* 1 to avoid allocating zero bytes, to keep static analysis happy. */
+    ptr = (Uint8 *)SDL_realloc(chunk->data, expanded_len ? expanded_len : 1);
+    if (!ptr) {
+        return -1;
+    }
+
+    /* This pointer is now invalid. */
+    chunk->data = NULL;
+    chunk->size = 0;
+
+    *audio_buf = ptr;
+    *audio_len = (Uint32)expanded_len;
+
+    PCM_ExpandSint24ToSint32(ptr, sample_count);
+
+    return 0;
+}
+
+static int PCM_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+    size_t outputsize;
+
+    if (chunk->length != chunk->size) {
+        file->sampleframes = WaveAdjustToFactValue(file, chunk->size / format->blockalign);
+        if (file->sampleframes < 0) {
             return -1;
         }
     }
@@ -1567,6 +2131,33 @@ static int WaveReadChunkData(SDL_IOStream *src, WaveChunk *chunk)
     return WaveReadPartialChunkData(src, chunk, chunk->length);
 }
 
+/* Points the chunk data straight into the stream with SDL_MapIO(), instead of
+ * reading it. Only the part of the chunk that is actually in the stream gets
+ * mapped, so a truncated chunk looks the same as if it was read. The chunk data
+ * must not be freed with WaveFreeChunkData() after this.
+ */
+static int WaveMapChunkData(SDL_IOStream *src, WaveChunk *chunk, void **mapping)
+{
+    const Sint64 streamsize = SDL_GetIOSize(src);
+    size_t length = chunk->length;
+    const void *data;
+
+    if (streamsize <= chunk->position) {
+        return -1;
+    } else if ((Uint64)(streamsize - chunk->position) < length) {
+        length = (size_t)(streamsize - chunk->position);
+    }
+
+    data = SDL_MapIO(src, chunk->position, length, mapping);
+    if (!data) {
+        return -1;
+    }
+
+    chunk->data = (Uint8 *)data;
+    chunk->size = length;
+    return 0;
+}
+
 typedef struct WaveExtensibleGUID
 {
     Uint16 encoding;
@@ -1769,7 +2360,11 @@ static int WaveCheckFormat(WaveFile *file, size_t datalength)
     return 0;
 }
 
-static int WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+/* Finds the fmt and data chunks and initializes the decoder. Reading the data
+ * chunk is left to the caller, who also gets the position where the WAVE file
+ * ends in `endposition`.
+ */
+static int WaveLoadHeader(SDL_IOStream *src, WaveFile *file, WaveChunk *datachunkout, Sint64 *endposition)
 {
     int result;
     Uint32 chunkcount = 0;
@@ -1777,7 +2372,6 @@ static int WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uint
     char *envchunkcountlimit;
     Sint64 RIFFstart, RIFFend, lastchunkpos;
     SDL_bool RIFFlengthknown = SDL_FALSE;
-    WaveFormat *format = &file->format;
     WaveChunk *chunk = &file->chunk;
     WaveChunk RIFFchunk;
     WaveChunk fmtchunk;
@@ -1980,10 +2574,91 @@ static int WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uint
 
     WaveFreeChunkData(chunk);
 
+    *datachunkout = datachunk;
+
+    /* The end position is reported back to the cleanup code. */
+    if (RIFFlengthknown) {
+        *endposition = RIFFend;
+    } else {
+        *endposition = lastchunkpos;
+    }
+
+    return 0;
+}
+
+/* Sets up the spec of the decoded data. All unsupported formats were filtered
+ * out by WaveLoadHeader.
+ */
+static int WaveGetSpec(WaveFile *file, SDL_AudioSpec *spec)
+{
+    WaveFormat *format = &file->format;
+
+    spec->freq = format->frequency;
+    spec->channels = (Uint8)format->channels;
+    spec->format = 0;
+
+    switch (format->encoding) {
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+    case ALAW_CODE:
+    case MULAW_CODE:
+        /* These can be easily stored in the byte order of the system. */
+        spec->format = SDL_AUDIO_S16;
+        break;
+    case IEEE_FLOAT_CODE:
+        spec->format = SDL_AUDIO_F32LE;
+        break;
+    case PCM_CODE:
+        switch (format->bitspersample) {
+        case 8:
+            spec->format = SDL_AUDIO_U8;
+            break;
+        case 16:
+            spec->format = SDL_AUDIO_S16LE;
+            break;
+        case 24: /* Has been shifted to 32 bits. */
+        case 32:
+            spec->format = SDL_AUDIO_S32LE;
+            break;
+        default:
+            /* Just in case something unexpected happened in the checks. */
+            return SDL_SetError("Unexpected %u-bit PCM data format", (unsigned int)format->bitspersample);
+        }
+        break;
+    default:
+        return SDL_SetError("Unexpected data format");
+    }
+
+    return 0;
+}
+
+/* If `mapping` isn't NULL, PCM data that doesn't need to be converted is
+ * returned straight from the stream if it can be mapped, with the handle of the
+ * mapping in `mapping`.
+ */
+static int WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len, void **mapping)
+{
+    int result;
+    Sint64 endposition;
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+    WaveChunk datachunk;
+
+    if (WaveLoadHeader(src, file, &datachunk, &endposition) < 0) {
+        return -1;
+    }
+
     /* Process data chunk. */
     *chunk = datachunk;
 
-    if (chunk->length > 0) {
+    if (mapping && chunk->length > 0) {
+        if (format->encoding == IEEE_FLOAT_CODE || (format->encoding == PCM_CODE && format->bitspersample != 24)) {
+            WaveMapChunkData(src, chunk, mapping);
+        }
+    }
+
+    /* Read the data if it couldn't be mapped. */
+    if (chunk->length > 0 && !chunk->data) {
         result = WaveReadChunkData(src, chunk);
         if (result == -1) {
             return -1;
@@ -2026,56 +2701,18 @@ static int WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uint
         break;
     }
 
-    /* Setting up the specs. All unsupported formats were filtered out
-     * by checks earlier in this function.
-     */
-    spec->freq = format->frequency;
-    spec->channels = (Uint8)format->channels;
-    spec->format = 0;
-
-    switch (format->encoding) {
-    case MS_ADPCM_CODE:
-    case IMA_ADPCM_CODE:
-    case ALAW_CODE:
-    case MULAW_CODE:
-        /* These can be easily stored in the byte order of the system. */
-        spec->format = SDL_AUDIO_S16;
-        break;
-    case IEEE_FLOAT_CODE:
-        spec->format = SDL_AUDIO_F32LE;
-        break;
-    case PCM_CODE:
-        switch (format->bitspersample) {
-        case 8:
-            spec->format = SDL_AUDIO_U8;
-            break;
-        case 16:
-            spec->format = SDL_AUDIO_S16LE;
-            break;
-        case 24: /* Has been shifted to 32 bits. */
-        case 32:
-            spec->format = SDL_AUDIO_S32LE;
-            break;
-        default:
-            /* Just in case something unexpected happened in the checks. */
-            return SDL_SetError("Unexpected %u-bit PCM data format", (unsigned int)format->bitspersample);
-        }
-        break;
-    default:
-        return SDL_SetError("Unexpected data format");
+    /* Setting up the specs. */
+    if (WaveGetSpec(file, spec) < 0) {
+        return -1;
     }
 
     /* Report the end position back to the cleanup code. */
-    if (RIFFlengthknown) {
-        chunk->position = RIFFend;
-    } else {
-        chunk->position = lastchunkpos;
-    }
+    chunk->position = endposition;
 
     return 0;
 }
 
-int SDL_LoadWAV_IO(SDL_IOStream *src, SDL_bool closeio, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+static int WaveLoadIO(SDL_IOStream *src, SDL_bool closeio, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len, void **mapping)
 {
     int result = -1;
     WaveFile file;
@@ -2102,7 +2739,16 @@ int SDL_LoadWAV_IO(SDL_IOStream *src, SDL_bool closeio, SDL_AudioSpec *spec, Uin
     file.trunchint = WaveGetTruncationHint();
     file.facthint = WaveGetFactChunkHint();
 
-    result = WaveLoad(src, &file, spec, audio_buf, audio_len);
+    result = WaveLoad(src, &file, spec, audio_buf, audio_len, mapping);
+    if (mapping && *mapping) {
+        /* Nothing in the mapping may be passed to SDL_free(). */
+        file.chunk.data = NULL;
+        if (result < 0 || !*audio_buf) {
+            *audio_buf = NULL;
+            SDL_UnmapIO(*mapping);
+            *mapping = NULL;
+        }
+    }
     if (result < 0) {
         SDL_free(*audio_buf);
         audio_buf = NULL;
@@ -2122,8 +2768,391 @@ done:
     return result;
 }
 
+int SDL_LoadWAV_IO(SDL_IOStream *src, SDL_bool closeio, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    return WaveLoadIO(src, closeio, spec, audio_buf, audio_len, NULL);
+}
+
 int SDL_LoadWAV(const char *path, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
 {
     return SDL_LoadWAV_IO(SDL_IOFromFile(path, "rb"), 1, spec, audio_buf, audio_len);
 }
 
+/* The mappings of the audio data from SDL_LoadWAVMapped_IO(), keyed by the
+ * audio data pointer, so SDL_FreeMappedWAV() knows how to free it. Two memory
+ * streams can give out the same pointer, so the table is stackable.
+ */
+static SDL_HashTable *wave_mappings = NULL;
+static SDL_SpinLock wave_mappings_lock = 0;
+
+static void SDLCALL NukeWaveMapping(const void *key, const void *value, void *data)
+{
+    /* Unmapped by SDL_FreeMappedWAV(), outside of the lock. */
+}
+
+int SDL_LoadWAVMapped_IO(SDL_IOStream *src, SDL_bool closeio, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    void *mapping = NULL;
+    SDL_bool added = SDL_FALSE;
+
+    if (WaveLoadIO(src, closeio, spec, audio_buf, audio_len, &mapping) < 0) {
+        return -1;
+    } else if (!mapping) {
+        return 0;  /* Loaded the regular way. */
+    }
+
+    SDL_LockSpinlock(&wave_mappings_lock);
+    if (!wave_mappings) {
+        wave_mappings = SDL_CreateHashTable(NULL, 64, SDL_HashID, SDL_KeyMatchID, NukeWaveMapping, SDL_TRUE);
+    }
+    if (wave_mappings) {
+        added = SDL_InsertIntoHashTable(wave_mappings, *audio_buf, mapping);
+    }
+    SDL_UnlockSpinlock(&wave_mappings_lock);
+
+    if (!added) {
+        SDL_UnmapIO(mapping);
+        *audio_buf = NULL;
+        *audio_len = 0;
+        return -1;
+    }
+    return 0;
+}
+
+int SDL_LoadWAVMapped(const char *path, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    return SDL_LoadWAVMapped_IO(SDL_IOFromFile(path, "rb"), 1, spec, audio_buf, audio_len);
+}
+
+void SDL_FreeMappedWAV(Uint8 *audio_buf)
+{
+    const void *mapping = NULL;
+
+    if (!audio_buf) {
+        return;
+    }
+
+    SDL_LockSpinlock(&wave_mappings_lock);
+    if (wave_mappings && SDL_FindInHashTable(wave_mappings, audio_buf, &mapping)) {
+        SDL_RemoveFromHashTable(wave_mappings, audio_buf);
+        if (SDL_HashTableEmpty(wave_mappings)) {
+            SDL_DestroyHashTable(wave_mappings);
+            wave_mappings = NULL;
+        }
+    }
+    SDL_UnlockSpinlock(&wave_mappings_lock);
+
+    if (mapping) {
+        SDL_UnmapIO((void *)mapping);
+    } else {
+        SDL_free(audio_buf);
+    }
+}
+
+
+/* The audio stream property that owns the state of a streaming WAVE decoder. */
+#define PROP_AUDIOSTREAM_WAVE_POINTER "SDL.audiostream.wave"
+
+/* The most bytes a PCM or companded WAVE stream decodes at a time. */
+#define WAVE_STREAM_BLOCK_BYTES (64 * 1024)
+
+/* State of a streaming WAVE decoder. The data chunk is read and decoded one
+ * block at a time, whenever the audio stream needs more data.
+ */
+typedef struct WaveStream
+{
+    SDL_AudioStream *stream;
+    SDL_IOStream *src;
+    SDL_bool closeio;
+    WaveFile file;
+    ADPCM_DecoderState state; /* Only used by the ADPCM decoders. */
+    Uint64 bytesleft;         /* Bytes of the data chunk that haven't been read yet. */
+    Sint64 framesleft;        /* Sample frames that haven't been decoded yet. */
+    size_t framesize;         /* Size of a sample frame in the data chunk. Not used by ADPCM. */
+    size_t outputframesize;   /* Size of a decoded sample frame. */
+    size_t blocksize;         /* Number of bytes read from the data chunk at a time. */
+    Uint8 *block;             /* The bytes read from the data chunk. */
+    Uint8 *output;            /* The decoded block. PCM and companded data is decoded in place. */
+    SDL_bool finished;
+} WaveStream;
+
+static void DestroyWaveStream(WaveStream *wstream)
+{
+    if (wstream->closeio) {
+        SDL_CloseIO(wstream->src);
+    }
+    if (wstream->output != wstream->block) {
+        SDL_free(wstream->output);
+    }
+    SDL_free(wstream->block);
+    SDL_free(wstream->state.cstate);
+    WaveFreeChunkData(&wstream->file.chunk);
+    SDL_free(wstream->file.decoderdata);
+    SDL_free(wstream);
+}
+
+static void SDLCALL CleanupWaveStream(void *userdata, void *value)
+{
+    WaveStream *wstream = (WaveStream *)value;
+
+    /* This waits for the callback to finish, if another thread is in it. */
+    SDL_SetAudioStreamGetCallback(wstream->stream, NULL, NULL);
+    DestroyWaveStream(wstream);
+}
+
+static int WaveStreamInit(WaveStream *wstream, const WaveChunk *datachunk)
+{
+    WaveFile *file = &wstream->file;
+    WaveFormat *format = &file->format;
+    ADPCM_DecoderState *state = &wstream->state;
+    const size_t channels = format->channels;
+    size_t outputsize;
+
+    wstream->bytesleft = datachunk->length;
+    wstream->framesleft = file->sampleframes;
+
+    /* The data isn't read until it's needed, so check for a truncated data
+     * chunk up front if that is supposed to fail.
+     */
+    if (file->trunchint == TruncVeryStrict || file->trunchint == TruncStrict) {
+        const Sint64 size = SDL_GetIOSize(wstream->src);
+        if (size >= 0 && size - datachunk->position < (Sint64)datachunk->length) {
+            return SDL_SetError("Could not read data of WAVE data chunk");
+        }
+    }
+
+    switch (format->encoding) {
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+        state->channels = format->channels;
+        state->blocksize = format->blockalign;
+        state->blockheadersize = channels * (format->encoding == MS_ADPCM_CODE ? 7 : 4);
+        state->samplesperblock = format->samplesperblock;
+        state->framesize = channels * sizeof(Sint16);
+        state->ddata = file->decoderdata;
+        state->framestotal = file->sampleframes;
+        state->framesleft = state->framestotal;
+
+        if (format->encoding == MS_ADPCM_CODE) {
+            state->cstate = SDL_calloc(channels, sizeof(MS_ADPCM_ChannelState));
+        } else {
+            state->cstate = SDL_calloc(channels, sizeof(Sint8));
+        }
+        if (!state->cstate) {
+            return -1;
+        }
+
+        /* The block size limits the samples per block, so this can't overflow. */
+        wstream->blocksize = state->blocksize;
+        wstream->outputframesize = state->framesize;
+        outputsize = state->samplesperblock * state->framesize;
+        wstream->block = (Uint8 *)SDL_malloc(wstream->blocksize);
+        wstream->output = (Uint8 *)SDL_malloc(outputsize);
+        if (!wstream->block || !wstream->output) {
+            return -1;
+        }
+        break;
+    case ALAW_CODE:
+    case MULAW_CODE:
+        wstream->framesize = channels;
+        wstream->outputframesize = channels * sizeof(Sint16);
+        break;
+    default:
+        wstream->framesize = channels * (format->bitspersample / 8);
+        /* 24-bit samples get shifted to 32 bits. */
+        if (format->encoding == PCM_CODE && format->bitspersample == 24) {
+            wstream->outputframesize = channels * sizeof(Sint32);
+        } else {
+            wstream->outputframesize = wstream->framesize;
+        }
+        break;
+    }
+
+    if (!wstream->block) {
+        const size_t frames = SDL_max(WAVE_STREAM_BLOCK_BYTES / wstream->outputframesize, 1);
+        wstream->blocksize = frames * wstream->framesize;
+        wstream->block = (Uint8 *)SDL_malloc(frames * wstream->outputframesize);
+        if (!wstream->block) {
+            return -1;
+        }
+        wstream->output = wstream->block;
+    }
+
+    if (SDL_SeekIO(wstream->src, datachunk->position, SDL_IO_SEEK_SET) != datachunk->position) {
+        return SDL_SetError("Could not seek data of WAVE data chunk");
+    }
+
+    return 0;
+}
+
+/* Reads and decodes the next block of the data chunk into wstream->output.
+ * Returns the number of decoded bytes, which is 0 at the end of the data, or
+ * -1 on errors.
+ */
+static int WaveStreamDecodeBlock(WaveStream *wstream)
+{
+    WaveFile *file = &wstream->file;
+    WaveFormat *format = &file->format;
+    ADPCM_DecoderState *state = &wstream->state;
+    size_t length, bytesread, frames;
+    int result;
+
+    if (wstream->framesleft <= 0 || wstream->bytesleft == 0) {
+        return 0;
+    }
+
+    length = wstream->bytesleft < wstream->blocksize ? (size_t)wstream->bytesleft : wstream->blocksize;
+    bytesread = SDL_ReadIO(wstream->src, wstream->block, length);
+    wstream->bytesleft -= bytesread;
+    if (bytesread != length) {
+        /* I/O issues or corrupt file. */
+        if (file->trunchint == TruncVeryStrict || file->trunchint == TruncStrict) {
+            return SDL_SetError("Could not read data of WAVE data chunk");
+        }
+        /* Decode what's there, and stop after that. */
+        wstream->bytesleft = 0;
+    }
+
+    switch (format->encoding) {
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+        /* A truncated block header stops the decoding. */
+        if (bytesread < state->blockheadersize) {
+            return 0;
+        }
+
+        state->block.data = wstream->block;
+        state->block.size = bytesread;
+        state->block.pos = 0;
+        state->output.data = (Sint16 *)wstream->output;
+        state->output.size = state->samplesperblock * state->channels;
+        state->output.pos = 0;
+
+        /* Initialize decoder with the values from the block header, and decode the block data. */
+        if (format->encoding == MS_ADPCM_CODE) {
+            result = MS_ADPCM_DecodeBlockHeader(state);
+            if (result == -1) {
+                return -1;
+            }
+            result = MS_ADPCM_DecodeBlockData(state);
+        } else {
+            result = IMA_ADPCM_DecodeBlockHeader(state);
+            if (result == 0) {
+                result = IMA_ADPCM_DecodeBlockData(state);
+            }
+        }
+
+        if (result == -1) {
+            /* Unexpected end. Stop decoding and return partial data if necessary. */
+            if (file->trunchint == TruncVeryStrict || file->trunchint == TruncStrict) {
+                return SDL_SetError("Truncated data chunk");
+            } else if (file->trunchint != TruncDropFrame) {
+                state->output.pos -= state->output.pos % (state->samplesperblock * state->channels);
+            }
+            wstream->bytesleft = 0;
+        }
+
+        frames = state->output.pos / state->channels;
+        if (state->framesleft < 0) {
+            /* The MS ADPCM block header always provides two sample frames, even if only one is left. */
+            frames += (size_t)state->framesleft;
+            state->framesleft = 0;
+        }
+        wstream->framesleft = state->framesleft;
+        break;
+    default:
+        /* Drop incomplete sample frames. */
+        frames = bytesread / wstream->framesize;
+        if ((Sint64)frames > wstream->framesleft) {
+            frames = (size_t)wstream->framesleft;
+        }
+        wstream->framesleft -= frames;
+
+        if (format->encoding == ALAW_CODE || format->encoding == MULAW_CODE) {
+            if (LAW_Expand(format->encoding, wstream->block, frames * format->channels) < 0) {
+                return -1;
+            }
+        } else if (format->encoding == PCM_CODE && format->bitspersample == 24) {
+            PCM_ExpandSint24ToSint32(wstream->block, frames * format->channels);
+        }
+        break;
+    }
+
+    return (int)(frames * wstream->outputframesize);
+}
+
+static void SDLCALL WaveStreamGetCallback(void *userdata, SDL_AudioStream *stream, int additional_amount, int total_amount)
+{
+    WaveStream *wstream = (WaveStream *)userdata;
+
+    while (additional_amount > 0 && !wstream->finished) {
+        const int len = WaveStreamDecodeBlock(wstream);
+        if (len > 0 && SDL_PutAudioStreamData(stream, wstream->output, len) == 0) {
+            additional_amount -= len;
+        } else {
+            /* End of the data, or an error. Either way, let the stream play out what it has. */
+            wstream->finished = SDL_TRUE;
+            SDL_FlushAudioStream(stream);
+        }
+    }
+}
+
+SDL_AudioStream *SDL_OpenWAVStream_IO(SDL_IOStream *src, SDL_bool closeio, SDL_AudioSpec *spec)
+{
+    WaveStream *wstream = NULL;
+    SDL_AudioStream *stream = NULL;
+    SDL_AudioSpec wavespec;
+    WaveChunk datachunk;
+    Sint64 endposition;
+
+    /* Make sure we are passed a valid data source */
+    if (!src) {
+        return NULL;  /* Error may come from SDL_IOStream. */
+    }
+
+    wstream = (WaveStream *)SDL_calloc(1, sizeof(*wstream));
+    if (!wstream) {
+        if (closeio) {
+            SDL_CloseIO(src);
+        }
+        return NULL;
+    }
+    wstream->src = src;
+    wstream->closeio = closeio;
+    wstream->file.riffhint = WaveGetRiffSizeHint();
+    wstream->file.trunchint = WaveGetTruncationHint();
+    wstream->file.facthint = WaveGetFactChunkHint();
+
+    if (WaveLoadHeader(src, &wstream->file, &datachunk, &endposition) < 0 ||
+        WaveGetSpec(&wstream->file, &wavespec) < 0 ||
+        WaveStreamInit(wstream, &datachunk) < 0) {
+        goto failed;
+    }
+
+    stream = SDL_CreateAudioStream(&wavespec, &wavespec);
+    if (!stream) {
+        goto failed;
+    }
+    wstream->stream = stream;
+
+    /* The stream owns the decoder from here on, and frees it with its properties. */
+    if (SDL_SetAudioStreamGetCallback(stream, WaveStreamGetCallback, wstream) < 0 ||
+        SDL_SetPropertyWithCleanup(SDL_GetAudioStreamProperties(stream), PROP_AUDIOSTREAM_WAVE_POINTER, wstream, CleanupWaveStream, NULL) < 0) {
+        goto failed;
+    }
+
+    if (spec) {
+        *spec = wavespec;
+    }
+    return stream;
+
+failed:
+    SDL_DestroyAudioStream(stream);
+    DestroyWaveStream(wstream);
+    return NULL;
+}
+
+SDL_AudioStream *SDL_OpenWAVStream(const char *path, SDL_AudioSpec *spec)
+{
+    return SDL_OpenWAVStream_IO(SDL_IOFromFile(path, "rb"), 1, spec);
+}
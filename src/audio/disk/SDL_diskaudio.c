@@ -37,7 +37,7 @@
 
 static int DISKAUDIO_WaitDevice(SDL_AudioDevice *device)
 {
-    SDL_Delay(device->hidden->io_delay);
+    SDL_WaitAudioDeviceClock(device, &device->hidden->clock);
     return 0;
 }
 
@@ -109,18 +109,13 @@ static int DISKAUDIO_OpenDevice(SDL_AudioDevice *device)
 {
     SDL_bool iscapture = device->iscapture;
     const char *fname = get_filename(iscapture);
-    const char *envr = SDL_getenv(DISKENVR_IODELAY);
 
     device->hidden = (struct SDL_PrivateAudioData *) SDL_calloc(1, sizeof(*device->hidden));
     if (!device->hidden) {
         return -1;
     }
 
-    if (envr) {
-        device->hidden->io_delay = SDL_atoi(envr);
-    } else {
-        device->hidden->io_delay = ((device->sample_frames * 1000) / device->spec.freq);
-    }
+    SDL_InitAudioDeviceClock(&device->hidden->clock, SDL_HINT_AUDIO_DISK_TIMESCALE, DISKENVR_IODELAY);
 
     // Open the "audio device"
     device->hidden->io = SDL_IOFromFile(fname, iscapture ? "rb" : "wb");
@@ -162,6 +157,7 @@ static SDL_bool DISKAUDIO_Init(SDL_AudioDriverImpl *impl)
     impl->DetectDevices = DISKAUDIO_DetectDevices;
 
     impl->HasCaptureSupport = SDL_TRUE;
+    impl->SupportsAdaptiveSampleFrames = SDL_TRUE;
 
     return SDL_TRUE;
 }
@@ -29,7 +29,7 @@ struct SDL_PrivateAudioData
 {
     // The file descriptor for the audio device
     SDL_IOStream *io;
-    Uint32 io_delay;
+    SDL_AudioDeviceClock clock;
     Uint8 *mixbuf;
 };
 
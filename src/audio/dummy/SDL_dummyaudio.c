@@ -25,19 +25,17 @@
 #include "../SDL_sysaudio.h"
 #include "SDL_dummyaudio.h"
 
-// !!! FIXME: this should be an SDL hint, not an environment variable.
+// This predates SDL_HINT_AUDIO_DUMMY_TIMESCALE, and still takes precedence over it.
 #define DUMMYENVR_IODELAY "SDL_DUMMYAUDIODELAY"
 
 static int DUMMYAUDIO_WaitDevice(SDL_AudioDevice *device)
 {
-    SDL_Delay(device->hidden->io_delay);
+    SDL_WaitAudioDeviceClock(device, &device->hidden->clock);
     return 0;
 }
 
 static int DUMMYAUDIO_OpenDevice(SDL_AudioDevice *device)
 {
-    const char *envr = SDL_getenv(DUMMYENVR_IODELAY);
-
     device->hidden = (struct SDL_PrivateAudioData *) SDL_calloc(1, sizeof(*device->hidden));
     if (!device->hidden) {
         return -1;
@@ -50,7 +48,7 @@ static int DUMMYAUDIO_OpenDevice(SDL_AudioDevice *device)
         }
     }
 
-    device->hidden->io_delay = (Uint32) (envr ? SDL_atoi(envr) : ((device->sample_frames * 1000) / device->spec.freq));
+    SDL_InitAudioDeviceClock(&device->hidden->clock, SDL_HINT_AUDIO_DUMMY_TIMESCALE, DUMMYENVR_IODELAY);
 
     return 0; // we're good; don't change reported device format.
 }
@@ -88,6 +86,7 @@ static SDL_bool DUMMYAUDIO_Init(SDL_AudioDriverImpl *impl)
     impl->OnlyHasDefaultOutputDevice = SDL_TRUE;
     impl->OnlyHasDefaultCaptureDevice = SDL_TRUE;
     impl->HasCaptureSupport = SDL_TRUE;
+    impl->SupportsAdaptiveSampleFrames = SDL_TRUE;
 
     return SDL_TRUE;
 }
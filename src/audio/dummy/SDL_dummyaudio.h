@@ -28,7 +28,7 @@
 struct SDL_PrivateAudioData
 {
     Uint8 *mixbuf;   // The file descriptor for the audio device
-    Uint32 io_delay; // miliseconds to sleep in WaitDevice.
+    SDL_AudioDeviceClock clock;  // paces WaitDevice.
 };
 
 #endif // SDL_dummyaudio_h_
@@ -1036,3 +1036,20 @@
 #define SDL_wcsnstr SDL_wcsnstr_REAL
 #define SDL_wcsstr SDL_wcsstr_REAL
 #define SDL_wcstol SDL_wcstol_REAL
+#define SDL_GetAudioStreamGain SDL_GetAudioStreamGain_REAL
+#define SDL_SetAudioStreamGain SDL_SetAudioStreamGain_REAL
+#define SDL_GetAudioStreamPan SDL_GetAudioStreamPan_REAL
+#define SDL_SetAudioStreamPan SDL_SetAudioStreamPan_REAL
+#define SDL_CreateAudioStreamWithProperties SDL_CreateAudioStreamWithProperties_REAL
+#define SDL_PutAudioStreamDataNoCopy SDL_PutAudioStreamDataNoCopy_REAL
+#define SDL_GetAudioDeviceProperties SDL_GetAudioDeviceProperties_REAL
+#define SDL_SetAudioStreamChannelMatrix SDL_SetAudioStreamChannelMatrix_REAL
+#define SDL_OpenWAVStream_IO SDL_OpenWAVStream_IO_REAL
+#define SDL_OpenWAVStream SDL_OpenWAVStream_REAL
+#define SDL_LoadWAVMapped_IO SDL_LoadWAVMapped_IO_REAL
+#define SDL_LoadWAVMapped SDL_LoadWAVMapped_REAL
+#define SDL_FreeMappedWAV SDL_FreeMappedWAV_REAL
+#define SDL_PutAudioStreamDataBatch SDL_PutAudioStreamDataBatch_REAL
+#define SDL_GetAudioStreamDataBatch SDL_GetAudioStreamDataBatch_REAL
+#define SDL_GetAudioDevicePosition SDL_GetAudioDevicePosition_REAL
+#define SDL_SetAudioStreamSchedule SDL_SetAudioStreamSchedule_REAL
@@ -1052,3 +1052,20 @@ SDL_DYNAPI_PROC(size_t,SDL_wcsnlen,(const wchar_t *a, size_t b),(a,b),return)
 SDL_DYNAPI_PROC(wchar_t*,SDL_wcsnstr,(const wchar_t *a, const wchar_t *b, size_t c),(a,b,c),return)
 SDL_DYNAPI_PROC(wchar_t*,SDL_wcsstr,(const wchar_t *a, const wchar_t *b),(a,b),return)
 SDL_DYNAPI_PROC(long,SDL_wcstol,(const wchar_t *a, wchar_t **b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(float,SDL_GetAudioStreamGain,(SDL_AudioStream *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_SetAudioStreamGain,(SDL_AudioStream *a, float b),(a,b),return)
+SDL_DYNAPI_PROC(float,SDL_GetAudioStreamPan,(SDL_AudioStream *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_SetAudioStreamPan,(SDL_AudioStream *a, float b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_AudioStream*,SDL_CreateAudioStreamWithProperties,(SDL_PropertiesID a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_PutAudioStreamDataNoCopy,(SDL_AudioStream *a, const void *b, int c, SDL_AudioStreamDataCompleteCallback d, void *e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(SDL_PropertiesID,SDL_GetAudioDeviceProperties,(SDL_AudioDeviceID a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_SetAudioStreamChannelMatrix,(SDL_AudioStream *a, int b, int c, const float *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(SDL_AudioStream*,SDL_OpenWAVStream_IO,(SDL_IOStream *a, SDL_bool b, SDL_AudioSpec *c),(a,b,c),return)
+SDL_DYNAPI_PROC(SDL_AudioStream*,SDL_OpenWAVStream,(const char *a, SDL_AudioSpec *b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_LoadWAVMapped_IO,(SDL_IOStream *a, SDL_bool b, SDL_AudioSpec *c, Uint8 **d, Uint32 *e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(int,SDL_LoadWAVMapped,(const char *a, SDL_AudioSpec *b, Uint8 **c, Uint32 *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(void,SDL_FreeMappedWAV,(Uint8 *a),(a),)
+SDL_DYNAPI_PROC(int,SDL_PutAudioStreamDataBatch,(SDL_AudioStreamBuffer *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_GetAudioStreamDataBatch,(SDL_AudioStreamBuffer *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(Sint64,SDL_GetAudioDevicePosition,(SDL_AudioDeviceID a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_SetAudioStreamSchedule,(SDL_AudioStream *a, Sint64 b, Sint64 c),(a,b,c),return)
@@ -32,6 +32,15 @@
 #include <limits.h>
 #endif
 
+#include "SDL_iostream_c.h"
+
+/* Files opened through stdio can be memory-mapped with their file descriptor. */
+#if defined(HAVE_STDIO_H) && (defined(SDL_PLATFORM_UNIX) || defined(SDL_PLATFORM_APPLE)) && !defined(SDL_PLATFORM_EMSCRIPTEN)
+#define SDL_IOSTREAM_MMAP
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 /* This file provides a general interface for SDL to read and write
    data sources.  It can easily be extended to files, memory, etc.
 */
@@ -946,6 +955,81 @@ void *SDL_LoadFile(const char *file, size_t *datasize)
     return SDL_LoadFile_IO(SDL_IOFromFile(file, "rb"), datasize, SDL_TRUE);
 }
 
+/* A mapping from SDL_MapIO(). `addr` is NULL for memory streams, which have nothing to unmap. */
+typedef struct IOStreamMapping
+{
+    void *addr;
+    size_t length;
+} IOStreamMapping;
+
+const void *SDL_MapIO(SDL_IOStream *context, Sint64 offset, size_t size, void **mapping)
+{
+    IOStreamMapping *iomap;
+    const Uint8 *data = NULL;
+
+    *mapping = NULL;
+
+    if (!context || offset < 0 || size == 0) {
+        return NULL;
+    }
+
+    iomap = (IOStreamMapping *)SDL_calloc(1, sizeof(*iomap));
+    if (!iomap) {
+        return NULL;
+    }
+
+    if (context->iface.read == mem_read) {
+        const IOStreamMemData *iodata = (const IOStreamMemData *)context->userdata;
+        if ((Uint64)offset <= (Uint64)(iodata->stop - iodata->base) && size <= (size_t)(iodata->stop - iodata->base - offset)) {
+            data = iodata->base + offset;
+        }
+    }
+#ifdef SDL_IOSTREAM_MMAP
+    else if (context->iface.read == stdio_read) {
+        const IOStreamStdioData *iodata = (const IOStreamStdioData *)context->userdata;
+        const Sint64 filesize = SDL_GetIOSize(context);
+        const long pagesize = sysconf(_SC_PAGESIZE);
+        if (filesize >= 0 && pagesize > 0 && offset <= filesize && (Uint64)size <= (Uint64)(filesize - offset)) {
+            /* mmap() wants the offset to be a multiple of the page size. */
+            const Sint64 mapoffset = offset - (offset % pagesize);
+            const size_t skip = (size_t)(offset - mapoffset);
+            if (size <= SDL_SIZE_MAX - skip && (Sint64)(off_t)mapoffset == mapoffset) {
+                void *addr = mmap(NULL, skip + size, PROT_READ, MAP_PRIVATE, fileno(iodata->fp), (off_t)mapoffset);
+                if (addr != MAP_FAILED) {
+                    iomap->addr = addr;
+                    iomap->length = skip + size;
+                    data = (const Uint8 *)addr + skip;
+                }
+            }
+        }
+    }
+#endif
+
+    if (!data) {
+        SDL_free(iomap);
+        return NULL;
+    }
+
+    *mapping = iomap;
+    return data;
+}
+
+void SDL_UnmapIO(void *mapping)
+{
+    IOStreamMapping *iomap = (IOStreamMapping *)mapping;
+
+    if (!iomap) {
+        return;
+    }
+
+#ifdef SDL_IOSTREAM_MMAP
+    if (iomap->addr) {
+        munmap(iomap->addr, iomap->length);
+    }
+#endif
+    SDL_free(iomap);
+}
+
 SDL_PropertiesID SDL_GetIOProperties(SDL_IOStream *context)
 {
     if (!context) {
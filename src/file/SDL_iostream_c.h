@@ -0,0 +1,37 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#ifndef SDL_iostream_c_h_
+#define SDL_iostream_c_h_
+
+/* Maps `size` bytes of `context`, starting at `offset`, into memory for
+ * reading, without copying them. This works for files on platforms that can
+ * memory-map them, and for memory streams, which just point into their
+ * memory. Returns NULL for anything else, or if the range doesn't fit in the
+ * stream. `*mapping` gets a handle that must be passed to SDL_UnmapIO() once
+ * the data isn't needed anymore. The mapping stays valid after the stream is
+ * closed; for memory streams, as long as the memory does.
+ */
+extern const void *SDL_MapIO(SDL_IOStream *context, Sint64 offset, size_t size, void **mapping);
+extern void SDL_UnmapIO(void *mapping);
+
+#endif /* SDL_iostream_c_h_ */
@@ -27,6 +27,243 @@
 #include "SDL_blit_slow.h"
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
+#include "SDL_video_c.h"
+#include "../thread/SDL_systhread.h"
+
+/* Large blits can be split into bands of rows that are blitted in parallel by
+ * a pool of worker threads, see SDL_HINT_SURFACE_BLIT_THREADS. Bands smaller
+ * than this aren't worth waking up a thread for.
+ */
+#define SDL_BLIT_MIN_PIXELS_PER_BAND (256 * 256)
+#define SDL_BLIT_MAX_THREADS         64
+
+typedef struct SDL_BlitJob
+{
+    SDL_BlitFunc func;
+    SDL_BlitInfo info;
+} SDL_BlitJob;
+
+typedef struct SDL_BlitPool
+{
+    SDL_Thread **threads;
+    int num_threads;
+    int requested_threads;
+    SDL_Semaphore *work_sem;
+    SDL_Semaphore *done_sem;
+    SDL_AtomicInt shutdown;
+    SDL_BlitJob *jobs;
+    int num_jobs;
+    SDL_AtomicInt next_job;
+} SDL_BlitPool;
+
+static SDL_SpinLock SDL_blit_pool_lock;
+static SDL_BlitPool *SDL_blit_pool;
+static SDL_bool SDL_blit_pool_busy;
+
+static void SDL_RunBlitJobs(SDL_BlitPool *pool)
+{
+    for (;;) {
+        const int i = SDL_AtomicAdd(&pool->next_job, 1);
+        if (i >= pool->num_jobs) {
+            break;
+        }
+        pool->jobs[i].func(&pool->jobs[i].info);
+    }
+}
+
+static int SDLCALL SDL_BlitWorkerThread(void *data)
+{
+    SDL_BlitPool *pool = (SDL_BlitPool *)data;
+
+    for (;;) {
+        SDL_WaitSemaphore(pool->work_sem);
+        if (SDL_AtomicGet(&pool->shutdown)) {
+            break;
+        }
+        SDL_RunBlitJobs(pool);
+        SDL_PostSemaphore(pool->done_sem);
+    }
+    return 0;
+}
+
+static void SDL_DestroyBlitPool(SDL_BlitPool *pool)
+{
+    int i;
+
+    SDL_AtomicSet(&pool->shutdown, 1);
+    for (i = 0; i < pool->num_threads; ++i) {
+        SDL_PostSemaphore(pool->work_sem);
+    }
+    for (i = 0; i < pool->num_threads; ++i) {
+        SDL_WaitThread(pool->threads[i], NULL);
+    }
+    SDL_DestroySemaphore(pool->work_sem);
+    SDL_DestroySemaphore(pool->done_sem);
+    SDL_free(pool->threads);
+    SDL_free(pool->jobs);
+    SDL_free(pool);
+}
+
+static SDL_BlitPool *SDL_CreateBlitPool(int num_threads)
+{
+    SDL_BlitPool *pool = (SDL_BlitPool *)SDL_calloc(1, sizeof(*pool));
+    int i;
+
+    if (!pool) {
+        return NULL;
+    }
+    pool->requested_threads = num_threads;
+    pool->threads = (SDL_Thread **)SDL_calloc(num_threads, sizeof(*pool->threads));
+    pool->jobs = (SDL_BlitJob *)SDL_calloc(num_threads + 1, sizeof(*pool->jobs));
+    pool->work_sem = SDL_CreateSemaphore(0);
+    pool->done_sem = SDL_CreateSemaphore(0);
+    if (!pool->threads || !pool->jobs || !pool->work_sem || !pool->done_sem) {
+        SDL_DestroyBlitPool(pool);
+        return NULL;
+    }
+
+    for (i = 0; i < num_threads; ++i) {
+        pool->threads[i] = SDL_CreateThreadInternal(SDL_BlitWorkerThread, "SDLBlitWorker", 0, pool);
+        if (!pool->threads[i]) {
+            break;
+        }
+        pool->num_threads++;
+    }
+    if (pool->num_threads == 0) {
+        SDL_DestroyBlitPool(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+/* Only one blit at a time gets the pool, any others run on their own thread.
+ * The lock only guards handing the pool over, threads are started and
+ * stopped outside of it.
+ */
+static SDL_BlitPool *SDL_AcquireBlitPool(int num_threads)
+{
+    SDL_BlitPool *pool = NULL;
+    SDL_bool acquired = SDL_FALSE;
+
+    SDL_LockSpinlock(&SDL_blit_pool_lock);
+    if (!SDL_blit_pool_busy) {
+        SDL_blit_pool_busy = SDL_TRUE;
+        pool = SDL_blit_pool;
+        SDL_blit_pool = NULL;
+        acquired = SDL_TRUE;
+    }
+    SDL_UnlockSpinlock(&SDL_blit_pool_lock);
+
+    if (!acquired) {
+        return NULL;
+    }
+    if (pool && pool->requested_threads != num_threads) {
+        SDL_DestroyBlitPool(pool);
+        pool = NULL;
+    }
+    if (!pool) {
+        pool = SDL_CreateBlitPool(num_threads);
+    }
+    if (!pool) {
+        SDL_LockSpinlock(&SDL_blit_pool_lock);
+        SDL_blit_pool_busy = SDL_FALSE;
+        SDL_UnlockSpinlock(&SDL_blit_pool_lock);
+    }
+    return pool;
+}
+
+static void SDL_ReleaseBlitPool(SDL_BlitPool *pool)
+{
+    SDL_LockSpinlock(&SDL_blit_pool_lock);
+    SDL_blit_pool = pool;
+    SDL_blit_pool_busy = SDL_FALSE;
+    SDL_UnlockSpinlock(&SDL_blit_pool_lock);
+}
+
+void SDL_QuitBlitThreads(void)
+{
+    SDL_BlitPool *pool = NULL;
+
+    SDL_LockSpinlock(&SDL_blit_pool_lock);
+    if (!SDL_blit_pool_busy) {
+        pool = SDL_blit_pool;
+        SDL_blit_pool = NULL;
+    }
+    SDL_UnlockSpinlock(&SDL_blit_pool_lock);
+
+    if (pool) {
+        SDL_DestroyBlitPool(pool);
+    }
+}
+
+/* Returns SDL_FALSE if the blit should just run on the calling thread.
+ * Bands of a scaled blit all read from the whole source rectangle and get
+ * their first row in scale_y, other bands get their own source rows.
+ */
+SDL_bool SDL_RunBlitBands(SDL_BlitFunc RunBlit, const SDL_BlitInfo *info, SDL_bool scaled)
+{
+    const Sint64 pixels = (Sint64)info->dst_w * info->dst_h;
+    SDL_BlitPool *pool;
+    const char *hint;
+    int num_threads = 0;
+    int num_bands, i;
+
+    if (pixels < 2 * SDL_BLIT_MIN_PIXELS_PER_BAND) {
+        return SDL_FALSE;
+    }
+
+    /* Overlapping blits depend on the order rows are copied in, which bands don't keep */
+    if (info->src < info->dst + (size_t)info->dst_h * info->dst_pitch &&
+        info->dst < info->src + (size_t)info->src_h * info->src_pitch) {
+        return SDL_FALSE;
+    }
+
+    hint = SDL_GetHint(SDL_HINT_SURFACE_BLIT_THREADS);
+    if (hint) {
+        num_threads = SDL_min(SDL_atoi(hint), SDL_BLIT_MAX_THREADS);
+    }
+    if (num_threads <= 0) {
+        return SDL_FALSE;
+    }
+
+    pool = SDL_AcquireBlitPool(num_threads);
+    if (!pool) {
+        return SDL_FALSE;
+    }
+
+    num_bands = (int)SDL_min(pixels / SDL_BLIT_MIN_PIXELS_PER_BAND, pool->num_threads + 1);
+    num_bands = SDL_min(num_bands, info->dst_h);
+    for (i = 0; i < num_bands; ++i) {
+        SDL_BlitJob *job = &pool->jobs[i];
+        const int y = (int)((Sint64)info->dst_h * i / num_bands);
+        const int h = (int)((Sint64)info->dst_h * (i + 1) / num_bands) - y;
+
+        job->func = RunBlit;
+        job->info = *info;
+        job->info.dst += (size_t)y * info->dst_pitch;
+        job->info.dst_h = h;
+        if (scaled) {
+            job->info.scale_y = y;
+        } else {
+            job->info.src += (size_t)y * info->src_pitch;
+            job->info.src_h = h;
+            job->info.scale_h = h;
+        }
+    }
+    pool->num_jobs = num_bands;
+    SDL_AtomicSet(&pool->next_job, 0);
+
+    for (i = 1; i < num_bands; ++i) {
+        SDL_PostSemaphore(pool->work_sem);
+    }
+    SDL_RunBlitJobs(pool);
+    for (i = 1; i < num_bands; ++i) {
+        SDL_WaitSemaphore(pool->done_sem);
+    }
+
+    SDL_ReleaseBlitPool(pool);
+    return SDL_TRUE;
+}
 
 /* The general purpose software blit routine */
 static int SDLCALL SDL_SoftBlit(SDL_Surface *src, const SDL_Rect *srcrect,
@@ -80,10 +317,14 @@ static int SDLCALL SDL_SoftBlit(SDL_Surface *src, const SDL_Rect *srcrect,
         info->dst_pitch = dst->pitch;
         info->dst_skip =
             info->dst_pitch - info->dst_w * info->dst_fmt->bytes_per_pixel;
+        info->scale_y = 0;
+        info->scale_h = info->dst_h;
         RunBlit = (SDL_BlitFunc)src->map->data;
 
         /* Run the actual software blit */
-        RunBlit(info);
+        if (!SDL_RunBlitBands(RunBlit, info, (info->flags & SDL_COPY_NEAREST) ? SDL_TRUE : SDL_FALSE)) {
+            RunBlit(info);
+        }
     }
 
     /* We need to unlock the surfaces if they're locked */
@@ -97,8 +338,6 @@ static int SDLCALL SDL_SoftBlit(SDL_Surface *src, const SDL_Rect *srcrect,
     return okay ? 0 : -1;
 }
 
-#if SDL_HAVE_BLIT_AUTO
-
 #ifdef SDL_PLATFORM_MACOS
 #include <sys/sysctl.h>
 
@@ -122,10 +361,8 @@ static SDL_bool SDL_UseAltivecPrefetch(void)
 }
 #endif /* SDL_PLATFORM_MACOS */
 
-static SDL_BlitFunc SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
-                                       SDL_BlitFuncEntry *entries)
+static unsigned int SDL_GetBlitCPUFeatures(void)
 {
-    int i, flagcheck = (flags & (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_COLORKEY | SDL_COPY_NEAREST));
     static unsigned int features = 0x7fffffff;
 
     /* Get the available CPU features */
@@ -140,6 +377,9 @@ static SDL_BlitFunc SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int
         if (SDL_HasSSE2()) {
             features |= SDL_CPU_SSE2;
         }
+        if (SDL_HasAVX2()) {
+            features |= SDL_CPU_AVX2;
+        }
         if (SDL_HasAltiVec()) {
             if (SDL_UseAltivecPrefetch()) {
                 features |= SDL_CPU_ALTIVEC_PREFETCH;
@@ -147,7 +387,20 @@ static SDL_BlitFunc SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int
                 features |= SDL_CPU_ALTIVEC_NOPREFETCH;
             }
         }
+        if (SDL_HasNEON()) {
+            features |= SDL_CPU_NEON;
+        }
     }
+    return features;
+}
+
+#if SDL_HAVE_BLIT_AUTO
+
+static SDL_BlitFunc SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
+                                       SDL_BlitFuncEntry *entries)
+{
+    int i, flagcheck = (flags & (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_COLORKEY | SDL_COPY_NEAREST));
+    const unsigned int features = SDL_GetBlitCPUFeatures();
 
     for (i = 0; entries[i].func; ++i) {
         /* Check for matching pixel formats */
@@ -175,6 +428,74 @@ static SDL_BlitFunc SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int
 }
 #endif /* SDL_HAVE_BLIT_AUTO */
 
+/* The blit function picked for formats without a palette only depends on the
+ * formats, colorspaces and copy flags, so the choice is remembered here and
+ * remapping a surface doesn't have to go through all the blitters again.
+ */
+#define SDL_BLIT_CACHE_SIZE 256
+
+typedef struct SDL_BlitCacheEntry
+{
+    Uint32 src_format;
+    Uint32 dst_format;
+    SDL_Colorspace src_colorspace;
+    SDL_Colorspace dst_colorspace;
+    int flags;
+    unsigned int cpu;
+    SDL_BlitFunc func;
+} SDL_BlitCacheEntry;
+
+static SDL_SpinLock SDL_blit_cache_lock;
+static SDL_BlitCacheEntry SDL_blit_cache[SDL_BLIT_CACHE_SIZE];
+
+static SDL_BlitCacheEntry *SDL_GetBlitCacheEntry(const SDL_BlitCacheEntry *key)
+{
+    Uint32 hash = key->src_format;
+
+    hash = hash * 31 + key->dst_format;
+    hash = hash * 31 + (Uint32)key->src_colorspace;
+    hash = hash * 31 + (Uint32)key->dst_colorspace;
+    hash = hash * 31 + (Uint32)key->flags;
+    hash ^= hash >> 16;
+    hash *= 0x45d9f3b;
+    hash ^= hash >> 16;
+    return &SDL_blit_cache[hash % SDL_BLIT_CACHE_SIZE];
+}
+
+static SDL_bool SDL_BlitCacheKeysMatch(const SDL_BlitCacheEntry *a, const SDL_BlitCacheEntry *b)
+{
+    return a->src_format == b->src_format &&
+           a->dst_format == b->dst_format &&
+           a->src_colorspace == b->src_colorspace &&
+           a->dst_colorspace == b->dst_colorspace &&
+           a->flags == b->flags &&
+           a->cpu == b->cpu;
+}
+
+static SDL_BlitFunc SDL_LookupBlitCache(const SDL_BlitCacheEntry *key)
+{
+    SDL_BlitCacheEntry *entry = SDL_GetBlitCacheEntry(key);
+    SDL_BlitFunc func = NULL;
+
+    SDL_LockSpinlock(&SDL_blit_cache_lock);
+    if (entry->func && SDL_BlitCacheKeysMatch(entry, key)) {
+        func = entry->func;
+    }
+    SDL_UnlockSpinlock(&SDL_blit_cache_lock);
+
+    return func;
+}
+
+static void SDL_AddBlitCache(const SDL_BlitCacheEntry *key, SDL_BlitFunc func)
+{
+    SDL_BlitCacheEntry *entry = SDL_GetBlitCacheEntry(key);
+
+    SDL_LockSpinlock(&SDL_blit_cache_lock);
+    *entry = *key;
+    entry->func = func;
+    SDL_UnlockSpinlock(&SDL_blit_cache_lock);
+}
+
 /* Figure out which of many blit routines to set up on a surface */
 int SDL_CalculateBlit(SDL_Surface *surface)
 {
@@ -183,6 +504,8 @@ int SDL_CalculateBlit(SDL_Surface *surface)
     SDL_Surface *dst = map->dst;
     SDL_Colorspace src_colorspace = SDL_COLORSPACE_UNKNOWN;
     SDL_Colorspace dst_colorspace = SDL_COLORSPACE_UNKNOWN;
+    SDL_BlitCacheEntry cache_key;
+    SDL_bool use_cache;
 
     if (SDL_GetSurfaceColorspace(surface, &src_colorspace) < 0) {
         return -1;
@@ -221,6 +544,24 @@ int SDL_CalculateBlit(SDL_Surface *surface)
     }
 #endif
 
+    /* Palettes change the choice, so only blits between other formats are cached */
+    use_cache = !SDL_ISPIXELFORMAT_INDEXED(surface->format->format) &&
+                !SDL_ISPIXELFORMAT_INDEXED(dst->format->format);
+    if (use_cache) {
+        SDL_zero(cache_key);
+        cache_key.src_format = surface->format->format;
+        cache_key.dst_format = dst->format->format;
+        cache_key.src_colorspace = src_colorspace;
+        cache_key.dst_colorspace = dst_colorspace;
+        cache_key.flags = map->info.flags;
+        cache_key.cpu = SDL_GetBlitCPUFeatures();
+        blit = SDL_LookupBlitCache(&cache_key);
+        if (blit) {
+            map->data = (void *)blit;
+            return 0;
+        }
+    }
+
     /* Choose a standard blit function */
     if (!blit) {
         if (src_colorspace != dst_colorspace ||
@@ -291,5 +632,9 @@ int SDL_CalculateBlit(SDL_Surface *surface)
         return SDL_SetError("Blit combination not supported");
     }
 
+    if (use_cache) {
+        SDL_AddBlitCache(&cache_key, blit);
+    }
+
     return 0;
 }
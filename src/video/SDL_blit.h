@@ -54,6 +54,8 @@ extern Uint16 SDL_expand_byte10[];
 #define SDL_CPU_SSE2               0x00000004
 #define SDL_CPU_ALTIVEC_PREFETCH   0x00000008
 #define SDL_CPU_ALTIVEC_NOPREFETCH 0x00000010
+#define SDL_CPU_AVX2               0x00000020
+#define SDL_CPU_NEON               0x00000040
 
 typedef struct
 {
@@ -67,6 +69,7 @@ typedef struct
     int dst_w, dst_h;
     int dst_pitch;
     int dst_skip;
+    int scale_y, scale_h; /* for scaled blits, the first row and full height of the scaled area */
     SDL_PixelFormat *src_fmt;
     SDL_PixelFormat *dst_fmt;
     Uint8 *table;
@@ -104,6 +107,7 @@ struct SDL_BlitMap
 
 /* Functions found in SDL_blit.c */
 extern int SDL_CalculateBlit(SDL_Surface *surface);
+extern SDL_bool SDL_RunBlitBands(SDL_BlitFunc RunBlit, const SDL_BlitInfo *info, SDL_bool scaled);
 
 /* Functions found in SDL_blit_*.c */
 extern SDL_BlitFunc SDL_CalculateBlit0(SDL_Surface *surface);
@@ -411,6 +411,284 @@ static void SDL_TARGETING("mmx") BlitRGBtoRGBPixelAlphaMMX(SDL_BlitInfo *info)
 
 #endif /* SDL_MMX_INTRINSICS */
 
+#if defined(SDL_SSE4_1_INTRINSICS) || defined(SDL_AVX2_INTRINSICS)
+
+/* The SSE4.1 and AVX2 blitters below handle any pair of formats with 8 bits
+   per channel in 4 bytes per pixel: ARGB, ABGR, RGBA, BGRA and their
+   variants without alpha. They do the same math as ALPHA_BLEND_RGBA in
+   BlitNtoNPixelAlpha and BlitNtoNSurfaceAlpha, including the division by
+   255 and its rounding, so they produce exactly the same pixels. */
+static SDL_bool SDL_Is8888Format(const SDL_PixelFormat *fmt)
+{
+    return fmt->bytes_per_pixel == 4 &&
+           fmt->Rloss == 0 && fmt->Gloss == 0 && fmt->Bloss == 0 &&
+           fmt->Rshift % 8 == 0 && fmt->Gshift % 8 == 0 && fmt->Bshift % 8 == 0 &&
+           (fmt->Amask == 0 || (fmt->Aloss == 0 && fmt->Ashift % 8 == 0));
+}
+
+/* Byte shuffle masks for 16 bytes (4 pixels) at a time */
+typedef struct
+{
+    Uint8 src_to_dst[16]; /* moves source R, G and B to where the destination keeps them */
+    Uint8 src_alpha[16];  /* repeats source alpha across each pixel */
+    Uint8 dst_alpha[16];  /* 0xFF on destination alpha bytes */
+    Uint8 dst_unused[16]; /* 0xFF on the unused byte of a destination without alpha, which gets cleared */
+} SDL_Blit8888AlphaMasks;
+
+static int SDL_PixelByte(Uint8 shift)
+{
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+    return shift / 8;
+#else
+    return 3 - shift / 8;
+#endif
+}
+
+static void SDL_Setup8888AlphaMasks(const SDL_PixelFormat *sf, const SDL_PixelFormat *df, SDL_Blit8888AlphaMasks *masks)
+{
+    Uint8 src_to_dst[4], src_alpha[4], dst_alpha[4], dst_unused[4];
+    int i;
+
+    SDL_memset(src_to_dst, 0x80, sizeof(src_to_dst));
+    src_to_dst[SDL_PixelByte(df->Rshift)] = (Uint8)SDL_PixelByte(sf->Rshift);
+    src_to_dst[SDL_PixelByte(df->Gshift)] = (Uint8)SDL_PixelByte(sf->Gshift);
+    src_to_dst[SDL_PixelByte(df->Bshift)] = (Uint8)SDL_PixelByte(sf->Bshift);
+
+    SDL_memset(src_alpha, sf->Amask ? SDL_PixelByte(sf->Ashift) : 0x80, sizeof(src_alpha));
+
+    /* Whichever byte isn't R, G or B holds the alpha, or is unused */
+    SDL_memset(dst_alpha, 0, sizeof(dst_alpha));
+    SDL_memset(dst_unused, 0, sizeof(dst_unused));
+    for (i = 0; i < 4; ++i) {
+        if (src_to_dst[i] == 0x80) {
+            if (df->Amask) {
+                dst_alpha[i] = 0xFF;
+            } else {
+                dst_unused[i] = 0xFF;
+            }
+        }
+    }
+
+    for (i = 0; i < 16; ++i) {
+        const int pixel = i & ~3;
+        masks->src_to_dst[i] = (src_to_dst[i & 3] == 0x80) ? 0x80 : (Uint8)(pixel + src_to_dst[i & 3]);
+        masks->src_alpha[i] = (src_alpha[i & 3] == 0x80) ? 0x80 : (Uint8)(pixel + src_alpha[i & 3]);
+        masks->dst_alpha[i] = dst_alpha[i & 3];
+        masks->dst_unused[i] = dst_unused[i & 3];
+    }
+}
+
+#endif /* SDL_SSE4_1_INTRINSICS || SDL_AVX2_INTRINSICS */
+
+#ifdef SDL_SSE4_1_INTRINSICS
+
+/* x / 255 for x in [0, 65025], rounding down */
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Div255SSE41(__m128i x)
+{
+    return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(x, _mm_set1_epi16(1)), _mm_srli_epi16(x, 8)), 8);
+}
+
+/* Blends 8 channels of 2 pixels, widened to 16 bits. Colors get d + (s - d) * a / 255, rounded toward zero,
+   and alpha gets a + d - a * d / 255, like ALPHA_BLEND_RGBA. */
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_BlendColors16SSE41(__m128i s, __m128i d, __m128i a)
+{
+    const __m128i diff = _mm_sub_epi16(s, d);
+    return _mm_add_epi16(d, _mm_sign_epi16(SDL_Div255SSE41(_mm_mullo_epi16(_mm_abs_epi16(diff), a)), diff));
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_BlendAlpha16SSE41(__m128i d, __m128i a)
+{
+    return _mm_sub_epi16(_mm_add_epi16(a, d), SDL_Div255SSE41(_mm_mullo_epi16(a, d)));
+}
+
+/* Blends 4 pixels, `s` already shuffled into the destination layout, `a` the source alpha of each byte */
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blend8888SSE41(__m128i s, __m128i d, __m128i a, __m128i dst_alpha, __m128i dst_unused)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i slo = _mm_unpacklo_epi8(s, zero), shi = _mm_unpackhi_epi8(s, zero);
+    const __m128i dlo = _mm_unpacklo_epi8(d, zero), dhi = _mm_unpackhi_epi8(d, zero);
+    const __m128i alo = _mm_unpacklo_epi8(a, zero), ahi = _mm_unpackhi_epi8(a, zero);
+    const __m128i colors = _mm_packus_epi16(SDL_BlendColors16SSE41(slo, dlo, alo), SDL_BlendColors16SSE41(shi, dhi, ahi));
+    const __m128i alphas = _mm_packus_epi16(SDL_BlendAlpha16SSE41(dlo, alo), SDL_BlendAlpha16SSE41(dhi, ahi));
+    const __m128i result = _mm_andnot_si128(dst_unused, _mm_blendv_epi8(colors, alphas, dst_alpha));
+
+    /* Fully transparent source pixels leave the destination alone */
+    return _mm_blendv_epi8(result, d, _mm_cmpeq_epi8(a, zero));
+}
+
+static void SDL_TARGETING("sse4.1") Blit8888AlphaSSE41(SDL_BlitInfo *info, SDL_bool surface_alpha)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *)info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *)info->dst;
+    int dstskip = info->dst_skip >> 2;
+    SDL_Blit8888AlphaMasks masks;
+    __m128i src_to_dst, src_alpha, dst_alpha, dst_unused, mm_alpha;
+
+    SDL_Setup8888AlphaMasks(info->src_fmt, info->dst_fmt, &masks);
+    src_to_dst = _mm_loadu_si128((const __m128i *)masks.src_to_dst);
+    src_alpha = _mm_loadu_si128((const __m128i *)masks.src_alpha);
+    dst_alpha = _mm_loadu_si128((const __m128i *)masks.dst_alpha);
+    dst_unused = _mm_loadu_si128((const __m128i *)masks.dst_unused);
+    mm_alpha = _mm_set1_epi8((char)info->a);
+
+    while (height--) {
+        int n = width;
+
+        while (n > 0) {
+            Uint32 stmp[4], dtmp[4];
+            const int count = SDL_min(n, 4);
+            const Uint32 *s4 = srcp;
+            Uint32 *d4 = dstp;
+            __m128i src, dst;
+
+            /* Leftover pixels at the end of a row go through a small buffer */
+            if (count < 4) {
+                SDL_memcpy(stmp, srcp, count * sizeof(Uint32));
+                SDL_memcpy(dtmp, dstp, count * sizeof(Uint32));
+                s4 = stmp;
+                d4 = dtmp;
+            }
+
+            src = _mm_loadu_si128((const __m128i *)s4);
+            dst = _mm_loadu_si128((const __m128i *)d4);
+            _mm_storeu_si128((__m128i *)d4, SDL_Blend8888SSE41(_mm_shuffle_epi8(src, src_to_dst), dst,
+                                                                  surface_alpha ? mm_alpha : _mm_shuffle_epi8(src, src_alpha),
+                                                                  dst_alpha, dst_unused));
+            if (count < 4) {
+                SDL_memcpy(dstp, dtmp, count * sizeof(Uint32));
+            }
+
+            srcp += count;
+            dstp += count;
+            n -= count;
+        }
+
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* 8888->8888 blending with pixel alpha */
+static void SDL_TARGETING("sse4.1") Blit8888PixelAlphaSSE41(SDL_BlitInfo *info)
+{
+    Blit8888AlphaSSE41(info, SDL_FALSE);
+}
+
+/* 8888->8888 blending with surface alpha */
+static void SDL_TARGETING("sse4.1") Blit8888SurfaceAlphaSSE41(SDL_BlitInfo *info)
+{
+    if (info->a) {
+        Blit8888AlphaSSE41(info, SDL_TRUE);
+    }
+}
+
+#endif /* SDL_SSE4_1_INTRINSICS */
+
+#ifdef SDL_AVX2_INTRINSICS
+
+/* Same as the SSE4.1 versions above, 8 pixels at a time */
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Div255AVX2(__m256i x)
+{
+    return _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(x, _mm256_set1_epi16(1)), _mm256_srli_epi16(x, 8)), 8);
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_BlendColors16AVX2(__m256i s, __m256i d, __m256i a)
+{
+    const __m256i diff = _mm256_sub_epi16(s, d);
+    return _mm256_add_epi16(d, _mm256_sign_epi16(SDL_Div255AVX2(_mm256_mullo_epi16(_mm256_abs_epi16(diff), a)), diff));
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_BlendAlpha16AVX2(__m256i d, __m256i a)
+{
+    return _mm256_sub_epi16(_mm256_add_epi16(a, d), SDL_Div255AVX2(_mm256_mullo_epi16(a, d)));
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blend8888AVX2(__m256i s, __m256i d, __m256i a, __m256i dst_alpha, __m256i dst_unused)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i slo = _mm256_unpacklo_epi8(s, zero), shi = _mm256_unpackhi_epi8(s, zero);
+    const __m256i dlo = _mm256_unpacklo_epi8(d, zero), dhi = _mm256_unpackhi_epi8(d, zero);
+    const __m256i alo = _mm256_unpacklo_epi8(a, zero), ahi = _mm256_unpackhi_epi8(a, zero);
+    const __m256i colors = _mm256_packus_epi16(SDL_BlendColors16AVX2(slo, dlo, alo), SDL_BlendColors16AVX2(shi, dhi, ahi));
+    const __m256i alphas = _mm256_packus_epi16(SDL_BlendAlpha16AVX2(dlo, alo), SDL_BlendAlpha16AVX2(dhi, ahi));
+    const __m256i result = _mm256_andnot_si256(dst_unused, _mm256_blendv_epi8(colors, alphas, dst_alpha));
+
+    return _mm256_blendv_epi8(result, d, _mm256_cmpeq_epi8(a, zero));
+}
+
+static void SDL_TARGETING("avx2") Blit8888AlphaAVX2(SDL_BlitInfo *info, SDL_bool surface_alpha)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *)info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *)info->dst;
+    int dstskip = info->dst_skip >> 2;
+    SDL_Blit8888AlphaMasks masks;
+    __m256i src_to_dst, src_alpha, dst_alpha, dst_unused, mm_alpha;
+
+    SDL_Setup8888AlphaMasks(info->src_fmt, info->dst_fmt, &masks);
+    src_to_dst = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)masks.src_to_dst));
+    src_alpha = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)masks.src_alpha));
+    dst_alpha = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)masks.dst_alpha));
+    dst_unused = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)masks.dst_unused));
+    mm_alpha = _mm256_set1_epi8((char)info->a);
+
+    while (height--) {
+        int n = width;
+
+        while (n > 0) {
+            Uint32 stmp[8], dtmp[8];
+            const int count = SDL_min(n, 8);
+            const Uint32 *s8 = srcp;
+            Uint32 *d8 = dstp;
+            __m256i src, dst;
+
+            if (count < 8) {
+                SDL_memcpy(stmp, srcp, count * sizeof(Uint32));
+                SDL_memcpy(dtmp, dstp, count * sizeof(Uint32));
+                s8 = stmp;
+                d8 = dtmp;
+            }
+
+            src = _mm256_loadu_si256((const __m256i *)s8);
+            dst = _mm256_loadu_si256((const __m256i *)d8);
+            _mm256_storeu_si256((__m256i *)d8, SDL_Blend8888AVX2(_mm256_shuffle_epi8(src, src_to_dst), dst,
+                                                                    surface_alpha ? mm_alpha : _mm256_shuffle_epi8(src, src_alpha),
+                                                                    dst_alpha, dst_unused));
+            if (count < 8) {
+                SDL_memcpy(dstp, dtmp, count * sizeof(Uint32));
+            }
+
+            srcp += count;
+            dstp += count;
+            n -= count;
+        }
+
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* 8888->8888 blending with pixel alpha */
+static void SDL_TARGETING("avx2") Blit8888PixelAlphaAVX2(SDL_BlitInfo *info)
+{
+    Blit8888AlphaAVX2(info, SDL_FALSE);
+}
+
+/* 8888->8888 blending with surface alpha */
+static void SDL_TARGETING("avx2") Blit8888SurfaceAlphaAVX2(SDL_BlitInfo *info)
+{
+    if (info->a) {
+        Blit8888AlphaAVX2(info, SDL_TRUE);
+    }
+}
+
+#endif /* SDL_AVX2_INTRINSICS */
+
 #ifdef SDL_ARM_SIMD_BLITTERS
 void BlitARGBto565PixelAlphaARMSIMDAsm(int32_t w, int32_t h, uint16_t *dst, int32_t dst_stride, uint32_t *src, int32_t src_stride);
 
@@ -1358,6 +1636,20 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
             return BlitNtoNPixelAlpha;
 
         case 4:
+#if defined(SDL_SSE4_1_INTRINSICS) || defined(SDL_AVX2_INTRINSICS)
+            if (sf->Amask && SDL_Is8888Format(sf) && SDL_Is8888Format(df)) {
+#ifdef SDL_AVX2_INTRINSICS
+                if (SDL_HasAVX2()) {
+                    return Blit8888PixelAlphaAVX2;
+                }
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+                if (SDL_HasSSE41()) {
+                    return Blit8888PixelAlphaSSE41;
+                }
+#endif
+            }
+#endif
             if (sf->Rmask == df->Rmask && sf->Gmask == df->Gmask && sf->Bmask == df->Bmask && sf->bytes_per_pixel == 4) {
 #ifdef SDL_MMX_INTRINSICS
                 if (sf->Rshift % 8 == 0 && sf->Gshift % 8 == 0 && sf->Bshift % 8 == 0 && sf->Ashift % 8 == 0 && sf->Aloss == 0) {
@@ -1429,6 +1721,20 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
                 return BlitNtoNSurfaceAlpha;
 
             case 4:
+#if defined(SDL_SSE4_1_INTRINSICS) || defined(SDL_AVX2_INTRINSICS)
+                if (SDL_Is8888Format(sf) && SDL_Is8888Format(df)) {
+#ifdef SDL_AVX2_INTRINSICS
+                    if (SDL_HasAVX2()) {
+                        return Blit8888SurfaceAlphaAVX2;
+                    }
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+                    if (SDL_HasSSE41()) {
+                        return Blit8888SurfaceAlphaSSE41;
+                    }
+#endif
+                }
+#endif
                 if (sf->Rmask == df->Rmask && sf->Gmask == df->Gmask && sf->Bmask == df->Bmask && sf->bytes_per_pixel == 4) {
 #ifdef SDL_MMX_INTRINSICS
                     if (sf->Rshift % 8 == 0 && sf->Gshift % 8 == 0 && sf->Bshift % 8 == 0 && SDL_HasMMX()) {
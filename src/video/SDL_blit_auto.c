@@ -34,9 +34,9 @@ static void SDL_Blit_XRGB8888_XRGB8888_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -117,9 +117,9 @@ static void SDL_Blit_XRGB8888_XRGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -210,9 +210,9 @@ static void SDL_Blit_XRGB8888_XRGB8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -324,9 +324,9 @@ static void SDL_Blit_XRGB8888_XRGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -395,9 +395,9 @@ static void SDL_Blit_XRGB8888_XBGR8888_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -481,9 +481,9 @@ static void SDL_Blit_XRGB8888_XBGR8888_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -574,9 +574,9 @@ static void SDL_Blit_XRGB8888_XBGR8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -688,9 +688,9 @@ static void SDL_Blit_XRGB8888_XBGR8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -759,9 +759,9 @@ static void SDL_Blit_XRGB8888_ARGB8888_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -845,9 +845,9 @@ static void SDL_Blit_XRGB8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -943,9 +943,9 @@ static void SDL_Blit_XRGB8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -1058,9 +1058,9 @@ static void SDL_Blit_XRGB8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -1130,9 +1130,9 @@ static void SDL_Blit_XBGR8888_XRGB8888_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -1216,9 +1216,9 @@ static void SDL_Blit_XBGR8888_XRGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -1309,9 +1309,9 @@ static void SDL_Blit_XBGR8888_XRGB8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -1423,9 +1423,9 @@ static void SDL_Blit_XBGR8888_XRGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -1492,9 +1492,9 @@ static void SDL_Blit_XBGR8888_XBGR8888_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -1575,9 +1575,9 @@ static void SDL_Blit_XBGR8888_XBGR8888_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -1668,9 +1668,9 @@ static void SDL_Blit_XBGR8888_XBGR8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -1782,9 +1782,9 @@ static void SDL_Blit_XBGR8888_XBGR8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -1854,9 +1854,9 @@ static void SDL_Blit_XBGR8888_ARGB8888_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -1941,9 +1941,9 @@ static void SDL_Blit_XBGR8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -2039,9 +2039,9 @@ static void SDL_Blit_XBGR8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -2154,9 +2154,9 @@ static void SDL_Blit_XBGR8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -2225,9 +2225,9 @@ static void SDL_Blit_ARGB8888_XRGB8888_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -2318,9 +2318,9 @@ static void SDL_Blit_ARGB8888_XRGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -2419,9 +2419,9 @@ static void SDL_Blit_ARGB8888_XRGB8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -2534,9 +2534,9 @@ static void SDL_Blit_ARGB8888_XRGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -2608,9 +2608,9 @@ static void SDL_Blit_ARGB8888_XBGR8888_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -2702,9 +2702,9 @@ static void SDL_Blit_ARGB8888_XBGR8888_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -2803,9 +2803,9 @@ static void SDL_Blit_ARGB8888_XBGR8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -2918,9 +2918,9 @@ static void SDL_Blit_ARGB8888_XBGR8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -2990,9 +2990,9 @@ static void SDL_Blit_ARGB8888_ARGB8888_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -3082,9 +3082,9 @@ static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -3189,9 +3189,9 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -3308,9 +3308,9 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -3382,9 +3382,9 @@ static void SDL_Blit_RGBA8888_XRGB8888_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -3475,9 +3475,9 @@ static void SDL_Blit_RGBA8888_XRGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -3576,9 +3576,9 @@ static void SDL_Blit_RGBA8888_XRGB8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -3691,9 +3691,9 @@ static void SDL_Blit_RGBA8888_XRGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -3765,9 +3765,9 @@ static void SDL_Blit_RGBA8888_XBGR8888_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -3859,9 +3859,9 @@ static void SDL_Blit_RGBA8888_XBGR8888_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -3960,9 +3960,9 @@ static void SDL_Blit_RGBA8888_XBGR8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -4075,9 +4075,9 @@ static void SDL_Blit_RGBA8888_XBGR8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -4148,9 +4148,9 @@ static void SDL_Blit_RGBA8888_ARGB8888_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -4242,9 +4242,9 @@ static void SDL_Blit_RGBA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -4349,9 +4349,9 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -4468,9 +4468,9 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -4543,9 +4543,9 @@ static void SDL_Blit_ABGR8888_XRGB8888_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -4637,9 +4637,9 @@ static void SDL_Blit_ABGR8888_XRGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -4738,9 +4738,9 @@ static void SDL_Blit_ABGR8888_XRGB8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -4853,9 +4853,9 @@ static void SDL_Blit_ABGR8888_XRGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -4926,9 +4926,9 @@ static void SDL_Blit_ABGR8888_XBGR8888_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -5019,9 +5019,9 @@ static void SDL_Blit_ABGR8888_XBGR8888_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -5120,9 +5120,9 @@ static void SDL_Blit_ABGR8888_XBGR8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -5235,9 +5235,9 @@ static void SDL_Blit_ABGR8888_XBGR8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -5309,9 +5309,9 @@ static void SDL_Blit_ABGR8888_ARGB8888_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -5404,9 +5404,9 @@ static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -5511,9 +5511,9 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -5630,9 +5630,9 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -5705,9 +5705,9 @@ static void SDL_Blit_BGRA8888_XRGB8888_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -5799,9 +5799,9 @@ static void SDL_Blit_BGRA8888_XRGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -5900,9 +5900,9 @@ static void SDL_Blit_BGRA8888_XRGB8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -6015,9 +6015,9 @@ static void SDL_Blit_BGRA8888_XRGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -6088,9 +6088,9 @@ static void SDL_Blit_BGRA8888_XBGR8888_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -6181,9 +6181,9 @@ static void SDL_Blit_BGRA8888_XBGR8888_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -6282,9 +6282,9 @@ static void SDL_Blit_BGRA8888_XBGR8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -6397,9 +6397,9 @@ static void SDL_Blit_BGRA8888_XBGR8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -6471,9 +6471,9 @@ static void SDL_Blit_BGRA8888_ARGB8888_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -6566,9 +6566,9 @@ static void SDL_Blit_BGRA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -6673,9 +6673,9 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -6792,9 +6792,9 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     Uint64 posy, posx;
     Uint64 incy, incx;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         Uint32 *src = 0;
@@ -6859,132 +6859,17476 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_AVX2_INTRINSICS
+
+#define VEC_T           __m256i
+#define VEC_WIDTH       8
+#define VEC_LOAD(p)     _mm256_loadu_si256((const __m256i *)(p))
+#define VEC_STORE(p, v) _mm256_storeu_si256((__m256i *)(p), v)
+#define VEC_SET1(x)     _mm256_set1_epi32((int)(x))
+#define VEC_SHR(v, n)   _mm256_srli_epi32(v, n)
+#define VEC_SHL(v, n)   _mm256_slli_epi32(v, n)
+#define VEC_AND255(v)   _mm256_and_si256(v, _mm256_set1_epi32(0xFF))
+#define VEC_OR(a, b)    _mm256_or_si256(a, b)
+#define VEC_ADD(a, b)   _mm256_add_epi32(a, b)
+#define VEC_SUB(a, b)   _mm256_sub_epi32(a, b)
+#define VEC_MUL(a, b)   _mm256_mullo_epi16(a, b)
+#define VEC_MIN255(v)   _mm256_min_epi16(v, _mm256_set1_epi32(0xFF))
+
+/* Exact up to 65534, the multiply blend clamps anything larger to 255 */
+#define VEC_DIV255(v)   VEC_SHR(VEC_ADD(VEC_ADD(v, VEC_SET1(1)), VEC_SHR(v, 8)), 8)
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_XRGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_XRGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_XRGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcR, 16), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_XRGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcR, 16), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_XRGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_XRGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_XBGR8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_XBGR8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_XBGR8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcB, 16), VEC_SHL(srcG, 8)), srcR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_XBGR8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcB, 16), VEC_SHL(srcG, 8)), srcR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_XBGR8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_XBGR8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                dstA = VEC_SET1(0xFF);
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                dstA = VEC_SET1(0xFF);
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(srcA, 24), VEC_SHL(srcR, 16)), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(srcA, 24), VEC_SHL(srcR, 16)), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_XRGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_XRGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_XRGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcR, 16), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_XRGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcR, 16), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_XRGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_XRGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_XBGR8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_XBGR8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_XBGR8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcB, 16), VEC_SHL(srcG, 8)), srcR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_XBGR8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcB, 16), VEC_SHL(srcG, 8)), srcR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_XBGR8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_XBGR8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                dstA = VEC_SET1(0xFF);
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                dstA = VEC_SET1(0xFF);
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(srcA, 24), VEC_SHL(srcR, 16)), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(srcA, 24), VEC_SHL(srcR, 16)), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_XRGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_XRGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_XRGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcR, 16), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_XRGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcR, 16), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_XRGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_XRGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_XBGR8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_XBGR8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_XBGR8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcB, 16), VEC_SHL(srcG, 8)), srcR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_XBGR8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcB, 16), VEC_SHL(srcG, 8)), srcR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_XBGR8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_XBGR8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(srcA, 24), VEC_SHL(srcR, 16)), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(srcA, 24), VEC_SHL(srcR, 16)), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_XRGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_XRGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_XRGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcR, 16), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_XRGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcR, 16), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_XRGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_XRGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_XBGR8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_XBGR8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_XBGR8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcB, 16), VEC_SHL(srcG, 8)), srcR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_XBGR8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcB, 16), VEC_SHL(srcG, 8)), srcR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_XBGR8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_XBGR8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(srcA, 24), VEC_SHL(srcR, 16)), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(srcA, 24), VEC_SHL(srcR, 16)), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_XRGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_XRGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_XRGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcR, 16), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_XRGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcR, 16), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_XRGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_XRGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_XBGR8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_XBGR8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_XBGR8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcB, 16), VEC_SHL(srcG, 8)), srcR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_XBGR8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcB, 16), VEC_SHL(srcG, 8)), srcR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_XBGR8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_XBGR8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(srcA, 24), VEC_SHL(srcR, 16)), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(srcA, 24), VEC_SHL(srcR, 16)), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_XRGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_XRGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_XRGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcR, 16), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_XRGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcR, 16), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_XRGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_XRGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_XBGR8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_XBGR8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_XBGR8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcB, 16), VEC_SHL(srcG, 8)), srcR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_XBGR8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcB, 16), VEC_SHL(srcG, 8)), srcR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_XBGR8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_XBGR8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(srcA, 24), VEC_SHL(srcR, 16)), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(srcA, 24), VEC_SHL(srcR, 16)), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#undef VEC_T
+#undef VEC_WIDTH
+#undef VEC_LOAD
+#undef VEC_STORE
+#undef VEC_SET1
+#undef VEC_SHR
+#undef VEC_SHL
+#undef VEC_AND255
+#undef VEC_OR
+#undef VEC_ADD
+#undef VEC_SUB
+#undef VEC_MUL
+#undef VEC_MIN255
+#undef VEC_DIV255
+
+#endif /* SDL_AVX2_INTRINSICS */
+
+#ifdef SDL_SSE2_INTRINSICS
+
+#define VEC_T           __m128i
+#define VEC_WIDTH       4
+#define VEC_LOAD(p)     _mm_loadu_si128((const __m128i *)(p))
+#define VEC_STORE(p, v) _mm_storeu_si128((__m128i *)(p), v)
+#define VEC_SET1(x)     _mm_set1_epi32((int)(x))
+#define VEC_SHR(v, n)   _mm_srli_epi32(v, n)
+#define VEC_SHL(v, n)   _mm_slli_epi32(v, n)
+#define VEC_AND255(v)   _mm_and_si128(v, _mm_set1_epi32(0xFF))
+#define VEC_OR(a, b)    _mm_or_si128(a, b)
+#define VEC_ADD(a, b)   _mm_add_epi32(a, b)
+#define VEC_SUB(a, b)   _mm_sub_epi32(a, b)
+#define VEC_MUL(a, b)   _mm_mullo_epi16(a, b)
+#define VEC_MIN255(v)   _mm_min_epi16(v, _mm_set1_epi32(0xFF))
+
+/* Exact up to 65534, the multiply blend clamps anything larger to 255 */
+#define VEC_DIV255(v)   VEC_SHR(VEC_ADD(VEC_ADD(v, VEC_SET1(1)), VEC_SHR(v, 8)), 8)
+
+static void SDL_TARGETING("sse2") SDL_Blit_XRGB8888_XRGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XRGB8888_XRGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XRGB8888_XRGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcR, 16), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XRGB8888_XRGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcR, 16), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XRGB8888_XRGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XRGB8888_XRGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XRGB8888_XBGR8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XRGB8888_XBGR8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XRGB8888_XBGR8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcB, 16), VEC_SHL(srcG, 8)), srcR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XRGB8888_XBGR8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcB, 16), VEC_SHL(srcG, 8)), srcR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XRGB8888_XBGR8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XRGB8888_XBGR8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XRGB8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                dstA = VEC_SET1(0xFF);
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XRGB8888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                dstA = VEC_SET1(0xFF);
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XRGB8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(srcA, 24), VEC_SHL(srcR, 16)), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XRGB8888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(srcA, 24), VEC_SHL(srcR, 16)), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XRGB8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XRGB8888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XBGR8888_XRGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XBGR8888_XRGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XBGR8888_XRGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcR, 16), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XBGR8888_XRGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcR, 16), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XBGR8888_XRGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XBGR8888_XRGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XBGR8888_XBGR8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XBGR8888_XBGR8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XBGR8888_XBGR8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcB, 16), VEC_SHL(srcG, 8)), srcR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XBGR8888_XBGR8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcB, 16), VEC_SHL(srcG, 8)), srcR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XBGR8888_XBGR8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XBGR8888_XBGR8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XBGR8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                dstA = VEC_SET1(0xFF);
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XBGR8888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                dstA = VEC_SET1(0xFF);
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XBGR8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(srcA, 24), VEC_SHL(srcR, 16)), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XBGR8888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(srcA, 24), VEC_SHL(srcR, 16)), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XBGR8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_XBGR8888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ARGB8888_XRGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ARGB8888_XRGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ARGB8888_XRGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcR, 16), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ARGB8888_XRGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcR, 16), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ARGB8888_XRGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ARGB8888_XRGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ARGB8888_XBGR8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ARGB8888_XBGR8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ARGB8888_XBGR8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcB, 16), VEC_SHL(srcG, 8)), srcR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ARGB8888_XBGR8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcB, 16), VEC_SHL(srcG, 8)), srcR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ARGB8888_XBGR8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ARGB8888_XBGR8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ARGB8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(srcA, 24), VEC_SHL(srcR, 16)), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(srcA, 24), VEC_SHL(srcR, 16)), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(srcpixel);
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_RGBA8888_XRGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_RGBA8888_XRGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_RGBA8888_XRGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcR, 16), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_RGBA8888_XRGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcR, 16), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_RGBA8888_XRGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_RGBA8888_XRGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_RGBA8888_XBGR8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_RGBA8888_XBGR8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_RGBA8888_XBGR8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcB, 16), VEC_SHL(srcG, 8)), srcR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_RGBA8888_XBGR8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcB, 16), VEC_SHL(srcG, 8)), srcR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_RGBA8888_XBGR8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_RGBA8888_XBGR8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_RGBA8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(srcA, 24), VEC_SHL(srcR, 16)), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(srcA, 24), VEC_SHL(srcR, 16)), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_SHR(srcpixel, 24);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ABGR8888_XRGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ABGR8888_XRGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ABGR8888_XRGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcR, 16), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ABGR8888_XRGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcR, 16), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ABGR8888_XRGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ABGR8888_XRGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ABGR8888_XBGR8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ABGR8888_XBGR8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ABGR8888_XBGR8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcB, 16), VEC_SHL(srcG, 8)), srcR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ABGR8888_XBGR8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcB, 16), VEC_SHL(srcG, 8)), srcR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ABGR8888_XBGR8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ABGR8888_XBGR8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ABGR8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(srcA, 24), VEC_SHL(srcR, 16)), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(srcA, 24), VEC_SHL(srcR, 16)), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(srcpixel);
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcB = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcA = VEC_SHR(srcpixel, 24);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_BGRA8888_XRGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_BGRA8888_XRGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_BGRA8888_XRGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcR, 16), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_BGRA8888_XRGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcR, 16), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_BGRA8888_XRGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_BGRA8888_XRGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstR, 16), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_BGRA8888_XBGR8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_BGRA8888_XBGR8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_BGRA8888_XBGR8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcB, 16), VEC_SHL(srcG, 8)), srcR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_BGRA8888_XBGR8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    VEC_T srcpixel, srcR, srcG, srcB;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(srcB, 16), VEC_SHL(srcG, 8)), srcR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_BGRA8888_XBGR8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_BGRA8888_XBGR8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(dstpixel);
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(VEC_SHR(dstpixel, 16));
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_SHL(dstB, 16), VEC_SHL(dstG, 8)), dstR);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_BGRA8888_ARGB8888_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(srcA, 24), VEC_SHL(srcR, 16)), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(srcA, 24), VEC_SHL(srcR, 16)), VEC_SHL(srcG, 8)), srcB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_SSE2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+    const VEC_T modulateA = VEC_SET1(info->a);
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+    VEC_T srcInv;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * 4));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+            srcR = VEC_AND255(VEC_SHR(srcpixel, 8));
+            srcG = VEC_AND255(VEC_SHR(srcpixel, 16));
+            srcB = VEC_SHR(srcpixel, 24);
+            srcA = VEC_AND255(srcpixel);
+            dstR = VEC_AND255(VEC_SHR(dstpixel, 16));
+            dstG = VEC_AND255(VEC_SHR(dstpixel, 8));
+            dstB = VEC_AND255(dstpixel);
+            dstA = VEC_SHR(dstpixel, 24);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+                break;
+            }
+            dstpixel = VEC_OR(VEC_OR(VEC_OR(VEC_SHL(dstA, 24), VEC_SHL(dstR, 16)), VEC_SHL(dstG, 8)), dstB);
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#undef VEC_T
+#undef VEC_WIDTH
+#undef VEC_LOAD
+#undef VEC_STORE
+#undef VEC_SET1
+#undef VEC_SHR
+#undef VEC_SHL
+#undef VEC_AND255
+#undef VEC_OR
+#undef VEC_ADD
+#undef VEC_SUB
+#undef VEC_MUL
+#undef VEC_MIN255
+#undef VEC_DIV255
+
+#endif /* SDL_SSE2_INTRINSICS */
+
 SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_XRGB8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_XRGB8888_XRGB8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_XRGB8888_XRGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_XRGB8888_XRGB8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XRGB8888_XRGB8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_XRGB8888_XRGB8888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_XRGB8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_XRGB8888_XRGB8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_XRGB8888_XRGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_XRGB8888_XRGB8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XRGB8888_XRGB8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_XRGB8888_XRGB8888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_XRGB8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_XRGB8888_XRGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_XRGB8888_XRGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_XRGB8888_XRGB8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XRGB8888_XRGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_XRGB8888_XRGB8888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_XRGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_XBGR8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_XRGB8888_XBGR8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_XRGB8888_XBGR8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_XRGB8888_XBGR8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XRGB8888_XBGR8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_XRGB8888_XBGR8888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_XBGR8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_XRGB8888_XBGR8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_XRGB8888_XBGR8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_XRGB8888_XBGR8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XRGB8888_XBGR8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_XRGB8888_XBGR8888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_XBGR8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_XRGB8888_XBGR8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_XRGB8888_XBGR8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_XRGB8888_XBGR8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XRGB8888_XBGR8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_XRGB8888_XBGR8888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_XBGR8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_ARGB8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_XRGB8888_ARGB8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_XRGB8888_ARGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_XRGB8888_ARGB8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XRGB8888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_XRGB8888_ARGB8888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_ARGB8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_XRGB8888_ARGB8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_XRGB8888_ARGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_XRGB8888_ARGB8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XRGB8888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_XRGB8888_ARGB8888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_ARGB8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_XRGB8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_XRGB8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_XRGB8888_ARGB8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XRGB8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_XRGB8888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XBGR8888_XRGB8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_XBGR8888_XRGB8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_XBGR8888_XRGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_XBGR8888_XRGB8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XBGR8888_XRGB8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_XBGR8888_XRGB8888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XBGR8888_XRGB8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_XBGR8888_XRGB8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_XBGR8888_XRGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_XBGR8888_XRGB8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XBGR8888_XRGB8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_XBGR8888_XRGB8888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XBGR8888_XRGB8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_XBGR8888_XRGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_XBGR8888_XRGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_XBGR8888_XRGB8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XBGR8888_XRGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_XBGR8888_XRGB8888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XBGR8888_XRGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XBGR8888_XBGR8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_XBGR8888_XBGR8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_XBGR8888_XBGR8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_XBGR8888_XBGR8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XBGR8888_XBGR8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_XBGR8888_XBGR8888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XBGR8888_XBGR8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_XBGR8888_XBGR8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_XBGR8888_XBGR8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_XBGR8888_XBGR8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XBGR8888_XBGR8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_XBGR8888_XBGR8888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XBGR8888_XBGR8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_XBGR8888_XBGR8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_XBGR8888_XBGR8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_XBGR8888_XBGR8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XBGR8888_XBGR8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_XBGR8888_XBGR8888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XBGR8888_XBGR8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XBGR8888_ARGB8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_XBGR8888_ARGB8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_XBGR8888_ARGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_XBGR8888_ARGB8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XBGR8888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_XBGR8888_ARGB8888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XBGR8888_ARGB8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_XBGR8888_ARGB8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_XBGR8888_ARGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_XBGR8888_ARGB8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XBGR8888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_XBGR8888_ARGB8888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XBGR8888_ARGB8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_XBGR8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_XBGR8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_XBGR8888_ARGB8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XBGR8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_XBGR8888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XBGR8888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_XRGB8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_XRGB8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ARGB8888_XRGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_XRGB8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_XRGB8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_XRGB8888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_XRGB8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_XRGB8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ARGB8888_XRGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_XRGB8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_XRGB8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_XRGB8888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_XRGB8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_XRGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ARGB8888_XRGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_XRGB8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_XRGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_XRGB8888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_XRGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_XBGR8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_XBGR8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ARGB8888_XBGR8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_XBGR8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_XBGR8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_XBGR8888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_XBGR8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_XBGR8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ARGB8888_XBGR8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_XBGR8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_XBGR8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_XBGR8888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_XBGR8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_XBGR8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ARGB8888_XBGR8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_XBGR8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_XBGR8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_XBGR8888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_XBGR8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_XRGB8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_XRGB8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGBA8888_XRGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_XRGB8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_XRGB8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_XRGB8888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_XRGB8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_XRGB8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGBA8888_XRGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_XRGB8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_XRGB8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_XRGB8888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_XRGB8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_XRGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGBA8888_XRGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_XRGB8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_XRGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_XRGB8888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_XRGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_XBGR8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_XBGR8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGBA8888_XBGR8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_XBGR8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_XBGR8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_XBGR8888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_XBGR8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_XBGR8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGBA8888_XBGR8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_XBGR8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_XBGR8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_XBGR8888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_XBGR8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_XBGR8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGBA8888_XBGR8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_XBGR8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_XBGR8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_XBGR8888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_XBGR8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_XRGB8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_XRGB8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ABGR8888_XRGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_XRGB8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_XRGB8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_XRGB8888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_XRGB8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_XRGB8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ABGR8888_XRGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_XRGB8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_XRGB8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_XRGB8888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_XRGB8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_XRGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ABGR8888_XRGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_XRGB8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_XRGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_XRGB8888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_XRGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_XBGR8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_XBGR8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ABGR8888_XBGR8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_XBGR8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_XBGR8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_XBGR8888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_XBGR8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_XBGR8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ABGR8888_XBGR8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_XBGR8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_XBGR8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_XBGR8888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_XBGR8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_XBGR8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ABGR8888_XBGR8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_XBGR8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_XBGR8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_XBGR8888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_XBGR8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_XRGB8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_XRGB8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGRA8888_XRGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_XRGB8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_XRGB8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_XRGB8888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_XRGB8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_XRGB8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGRA8888_XRGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_XRGB8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_XRGB8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_XRGB8888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_XRGB8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_XRGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGRA8888_XRGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_XRGB8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_XRGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_XRGB8888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_XRGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_XBGR8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_XBGR8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGRA8888_XBGR8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_XBGR8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_XBGR8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_XBGR8888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_XBGR8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_XBGR8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGRA8888_XBGR8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_XBGR8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_XBGR8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_XBGR8888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_XBGR8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_XBGR8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGRA8888_XBGR8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_XBGR8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_XBGR8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_XBGR8888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_XBGR8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_SSE2 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale },
     { 0, 0, 0, 0, NULL }
 };
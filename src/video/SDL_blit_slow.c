@@ -74,9 +74,9 @@ void SDL_Blit_Slow(SDL_BlitInfo *info)
     src_access = GetPixelAccessMethod(src_fmt);
     dst_access = GetPixelAccessMethod(dst_fmt);
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2; /* start at the middle of pixel */
+    posy = incy / 2 + incy * info->scale_y; /* start at the middle of pixel */
 
     while (info->dst_h--) {
         Uint8 *src = 0;
@@ -824,9 +824,9 @@ void SDL_Blit_Slow_Float(SDL_BlitInfo *info)
     src_access = GetPixelAccessMethod(src_fmt);
     dst_access = GetPixelAccessMethod(dst_fmt);
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2; /* start at the middle of pixel */
+    posy = incy / 2 + incy * info->scale_y; /* start at the middle of pixel */
 
     while (info->dst_h--) {
         Uint8 *src = 0;
@@ -156,7 +156,8 @@ int SDL_SoftStretch(SDL_Surface *src, const SDL_Rect *srcrect,
     left_pad_w_init = left_pad_w;                                                     \
     right_pad_w_init = right_pad_w;                                                   \
     dst_gap = dst_pitch - 4 * dst_w;                                                  \
-    middle_init = dst_w - left_pad_w - right_pad_w;
+    middle_init = dst_w - left_pad_w - right_pad_w;                                   \
+    fp_sum_h += (Sint64)fp_step_h * first_row;
 
 #define BILINEAR___HEIGHT                                              \
     int index_h, frac_h0, frac_h1, middle;                             \
@@ -284,11 +285,11 @@ static SDL_INLINE void INTERPOL_BILINEAR(const Uint32 *s0, const Uint32 *s1, int
 }
 
 static int scale_mat(const Uint32 *src, int src_w, int src_h, int src_pitch,
-                     Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+                     Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int first_row, int num_rows)
 {
     BILINEAR___START
 
-    for (i = 0; i < dst_h; i++) {
+    for (i = first_row; i < first_row + num_rows; i++) {
 
         BILINEAR___HEIGHT
 
@@ -404,11 +405,11 @@ static SDL_INLINE void SDL_TARGETING("sse2") INTERPOL_BILINEAR_SSE(const Uint32
     *dst = _mm_cvtsi128_si32(e0);
 }
 
-static int SDL_TARGETING("sse2") scale_mat_SSE(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static int SDL_TARGETING("sse2") scale_mat_SSE(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int first_row, int num_rows)
 {
     BILINEAR___START
 
-    for (i = 0; i < dst_h; i++) {
+    for (i = first_row; i < first_row + num_rows; i++) {
         int nb_block2;
         __m128i v_frac_h0;
         __m128i v_frac_h1;
@@ -524,6 +525,136 @@ static int SDL_TARGETING("sse2") scale_mat_SSE(const Uint32 *src, int src_w, int
 }
 #endif
 
+#if defined(SDL_SSE2_INTRINSICS) && defined(SDL_AVX2_INTRINSICS)
+
+static SDL_INLINE int hasAVX2(void)
+{
+    static int val = -1;
+    if (val != -1) {
+        return val;
+    }
+    val = SDL_HasAVX2();
+    return val;
+}
+
+/* Load the two neighbour pixels of 4 consecutive destination pixels, as [p0 p1 | p2 p3] */
+static SDL_INLINE __m256i SDL_TARGETING("avx2") LOAD_4_PAIRS_AVX2(const Uint32 *s, int index_w_0, int index_w_1, int index_w_2, int index_w_3)
+{
+    const Uint8 *row = (const Uint8 *)s;
+    __m128i x_01 = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)(row + index_w_0)), _mm_loadl_epi64((const __m128i *)(row + index_w_1)));
+    __m128i x_23 = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)(row + index_w_2)), _mm_loadl_epi64((const __m128i *)(row + index_w_3)));
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(x_01), x_23, 1);
+}
+
+/* Same arithmetic as INTERPOL_BILINEAR_SSE, so both give the same result */
+static int SDL_TARGETING("avx2") scale_mat_AVX2(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int first_row, int num_rows)
+{
+    BILINEAR___START
+
+    for (i = first_row; i < first_row + num_rows; i++) {
+        int nb_block4;
+        __m128i v_frac_h0, v_frac_h1, zero;
+        __m256i v256_frac_h0, v256_frac_h1, zero256;
+
+        BILINEAR___HEIGHT
+
+        nb_block4 = middle / 4;
+
+        v_frac_h0 = _mm_set1_epi16((short)frac_h0);
+        v_frac_h1 = _mm_set1_epi16((short)frac_h1);
+        zero = _mm_setzero_si128();
+        v256_frac_h0 = _mm256_set1_epi16((short)frac_h0);
+        v256_frac_h1 = _mm256_set1_epi16((short)frac_h1);
+        zero256 = _mm256_setzero_si256();
+
+        while (left_pad_w--) {
+            INTERPOL_BILINEAR_SSE(src_h0, src_h1, FRAC_ZERO, v_frac_h0, v_frac_h1, dst, zero);
+            dst += 1;
+        }
+
+        while (nb_block4--) {
+            int index_w_0, frac_w_0;
+            int index_w_1, frac_w_1;
+            int index_w_2, frac_w_2;
+            int index_w_3, frac_w_3;
+
+            __m256i x_0, x_1; /* Pixels in 4*uint8, two per destination pixel */
+            __m256i k_02, k_13, v_frac_w02, v_frac_w13;
+            __m128i e;
+
+            index_w_0 = 4 * SRC_INDEX(fp_sum_w);
+            frac_w_0 = FRAC(fp_sum_w);
+            fp_sum_w += fp_step_w;
+            index_w_1 = 4 * SRC_INDEX(fp_sum_w);
+            frac_w_1 = FRAC(fp_sum_w);
+            fp_sum_w += fp_step_w;
+            index_w_2 = 4 * SRC_INDEX(fp_sum_w);
+            frac_w_2 = FRAC(fp_sum_w);
+            fp_sum_w += fp_step_w;
+            index_w_3 = 4 * SRC_INDEX(fp_sum_w);
+            frac_w_3 = FRAC(fp_sum_w);
+            fp_sum_w += fp_step_w;
+
+            /* Lanes hold pixels 0 and 2 in the low halves, 1 and 3 in the high halves */
+            v_frac_w02 = _mm256_setr_epi16(
+                (short)(FRAC_ONE - frac_w_0), (short)frac_w_0, (short)(FRAC_ONE - frac_w_0), (short)frac_w_0,
+                (short)(FRAC_ONE - frac_w_0), (short)frac_w_0, (short)(FRAC_ONE - frac_w_0), (short)frac_w_0,
+                (short)(FRAC_ONE - frac_w_2), (short)frac_w_2, (short)(FRAC_ONE - frac_w_2), (short)frac_w_2,
+                (short)(FRAC_ONE - frac_w_2), (short)frac_w_2, (short)(FRAC_ONE - frac_w_2), (short)frac_w_2);
+            v_frac_w13 = _mm256_setr_epi16(
+                (short)(FRAC_ONE - frac_w_1), (short)frac_w_1, (short)(FRAC_ONE - frac_w_1), (short)frac_w_1,
+                (short)(FRAC_ONE - frac_w_1), (short)frac_w_1, (short)(FRAC_ONE - frac_w_1), (short)frac_w_1,
+                (short)(FRAC_ONE - frac_w_3), (short)frac_w_3, (short)(FRAC_ONE - frac_w_3), (short)frac_w_3,
+                (short)(FRAC_ONE - frac_w_3), (short)frac_w_3, (short)(FRAC_ONE - frac_w_3), (short)frac_w_3);
+
+            x_0 = LOAD_4_PAIRS_AVX2(src_h0, index_w_0, index_w_1, index_w_2, index_w_3);
+            x_1 = LOAD_4_PAIRS_AVX2(src_h1, index_w_0, index_w_1, index_w_2, index_w_3);
+
+            /* Interpolation vertical */
+            k_02 = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(x_0, zero256), v256_frac_h1),
+                                    _mm256_mullo_epi16(_mm256_unpacklo_epi8(x_1, zero256), v256_frac_h0));
+            k_13 = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(x_0, zero256), v256_frac_h1),
+                                    _mm256_mullo_epi16(_mm256_unpackhi_epi8(x_1, zero256), v256_frac_h0));
+
+            /* Interpolation horizontal, interleave j0 and j1 of each pixel */
+            k_02 = _mm256_madd_epi16(_mm256_unpacklo_epi16(k_02, _mm256_srli_si256(k_02, 8)), v_frac_w02);
+            k_13 = _mm256_madd_epi16(_mm256_unpacklo_epi16(k_13, _mm256_srli_si256(k_13, 8)), v_frac_w13);
+
+            /* Store 4 pixels */
+            k_02 = _mm256_packs_epi32(_mm256_srli_epi32(k_02, PRECISION * 2), _mm256_srli_epi32(k_13, PRECISION * 2));
+            k_02 = _mm256_packus_epi16(k_02, k_02);
+            e = _mm_unpacklo_epi64(_mm256_castsi256_si128(k_02), _mm256_extracti128_si256(k_02, 1));
+            _mm_storeu_si128((__m128i *)dst, e);
+            dst += 4;
+        }
+
+        /* Last points */
+        middle &= 0x3;
+        while (middle--) {
+            const Uint32 *s_00_01;
+            const Uint32 *s_10_11;
+            int index_w = 4 * SRC_INDEX(fp_sum_w);
+            int frac_w = FRAC(fp_sum_w);
+            fp_sum_w += fp_step_w;
+            s_00_01 = (const Uint32 *)((const Uint8 *)src_h0 + index_w);
+            s_10_11 = (const Uint32 *)((const Uint8 *)src_h1 + index_w);
+            INTERPOL_BILINEAR_SSE(s_00_01, s_10_11, frac_w, v_frac_h0, v_frac_h1, dst, zero);
+            dst += 1;
+        }
+
+        while (right_pad_w--) {
+            int index_w = 4 * (src_w - 2);
+            const Uint32 *s_00_01 = (const Uint32 *)((const Uint8 *)src_h0 + index_w);
+            const Uint32 *s_10_11 = (const Uint32 *)((const Uint8 *)src_h1 + index_w);
+            INTERPOL_BILINEAR_SSE(s_00_01, s_10_11, FRAC_ONE, v_frac_h0, v_frac_h1, dst, zero);
+            dst += 1;
+        }
+        dst = (Uint32 *)((Uint8 *)dst + dst_gap);
+    }
+    return 0;
+}
+#endif
+
 #ifdef SDL_NEON_INTRINSICS
 
 static SDL_INLINE int hasNEON(void)
@@ -568,11 +699,11 @@ static SDL_INLINE void INTERPOL_BILINEAR_NEON(const Uint32 *s0, const Uint32 *s1
     *dst = vget_lane_u32(CAST_uint32x2_t e0, 0);
 }
 
-static int scale_mat_NEON(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static int scale_mat_NEON(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int first_row, int num_rows)
 {
     BILINEAR___START
 
-    for (i = 0; i < dst_h; i++) {
+    for (i = first_row; i < first_row + num_rows; i++) {
         int nb_block4;
         uint8x8_t v_frac_h0, v_frac_h1;
 
@@ -786,38 +917,76 @@ static int scale_mat_NEON(const Uint32 *src, int src_w, int src_h, int src_pitch
 }
 #endif
 
-int SDL_LowerSoftStretchLinear(SDL_Surface *s, const SDL_Rect *srcrect,
-                               SDL_Surface *d, const SDL_Rect *dstrect)
+static int scale_mat_rows(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int first_row, int num_rows)
 {
     int ret = -1;
-    int src_w = srcrect->w;
-    int src_h = srcrect->h;
-    int dst_w = dstrect->w;
-    int dst_h = dstrect->h;
-    int src_pitch = s->pitch;
-    int dst_pitch = d->pitch;
-    Uint32 *src = (Uint32 *)((Uint8 *)s->pixels + srcrect->x * 4 + srcrect->y * src_pitch);
-    Uint32 *dst = (Uint32 *)((Uint8 *)d->pixels + dstrect->x * 4 + dstrect->y * dst_pitch);
 
 #ifdef SDL_NEON_INTRINSICS
     if (ret == -1 && hasNEON()) {
-        ret = scale_mat_NEON(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        ret = scale_mat_NEON(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch, first_row, num_rows);
+    }
+#endif
+
+#if defined(SDL_SSE2_INTRINSICS) && defined(SDL_AVX2_INTRINSICS)
+    if (ret == -1 && hasAVX2()) {
+        ret = scale_mat_AVX2(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch, first_row, num_rows);
     }
 #endif
 
 #ifdef SDL_SSE2_INTRINSICS
     if (ret == -1 && hasSSE2()) {
-        ret = scale_mat_SSE(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        ret = scale_mat_SSE(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch, first_row, num_rows);
     }
 #endif
 
     if (ret == -1) {
-        ret = scale_mat(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        ret = scale_mat(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch, first_row, num_rows);
     }
 
     return ret;
 }
 
+/* Stretches a band of info->dst_h rows, starting at row info->scale_y of the scaled area */
+static void SDL_StretchLinearBand(SDL_BlitInfo *info)
+{
+    scale_mat_rows((const Uint32 *)info->src, info->src_w, info->src_h, info->src_pitch,
+                   (Uint32 *)info->dst, info->dst_w, info->scale_h, info->dst_pitch,
+                   info->scale_y, info->dst_h);
+}
+
+/* Large stretches are split into bands of destination rows by SDL_RunBlitBands() */
+static void SDL_SetupStretchInfo(SDL_BlitInfo *info, SDL_Surface *s, const SDL_Rect *srcrect,
+                                 SDL_Surface *d, const SDL_Rect *dstrect)
+{
+    const int bpp = d->format->bytes_per_pixel;
+
+    SDL_zerop(info);
+    info->src = (Uint8 *)s->pixels + srcrect->x * bpp + srcrect->y * s->pitch;
+    info->src_w = srcrect->w;
+    info->src_h = srcrect->h;
+    info->src_pitch = s->pitch;
+    info->dst = (Uint8 *)d->pixels + dstrect->x * bpp + dstrect->y * d->pitch;
+    info->dst_w = dstrect->w;
+    info->dst_h = dstrect->h;
+    info->dst_pitch = d->pitch;
+    info->scale_y = 0;
+    info->scale_h = dstrect->h;
+    info->src_fmt = s->format;
+    info->dst_fmt = d->format;
+}
+
+int SDL_LowerSoftStretchLinear(SDL_Surface *s, const SDL_Rect *srcrect,
+                               SDL_Surface *d, const SDL_Rect *dstrect)
+{
+    SDL_BlitInfo info;
+
+    SDL_SetupStretchInfo(&info, s, srcrect, d, dstrect);
+    if (!SDL_RunBlitBands(SDL_StretchLinearBand, &info, SDL_TRUE)) {
+        SDL_StretchLinearBand(&info);
+    }
+    return 0;
+}
+
 #define SDL_SCALE_NEAREST__START          \
     int i;                                \
     Uint64 posy, incy;                    \
@@ -828,7 +997,7 @@ int SDL_LowerSoftStretchLinear(SDL_Surface *s, const SDL_Rect *srcrect,
     incy = ((Uint64)src_h << 16) / dst_h; \
     incx = ((Uint64)src_w << 16) / dst_w; \
     dst_gap = dst_pitch - bpp * dst_w;    \
-    posy = incy / 2;
+    posy = incy / 2 + incy * first_row;
 
 #define SDL_SCALE_NEAREST__HEIGHT                                         \
     srcy = (posy >> 16);                                                  \
@@ -838,11 +1007,11 @@ int SDL_LowerSoftStretchLinear(SDL_Surface *s, const SDL_Rect *srcrect,
     n = dst_w;
 
 static int scale_mat_nearest_1(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch,
-                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int first_row, int num_rows)
 {
     Uint32 bpp = 1;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = 0; i < num_rows; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint8 *src;
@@ -858,11 +1027,11 @@ static int scale_mat_nearest_1(const Uint32 *src_ptr, int src_w, int src_h, int
 }
 
 static int scale_mat_nearest_2(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch,
-                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int first_row, int num_rows)
 {
     Uint32 bpp = 2;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = 0; i < num_rows; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint16 *src;
@@ -878,11 +1047,11 @@ static int scale_mat_nearest_2(const Uint32 *src_ptr, int src_w, int src_h, int
 }
 
 static int scale_mat_nearest_3(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch,
-                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int first_row, int num_rows)
 {
     Uint32 bpp = 3;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = 0; i < num_rows; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint8 *src;
@@ -900,11 +1069,11 @@ static int scale_mat_nearest_3(const Uint32 *src_ptr, int src_w, int src_h, int
 }
 
 static int scale_mat_nearest_4(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch,
-                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int first_row, int num_rows)
 {
     Uint32 bpp = 4;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = 0; i < num_rows; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint32 *src;
@@ -919,28 +1088,75 @@ static int scale_mat_nearest_4(const Uint32 *src_ptr, int src_w, int src_h, int
     return 0;
 }
 
-int SDL_LowerSoftStretchNearest(SDL_Surface *s, const SDL_Rect *srcrect,
-                                SDL_Surface *d, const SDL_Rect *dstrect)
+#if defined(SDL_SSE2_INTRINSICS) && defined(SDL_AVX2_INTRINSICS)
+static int SDL_TARGETING("avx2") scale_mat_nearest_4_AVX2(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch,
+                                                          Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int first_row, int num_rows)
 {
-    int src_w = srcrect->w;
-    int src_h = srcrect->h;
-    int dst_w = dstrect->w;
-    int dst_h = dstrect->h;
-    int src_pitch = s->pitch;
-    int dst_pitch = d->pitch;
+    Uint32 bpp = 4;
+    SDL_SCALE_NEAREST__START
+    for (i = 0; i < num_rows; i++) {
+        __m256i v_posx, v_incx;
+        SDL_SCALE_NEAREST__HEIGHT
 
-    const int bpp = d->format->bytes_per_pixel;
+        /* The positions stay below src_w << 16, so they fit in 32 bits */
+        v_posx = _mm256_setr_epi32((int)(Uint32)posx, (int)(Uint32)(posx + incx), (int)(Uint32)(posx + 2 * incx), (int)(Uint32)(posx + 3 * incx),
+                                   (int)(Uint32)(posx + 4 * incx), (int)(Uint32)(posx + 5 * incx), (int)(Uint32)(posx + 6 * incx), (int)(Uint32)(posx + 7 * incx));
+        v_incx = _mm256_set1_epi32((int)(Uint32)(8 * incx));
+        while (n >= 8) {
+            __m256i v_srcx = _mm256_srli_epi32(v_posx, 16);
+            _mm256_storeu_si256((__m256i *)dst, _mm256_i32gather_epi32((const int *)src_h0, v_srcx, 4));
+            v_posx = _mm256_add_epi32(v_posx, v_incx);
+            dst += 8;
+            n -= 8;
+        }
+        posx += incx * (dst_w - n);
 
-    Uint32 *src = (Uint32 *)((Uint8 *)s->pixels + srcrect->x * bpp + srcrect->y * src_pitch);
-    Uint32 *dst = (Uint32 *)((Uint8 *)d->pixels + dstrect->x * bpp + dstrect->y * dst_pitch);
+        while (n--) {
+            const Uint32 *src;
+            srcx = bpp * (posx >> 16);
+            posx += incx;
+            src = (const Uint32 *)((const Uint8 *)src_h0 + srcx);
+            *dst = *src;
+            dst = (Uint32 *)((Uint8 *)dst + bpp);
+        }
+        dst = (Uint32 *)((Uint8 *)dst + dst_gap);
+    }
+    return 0;
+}
+#endif
+
+/* Stretches a band of info->dst_h rows, starting at row info->scale_y of the scaled area */
+static void SDL_StretchNearestBand(SDL_BlitInfo *info)
+{
+    const int bpp = info->dst_fmt->bytes_per_pixel;
+    const Uint32 *src = (const Uint32 *)info->src;
+    Uint32 *dst = (Uint32 *)info->dst;
 
     if (bpp == 4) {
-        return scale_mat_nearest_4(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+#if defined(SDL_SSE2_INTRINSICS) && defined(SDL_AVX2_INTRINSICS)
+        if (hasAVX2()) {
+            scale_mat_nearest_4_AVX2(src, info->src_w, info->src_h, info->src_pitch, dst, info->dst_w, info->scale_h, info->dst_pitch, info->scale_y, info->dst_h);
+            return;
+        }
+#endif
+        scale_mat_nearest_4(src, info->src_w, info->src_h, info->src_pitch, dst, info->dst_w, info->scale_h, info->dst_pitch, info->scale_y, info->dst_h);
     } else if (bpp == 3) {
-        return scale_mat_nearest_3(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        scale_mat_nearest_3(src, info->src_w, info->src_h, info->src_pitch, dst, info->dst_w, info->scale_h, info->dst_pitch, info->scale_y, info->dst_h);
     } else if (bpp == 2) {
-        return scale_mat_nearest_2(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        scale_mat_nearest_2(src, info->src_w, info->src_h, info->src_pitch, dst, info->dst_w, info->scale_h, info->dst_pitch, info->scale_y, info->dst_h);
     } else {
-        return scale_mat_nearest_1(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        scale_mat_nearest_1(src, info->src_w, info->src_h, info->src_pitch, dst, info->dst_w, info->scale_h, info->dst_pitch, info->scale_y, info->dst_h);
     }
 }
+
+int SDL_LowerSoftStretchNearest(SDL_Surface *s, const SDL_Rect *srcrect,
+                                SDL_Surface *d, const SDL_Rect *dstrect)
+{
+    SDL_BlitInfo info;
+
+    SDL_SetupStretchInfo(&info, s, srcrect, d, dstrect);
+    if (!SDL_RunBlitBands(SDL_StretchNearestBand, &info, SDL_TRUE)) {
+        SDL_StretchNearestBand(&info);
+    }
+    return 0;
+}
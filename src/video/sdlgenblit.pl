@@ -85,6 +85,93 @@ my %set_rgba_string = (
     "BGRA8888" => "_pixel = (_B << 24) | (_G << 16) | (_R << 8) | _A;",
 );
 
+my %format_shift = (
+    "XRGB8888" => { "R" => 16, "G" => 8, "B" => 0 },
+    "XBGR8888" => { "B" => 16, "G" => 8, "R" => 0 },
+    "ARGB8888" => { "A" => 24, "R" => 16, "G" => 8, "B" => 0 },
+    "RGBA8888" => { "R" => 24, "G" => 16, "B" => 8, "A" => 0 },
+    "ABGR8888" => { "A" => 24, "B" => 16, "G" => 8, "R" => 0 },
+    "BGRA8888" => { "B" => 24, "G" => 16, "R" => 8, "A" => 0 },
+);
+
+# The SIMD blitters keep each channel of a pixel in its own 32-bit lane,
+# so one generated body serves every instruction set below.
+# NEON is described below too, but is left out of the build and the blit
+# table until its output has been checked against the scalar blitters on
+# ARM hardware.
+my @simd_isas = (
+    "AVX2",
+    "SSE2",
+);
+
+my %simd_define = (
+    "AVX2" => "SDL_AVX2_INTRINSICS",
+    "SSE2" => "SDL_SSE2_INTRINSICS",
+    "NEON" => "SDL_NEON_INTRINSICS",
+);
+
+my %simd_target = (
+    "AVX2" => " SDL_TARGETING(\"avx2\")",
+    "SSE2" => " SDL_TARGETING(\"sse2\")",
+    "NEON" => "",
+);
+
+my %simd_cpu = (
+    "AVX2" => "SDL_CPU_AVX2",
+    "SSE2" => "SDL_CPU_SSE2",
+    "NEON" => "SDL_CPU_NEON",
+);
+
+# Channels never exceed 510, so the 16-bit multiply and minimum of SSE2 and
+# AVX2 give the same results as 32-bit ones.
+my %simd_macros = (
+    "AVX2" => <<'__EOF__',
+#define VEC_T           __m256i
+#define VEC_WIDTH       8
+#define VEC_LOAD(p)     _mm256_loadu_si256((const __m256i *)(p))
+#define VEC_STORE(p, v) _mm256_storeu_si256((__m256i *)(p), v)
+#define VEC_SET1(x)     _mm256_set1_epi32((int)(x))
+#define VEC_SHR(v, n)   _mm256_srli_epi32(v, n)
+#define VEC_SHL(v, n)   _mm256_slli_epi32(v, n)
+#define VEC_AND255(v)   _mm256_and_si256(v, _mm256_set1_epi32(0xFF))
+#define VEC_OR(a, b)    _mm256_or_si256(a, b)
+#define VEC_ADD(a, b)   _mm256_add_epi32(a, b)
+#define VEC_SUB(a, b)   _mm256_sub_epi32(a, b)
+#define VEC_MUL(a, b)   _mm256_mullo_epi16(a, b)
+#define VEC_MIN255(v)   _mm256_min_epi16(v, _mm256_set1_epi32(0xFF))
+__EOF__
+    "SSE2" => <<'__EOF__',
+#define VEC_T           __m128i
+#define VEC_WIDTH       4
+#define VEC_LOAD(p)     _mm_loadu_si128((const __m128i *)(p))
+#define VEC_STORE(p, v) _mm_storeu_si128((__m128i *)(p), v)
+#define VEC_SET1(x)     _mm_set1_epi32((int)(x))
+#define VEC_SHR(v, n)   _mm_srli_epi32(v, n)
+#define VEC_SHL(v, n)   _mm_slli_epi32(v, n)
+#define VEC_AND255(v)   _mm_and_si128(v, _mm_set1_epi32(0xFF))
+#define VEC_OR(a, b)    _mm_or_si128(a, b)
+#define VEC_ADD(a, b)   _mm_add_epi32(a, b)
+#define VEC_SUB(a, b)   _mm_sub_epi32(a, b)
+#define VEC_MUL(a, b)   _mm_mullo_epi16(a, b)
+#define VEC_MIN255(v)   _mm_min_epi16(v, _mm_set1_epi32(0xFF))
+__EOF__
+    "NEON" => <<'__EOF__',
+#define VEC_T           uint32x4_t
+#define VEC_WIDTH       4
+#define VEC_LOAD(p)     vld1q_u32((const uint32_t *)(p))
+#define VEC_STORE(p, v) vst1q_u32((uint32_t *)(p), v)
+#define VEC_SET1(x)     vdupq_n_u32((uint32_t)(x))
+#define VEC_SHR(v, n)   vshrq_n_u32(v, n)
+#define VEC_SHL(v, n)   vshlq_n_u32(v, n)
+#define VEC_AND255(v)   vandq_u32(v, vdupq_n_u32(0xFF))
+#define VEC_OR(a, b)    vorrq_u32(a, b)
+#define VEC_ADD(a, b)   vaddq_u32(a, b)
+#define VEC_SUB(a, b)   vsubq_u32(a, b)
+#define VEC_MUL(a, b)   vmulq_u32(a, b)
+#define VEC_MIN255(v)   vminq_u32(v, vdupq_n_u32(0xFF))
+__EOF__
+);
+
 sub open_file {
     my $name = shift;
     open(FILE, ">$name.new") || die "Can't open $name.new: $!";
@@ -524,9 +611,9 @@ __EOF__
 
     print FILE <<__EOF__;
 
-    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
-    posy = incy / 2;
+    posy = incy / 2 + incy * info->scale_y;
 
     while (info->dst_h--) {
         $format_type{$src} *src = 0;
@@ -575,6 +662,397 @@ __EOF__
 __EOF__
 }
 
+sub simd_get_channel
+{
+    my $pixel = shift;
+    my $shift = shift;
+
+    if ( $shift == 24 ) {
+        return "VEC_SHR($pixel, 24)";
+    } elsif ( $shift == 0 ) {
+        return "VEC_AND255($pixel)";
+    }
+    return "VEC_AND255(VEC_SHR($pixel, $shift))";
+}
+
+sub simd_get_rgba
+{
+    my $prefix = shift;
+    my $format = shift;
+    my $ignore_alpha = shift;
+    my $shifts = $format_shift{$format};
+
+    foreach my $c ("R", "G", "B", "A") {
+        if ( exists $shifts->{$c} && ($c ne "A" || !$ignore_alpha) ) {
+            my $channel = simd_get_channel("${prefix}pixel", $shifts->{$c});
+            print FILE <<__EOF__;
+            ${prefix}${c} = $channel;
+__EOF__
+        }
+    }
+}
+
+sub simd_set_rgba
+{
+    my $prefix = shift;
+    my $format = shift;
+    my $shifts = $format_shift{$format};
+    my $string = "";
+
+    foreach my $c (sort { $shifts->{$b} <=> $shifts->{$a} } keys %$shifts) {
+        my $channel = "${prefix}${c}";
+        if ( $shifts->{$c} != 0 ) {
+            $channel = "VEC_SHL($channel, $shifts->{$c})";
+        }
+        if ( $string eq "" ) {
+            $string = $channel;
+        } else {
+            $string = "VEC_OR($string, $channel)";
+        }
+    }
+    print FILE <<__EOF__;
+            dstpixel = $string;
+__EOF__
+}
+
+sub output_simdcore
+{
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $A_is_const_FF = shift;
+    my $dst_has_alpha = ($dst =~ /A/) ? 1 : 0;
+    my $src_has_alpha = ($src =~ /A/) ? 1 : 0;
+    my $ignore_dst_alpha = !$dst_has_alpha && !$blend;
+
+    simd_get_rgba("src", $src, $ignore_dst_alpha);
+    if ( $blend ) {
+        simd_get_rgba("dst", $dst, !$dst_has_alpha);
+    }
+
+    if ( $modulate ) {
+        print FILE <<__EOF__;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = VEC_DIV255(VEC_MUL(srcR, modulateR));
+                srcG = VEC_DIV255(VEC_MUL(srcG, modulateG));
+                srcB = VEC_DIV255(VEC_MUL(srcB, modulateB));
+            }
+__EOF__
+        if (!$ignore_dst_alpha && $src_has_alpha) {
+            print FILE <<__EOF__;
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = VEC_DIV255(VEC_MUL(srcA, modulateA));
+            }
+__EOF__
+        }
+    }
+    if ( $blend ) {
+        if (!$A_is_const_FF) {
+            print FILE <<__EOF__;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* Opaque pixels come through unchanged, so there's no need to skip them */
+                srcR = VEC_DIV255(VEC_MUL(srcR, srcA));
+                srcG = VEC_DIV255(VEC_MUL(srcG, srcA));
+                srcB = VEC_DIV255(VEC_MUL(srcB, srcA));
+            }
+__EOF__
+        }
+        print FILE <<__EOF__;
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+__EOF__
+        if ($A_is_const_FF) {
+            print FILE <<__EOF__;
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+__EOF__
+            if ( $dst_has_alpha ) {
+                print FILE <<__EOF__;
+                dstA = VEC_SET1(0xFF);
+__EOF__
+            }
+        } else {
+            print FILE <<__EOF__;
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_ADD(srcR, VEC_DIV255(VEC_MUL(srcInv, dstR)));
+                dstG = VEC_ADD(srcG, VEC_DIV255(VEC_MUL(srcInv, dstG)));
+                dstB = VEC_ADD(srcB, VEC_DIV255(VEC_MUL(srcInv, dstB)));
+__EOF__
+            if ( $dst_has_alpha ) {
+                print FILE <<__EOF__;
+                dstA = VEC_ADD(srcA, VEC_DIV255(VEC_MUL(srcInv, dstA)));
+__EOF__
+            }
+        }
+        print FILE <<__EOF__;
+                break;
+            case SDL_COPY_ADD:
+                dstR = VEC_MIN255(VEC_ADD(srcR, dstR));
+                dstG = VEC_MIN255(VEC_ADD(srcG, dstG));
+                dstB = VEC_MIN255(VEC_ADD(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+__EOF__
+        if ($A_is_const_FF) {
+            print FILE <<__EOF__;
+                dstR = VEC_DIV255(VEC_MUL(srcR, dstR));
+                dstG = VEC_DIV255(VEC_MUL(srcG, dstG));
+                dstB = VEC_DIV255(VEC_MUL(srcB, dstB));
+__EOF__
+        } else {
+            print FILE <<__EOF__;
+                srcInv = VEC_SUB(VEC_SET1(0xFF), srcA);
+                dstR = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcR, dstR), VEC_MUL(dstR, srcInv))));
+                dstG = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcG, dstG), VEC_MUL(dstG, srcInv))));
+                dstB = VEC_MIN255(VEC_DIV255(VEC_ADD(VEC_MUL(srcB, dstB), VEC_MUL(dstB, srcInv))));
+__EOF__
+        }
+        print FILE <<__EOF__;
+                break;
+            }
+__EOF__
+        simd_set_rgba("dst", $dst);
+    } else {
+        simd_set_rgba("src", $dst);
+    }
+}
+
+sub output_simdfunc
+{
+    my $isa = shift;
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $scale = shift;
+
+    my $dst_has_alpha = ($dst =~ /A/) ? 1 : 0;
+    my $src_has_alpha = ($src =~ /A/) ? 1 : 0;
+    my $ignore_dst_alpha = !$dst_has_alpha && !$blend;
+    my $A_is_const_FF = (!$ignore_dst_alpha && !$src_has_alpha && !$modulate) ? 1 : 0;
+
+    output_copyfuncname("static void$simd_target{$isa}", $src, $dst, $modulate, $blend, $scale, 0, "_$isa(SDL_BlitInfo *info)\n");
+    print FILE <<__EOF__;
+{
+    const int flags = info->flags;
+__EOF__
+    if ( $modulate ) {
+        print FILE <<__EOF__;
+    const VEC_T modulateR = VEC_SET1(info->r);
+    const VEC_T modulateG = VEC_SET1(info->g);
+    const VEC_T modulateB = VEC_SET1(info->b);
+__EOF__
+        if (!$ignore_dst_alpha && $src_has_alpha) {
+            print FILE <<__EOF__;
+    const VEC_T modulateA = VEC_SET1(info->a);
+__EOF__
+        }
+    }
+    if (!$ignore_dst_alpha && !$src_has_alpha) {
+        if ( $modulate ) {
+            print FILE <<__EOF__;
+    const VEC_T srcA = VEC_SET1((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+__EOF__
+        } elsif ( !$blend ) {
+            print FILE <<__EOF__;
+    const VEC_T srcA = VEC_SET1(0xFF);
+__EOF__
+        }
+        print FILE <<__EOF__;
+    VEC_T srcpixel, srcR, srcG, srcB;
+__EOF__
+    } elsif (!$ignore_dst_alpha) {
+        print FILE <<__EOF__;
+    VEC_T srcpixel, srcR, srcG, srcB, srcA;
+__EOF__
+    } else {
+        print FILE <<__EOF__;
+    VEC_T srcpixel, srcR, srcG, srcB;
+__EOF__
+    }
+    if ( $blend ) {
+        if ( $dst_has_alpha ) {
+            print FILE <<__EOF__;
+    VEC_T dstpixel, dstR, dstG, dstB, dstA;
+__EOF__
+        } else {
+            print FILE <<__EOF__;
+    VEC_T dstpixel, dstR, dstG, dstB;
+__EOF__
+        }
+        if (!$A_is_const_FF) {
+            print FILE <<__EOF__;
+    VEC_T srcInv;
+__EOF__
+        }
+    } else {
+        print FILE <<__EOF__;
+    VEC_T dstpixel;
+__EOF__
+    }
+    print FILE <<__EOF__;
+    Uint32 srcbuf[VEC_WIDTH];
+    Uint32 dstbuf[VEC_WIDTH];
+__EOF__
+    if ( $scale ) {
+        print FILE <<__EOF__;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+    int i;
+
+    incy = ((Uint64)info->src_h << 16) / info->scale_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2 + incy * info->scale_y;
+    SDL_zeroa(srcbuf);
+
+    while (info->dst_h--) {
+        const Uint8 *srcrow = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            for (i = 0; i < count; ++i) {
+                srcbuf[i] = *(const Uint32 *)(srcrow + ((posx >> 16) * $format_size{$src}));
+                posx += incx;
+            }
+            srcpixel = VEC_LOAD(srcbuf);
+__EOF__
+        if ( $blend ) {
+            print FILE <<__EOF__;
+            if (count == VEC_WIDTH) {
+                dstpixel = VEC_LOAD(dst);
+            } else {
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+            }
+__EOF__
+        }
+    } else {
+        print FILE <<__EOF__;
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            const int count = SDL_min(n, VEC_WIDTH);
+            if (count == VEC_WIDTH) {
+                srcpixel = VEC_LOAD(src);
+__EOF__
+        if ( $blend ) {
+            print FILE <<__EOF__;
+                dstpixel = VEC_LOAD(dst);
+__EOF__
+        }
+        print FILE <<__EOF__;
+            } else {
+                SDL_zeroa(srcbuf);
+                SDL_memcpy(srcbuf, src, count * sizeof(Uint32));
+                srcpixel = VEC_LOAD(srcbuf);
+__EOF__
+        if ( $blend ) {
+            print FILE <<__EOF__;
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                dstpixel = VEC_LOAD(dstbuf);
+__EOF__
+        }
+        print FILE <<__EOF__;
+            }
+__EOF__
+    }
+    output_simdcore($src, $dst, $modulate, $blend, $A_is_const_FF);
+    print FILE <<__EOF__;
+            if (count == VEC_WIDTH) {
+                VEC_STORE(dst, dstpixel);
+            } else {
+                VEC_STORE(dstbuf, dstpixel);
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+__EOF__
+    if ( $scale ) {
+        print FILE <<__EOF__;
+            dst += count;
+            n -= count;
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+__EOF__
+    } else {
+        print FILE <<__EOF__;
+            src += count;
+            dst += count;
+            n -= count;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+__EOF__
+    }
+}
+
+sub output_simdfuncs
+{
+    my $isa = shift;
+
+    print FILE <<__EOF__;
+#ifdef $simd_define{$isa}
+
+$simd_macros{$isa}
+/* Exact up to 65534, the multiply blend clamps anything larger to 255 */
+#define VEC_DIV255(v)   VEC_SHR(VEC_ADD(VEC_ADD(v, VEC_SET1(1)), VEC_SHR(v, 8)), 8)
+
+__EOF__
+    for (my $i = 0; $i <= $#src_formats; ++$i) {
+        for (my $j = 0; $j <= $#dst_formats; ++$j) {
+            for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+                for (my $blend = 0; $blend <= 1; ++$blend) {
+                    for (my $scale = 0; $scale <= 1; ++$scale) {
+                        if ( $modulate || $blend ) {
+                            output_simdfunc($isa, $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale);
+                        }
+                    }
+                }
+            }
+        }
+    }
+    print FILE <<__EOF__;
+#undef VEC_T
+#undef VEC_WIDTH
+#undef VEC_LOAD
+#undef VEC_STORE
+#undef VEC_SET1
+#undef VEC_SHR
+#undef VEC_SHL
+#undef VEC_AND255
+#undef VEC_OR
+#undef VEC_ADD
+#undef VEC_SUB
+#undef VEC_MUL
+#undef VEC_MIN255
+#undef VEC_DIV255
+
+#endif /* $simd_define{$isa} */
+
+__EOF__
+}
+
 sub output_copyfunc_h
 {
 }
@@ -601,7 +1079,6 @@ __EOF__
                 for (my $blend = 0; $blend <= 1; ++$blend) {
                     for (my $scale = 0; $scale <= 1; ++$scale) {
                         if ( $modulate || $blend || $scale ) {
-                            print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
                             my $flags = "";
                             my $flag = "";
                             if ( $modulate ) {
@@ -631,7 +1108,15 @@ __EOF__
                             if ( $flags eq "" ) {
                                 $flags = "0";
                             }
-                            print FILE "($flags), SDL_CPU_ANY,";
+                            if ( $modulate || $blend ) {
+                                foreach my $isa (@simd_isas) {
+                                    print FILE "#ifdef $simd_define{$isa}\n";
+                                    print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ($flags), $simd_cpu{$isa},";
+                                    output_copyfuncname("", $src, $dst, $modulate, $blend, $scale, 0, "_$isa },\n");
+                                    print FILE "#endif\n";
+                                }
+                            }
+                            print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ($flags), SDL_CPU_ANY,";
                             output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n");
                         }
                     }
@@ -679,5 +1164,8 @@ for (my $i = 0; $i <= $#src_formats; ++$i) {
         output_copyfunc_c($src_formats[$i], $dst_formats[$j]);
     }
 }
+foreach my $isa (@simd_isas) {
+    output_simdfuncs($isa);
+}
 output_copyfunctable();
 close_file("SDL_blit_auto.c");
@@ -1265,6 +1265,2304 @@ cleanup:
 
     return status;
 }
+
+/**
+ * Check that mixing saturates and scales by volume exactly as documented.
+ *
+ * \sa SDL_MixAudioFormat
+ */
+static int audio_mixAudioFormat(void *arg)
+{
+    static const int volumes[] = { 1, 17, 64, 127, SDL_MIX_MAXVOLUME };
+    /* odd lengths exercise the scalar leftovers of the SIMD mixers, too */
+    const int num_samples = SDLTest_RandomIntegerInRange(1000, 1100);
+    Sint16 *src16 = (Sint16 *)SDL_malloc(num_samples * sizeof(Sint16));
+    Sint16 *dst16 = (Sint16 *)SDL_malloc(num_samples * sizeof(Sint16));
+    Sint16 *ref16 = (Sint16 *)SDL_malloc(num_samples * sizeof(Sint16));
+    Sint32 *src32 = (Sint32 *)SDL_malloc(num_samples * sizeof(Sint32));
+    Sint32 *dst32 = (Sint32 *)SDL_malloc(num_samples * sizeof(Sint32));
+    Sint32 *ref32 = (Sint32 *)SDL_malloc(num_samples * sizeof(Sint32));
+    float *srcf = (float *)SDL_malloc(num_samples * sizeof(float));
+    float *dstf = (float *)SDL_malloc(num_samples * sizeof(float));
+    float *reff = (float *)SDL_malloc(num_samples * sizeof(float));
+    int status = TEST_ABORTED;
+    int i, j;
+
+    SDLTest_AssertCheck(src16 && dst16 && ref16 && src32 && dst32 && ref32 && srcf && dstf && reff, "Expected buffers to be created.");
+    if (!src16 || !dst16 || !ref16 || !src32 || !dst32 || !ref32 || !srcf || !dstf || !reff) {
+        goto cleanup;
+    }
+
+    for (i = 0; i < SDL_arraysize(volumes); ++i) {
+        const int volume = volumes[i];
+        int mismatches16 = 0;
+        int mismatches32 = 0;
+        int mismatchesf = 0;
+        int ret;
+
+        for (j = 0; j < num_samples; ++j) {
+            src16[j] = SDLTest_RandomSint16();
+            dst16[j] = SDLTest_RandomSint16();
+            src32[j] = SDLTest_RandomSint32();
+            dst32[j] = SDLTest_RandomSint32();
+            /* [-2.0, 2.0), so mixing can leave the [-1.0, 1.0] range */
+            srcf[j] = SDLTest_RandomSint32() / 1073741824.0f;
+            dstf[j] = SDLTest_RandomSint32() / 1073741824.0f;
+
+            ref16[j] = (Sint16)SDL_clamp(dst16[j] + ((src16[j] * volume) / SDL_MIX_MAXVOLUME), SDL_MIN_SINT16, SDL_MAX_SINT16);
+            ref32[j] = (Sint32)SDL_clamp(dst32[j] + (((Sint64)src32[j] * volume) / SDL_MIX_MAXVOLUME), SDL_MIN_SINT32, SDL_MAX_SINT32);
+            reff[j] = dstf[j] + ((srcf[j] * (float)volume) * (1.0f / SDL_MIX_MAXVOLUME));
+        }
+
+        ret = SDL_MixAudioFormat((Uint8 *)dst16, (const Uint8 *)src16, SDL_AUDIO_S16, num_samples * sizeof(Sint16), volume);
+        SDLTest_AssertCheck(ret == 0, "Expected SDL_MixAudioFormat(S16, volume=%d) to succeed", volume);
+        ret = SDL_MixAudioFormat((Uint8 *)dst32, (const Uint8 *)src32, SDL_AUDIO_S32, num_samples * sizeof(Sint32), volume);
+        SDLTest_AssertCheck(ret == 0, "Expected SDL_MixAudioFormat(S32, volume=%d) to succeed", volume);
+        ret = SDL_MixAudioFormat((Uint8 *)dstf, (const Uint8 *)srcf, SDL_AUDIO_F32, num_samples * sizeof(float), volume);
+        SDLTest_AssertCheck(ret == 0, "Expected SDL_MixAudioFormat(F32, volume=%d) to succeed", volume);
+
+        for (j = 0; j < num_samples; ++j) {
+            mismatches16 += (dst16[j] != ref16[j]);
+            mismatches32 += (dst32[j] != ref32[j]);
+            mismatchesf += (SDL_memcmp(&dstf[j], &reff[j], sizeof(float)) != 0);
+        }
+
+        SDLTest_AssertCheck(mismatches16 == 0, "S16 mix at volume %d should match the reference; %d samples differ", volume, mismatches16);
+        SDLTest_AssertCheck(mismatches32 == 0, "S32 mix at volume %d should match the reference; %d samples differ", volume, mismatches32);
+        SDLTest_AssertCheck(mismatchesf == 0, "F32 mix at volume %d should match the reference; %d samples differ", volume, mismatchesf);
+    }
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    SDL_free(src16);
+    SDL_free(dst16);
+    SDL_free(ref16);
+    SDL_free(src32);
+    SDL_free(dst32);
+    SDL_free(ref32);
+    SDL_free(srcf);
+    SDL_free(dstf);
+    SDL_free(reff);
+
+    return status;
+}
+
+/* Bit-exact copies of the scalar converters in SDL_audiotypecvt.c, every SIMD version must match these. */
+static Uint32 float_to_bits(float f)
+{
+    Uint32 u;
+    SDL_memcpy(&u, &f, sizeof(u));
+    return u;
+}
+
+static float bits_to_float(Uint32 u)
+{
+    float f;
+    SDL_memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+#define SIGNMASK(x) (Uint32)(0u - ((Uint32)(x) >> 31))
+
+static float reference_from_sample(SDL_AudioFormat format, const Uint8 *src, int i)
+{
+    switch (format) {
+    case SDL_AUDIO_S8:
+        return bits_to_float(src[i] ^ 0x47800080u) - 65537.0f;
+    case SDL_AUDIO_U8:
+        return bits_to_float(src[i] ^ 0x47800000u) - 65537.0f;
+    case SDL_AUDIO_S16:
+        return bits_to_float(((const Uint16 *)src)[i] ^ 0x43808000u) - 257.0f;
+    case SDL_AUDIO_S32:
+        return (float)((const Sint32 *)src)[i] * 0.0000000004656612873077392578125f;
+    default:
+        return 0.0f;
+    }
+}
+
+static void reference_to_sample(SDL_AudioFormat format, Uint8 *dst, int i, float f)
+{
+    Uint32 y, z;
+
+    switch (format) {
+    case SDL_AUDIO_S8:
+    case SDL_AUDIO_U8:
+        y = float_to_bits(f + 98304.0f) - 0x47C00000u;
+        z = 0x7Fu - (y ^ SIGNMASK(y));
+        y = ((format == SDL_AUDIO_U8) ? (y ^ 0x80u) : y) ^ (z & SIGNMASK(z));
+        dst[i] = (Uint8)(y & 0xFF);
+        break;
+    case SDL_AUDIO_S16:
+        y = float_to_bits(f + 384.0f) - 0x43C00000u;
+        z = 0x7FFFu - (y ^ SIGNMASK(y));
+        y = y ^ (z & SIGNMASK(z));
+        ((Sint16 *)dst)[i] = (Sint16)(y & 0xFFFF);
+        break;
+    case SDL_AUDIO_S32:
+        y = float_to_bits(f) + 0x0F800000u;
+        z = y - 0xCF000000u;
+        z &= SIGNMASK(y ^ z);
+        ((Sint32 *)dst)[i] = (Sint32)bits_to_float(y - z) ^ (Sint32)SIGNMASK(z);
+        break;
+    default:
+        break;
+    }
+}
+
+#undef SIGNMASK
+
+/**
+ * Check that converting between audio formats matches the scalar converters bit-for-bit.
+ *
+ * \sa SDL_ConvertAudioSamples
+ */
+static int audio_convertConformance(void *arg)
+{
+    static const SDL_AudioFormat formats[] = { SDL_AUDIO_S8, SDL_AUDIO_U8, SDL_AUDIO_S16, SDL_AUDIO_S32 };
+    static const char *format_names[] = { "S8", "U8", "S16", "S32" };
+    /* not a multiple of any block size, so the leftover paths get exercised, too */
+    const int num_samples = 65536 + SDLTest_RandomIntegerInRange(1, 63);
+    float *floats = (float *)SDL_malloc(num_samples * sizeof(float));
+    Uint8 *ints = (Uint8 *)SDL_malloc(num_samples * sizeof(Sint32));
+    Uint8 *expected = (Uint8 *)SDL_malloc(num_samples * sizeof(float));
+    int status = TEST_ABORTED;
+    int i, j;
+
+    SDLTest_AssertCheck(floats && ints && expected, "Expected buffers to be created.");
+    if (!floats || !ints || !expected) {
+        goto cleanup;
+    }
+
+    /* Mostly [-1.0, 1.0], plus values just past and far outside of that range */
+    for (i = 0; i < num_samples; ++i) {
+        switch (i % 4) {
+        case 0:
+            floats[i] = (float)(i % 128) * ((i & 1) ? 1.0f : -1.0f);
+            break;
+        case 1:
+            floats[i] = ((float)(1 << 24) + (float)((i / 4) % 1024) - 512.0f) / (float)(1 << 24) * ((i & 2) ? 1.0f : -1.0f);
+            break;
+        default:
+            floats[i] = SDLTest_RandomSint32() / 2147483648.0f;
+            break;
+        }
+    }
+
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        const SDL_AudioFormat format = formats[i];
+        const int sample_size = SDL_AUDIO_BYTESIZE(format);
+        SDL_AudioSpec float_spec, int_spec;
+        Uint8 *dst_data = NULL;
+        int dst_len = 0;
+        int mismatches = 0;
+        int ret;
+
+        float_spec.format = SDL_AUDIO_F32;
+        float_spec.channels = 1;
+        float_spec.freq = 48000;
+        int_spec.format = format;
+        int_spec.channels = 1;
+        int_spec.freq = 48000;
+
+        /* F32 -> format */
+        for (j = 0; j < num_samples; ++j) {
+            reference_to_sample(format, expected, j, floats[j]);
+        }
+        ret = SDL_ConvertAudioSamples(&float_spec, (const Uint8 *)floats, num_samples * sizeof(float), &int_spec, &dst_data, &dst_len);
+        SDLTest_AssertCheck(ret == 0, "Expected SDL_ConvertAudioSamples(F32->%s) to succeed", format_names[i]);
+        SDLTest_AssertCheck(dst_len == num_samples * sample_size, "Expected %d bytes, got %d", num_samples * sample_size, dst_len);
+        if (ret == 0 && dst_len == num_samples * sample_size) {
+            for (j = 0; j < num_samples; ++j) {
+                mismatches += (SDL_memcmp(dst_data + (j * sample_size), expected + (j * sample_size), sample_size) != 0);
+            }
+        }
+        SDLTest_AssertCheck(mismatches == 0, "F32->%s should match the scalar reference; %d samples differ", format_names[i], mismatches);
+        SDL_free(dst_data);
+
+        /* format -> F32, using every possible byte value along the way */
+        for (j = 0; j < num_samples * sample_size; ++j) {
+            ints[j] = (Uint8)((j * 7) ^ SDLTest_RandomUint8());
+        }
+        for (j = 0; j < num_samples; ++j) {
+            ((float *)expected)[j] = reference_from_sample(format, ints, j);
+        }
+        dst_data = NULL;
+        dst_len = 0;
+        mismatches = 0;
+        ret = SDL_ConvertAudioSamples(&int_spec, ints, num_samples * sample_size, &float_spec, &dst_data, &dst_len);
+        SDLTest_AssertCheck(ret == 0, "Expected SDL_ConvertAudioSamples(%s->F32) to succeed", format_names[i]);
+        SDLTest_AssertCheck(dst_len == num_samples * (int)sizeof(float), "Expected %d bytes, got %d", num_samples * (int)sizeof(float), dst_len);
+        if (ret == 0 && dst_len == num_samples * (int)sizeof(float)) {
+            mismatches = 0;
+            for (j = 0; j < num_samples; ++j) {
+                mismatches += (SDL_memcmp(dst_data + (j * sizeof(float)), expected + (j * sizeof(float)), sizeof(float)) != 0);
+            }
+        }
+        SDLTest_AssertCheck(mismatches == 0, "%s->F32 should match the scalar reference; %d samples differ", format_names[i], mismatches);
+        SDL_free(dst_data);
+    }
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    SDL_free(floats);
+    SDL_free(ints);
+    SDL_free(expected);
+
+    return status;
+}
+
+static int audio_resampleBlocks(void *arg)
+{
+    static const struct {
+        int src_channels;
+        int src_rate;
+        int dst_channels;
+        int dst_rate;
+    } cases[] = {
+        { 2, 44100, 2, 48000 },
+        { 2, 48000, 6, 44100 },
+        { 6, 22050, 2, 48000 },
+        { 8, 96000, 8, 8000 },
+        { 1, 8000, 8, 192000 },
+    };
+    static const SDL_AudioFormat formats[] = { SDL_AUDIO_S16, SDL_AUDIO_F32 };
+    const int num_frames = 20000 + SDLTest_RandomIntegerInRange(1, 255);
+    Uint8 *native = (Uint8 *)SDL_malloc(num_frames * 8 * sizeof(float));
+    Uint8 *swapped = (Uint8 *)SDL_malloc(num_frames * 8 * sizeof(float));
+    int status = TEST_ABORTED;
+    int i, j, k;
+
+    SDLTest_AssertCheck(native && swapped, "Expected buffers to be created.");
+    if (!native || !swapped) {
+        goto cleanup;
+    }
+
+    for (i = 0; i < SDL_arraysize(cases); ++i) {
+        for (j = 0; j < SDL_arraysize(formats); ++j) {
+            const SDL_AudioFormat format = formats[j];
+            const int sample_size = SDL_AUDIO_BYTESIZE(format);
+            const int num_samples = num_frames * cases[i].src_channels;
+            SDL_AudioSpec src_spec, swapped_spec, dst_spec;
+            SDL_AudioStream *stream = NULL;
+            Uint8 *expected = NULL;
+            Uint8 *actual = NULL;
+            int expected_len = 0;
+            int actual_len = 0;
+            int ret;
+
+            for (k = 0; k < num_samples; ++k) {
+                if (format == SDL_AUDIO_F32) {
+                    const float f = SDLTest_RandomSint16() / 32768.0f;
+                    SDL_memcpy(native + (k * sample_size), &f, sample_size);
+                } else {
+                    const Sint16 s = SDLTest_RandomSint16();
+                    SDL_memcpy(native + (k * sample_size), &s, sample_size);
+                }
+                if (sample_size == 2) {
+                    ((Uint16 *)swapped)[k] = SDL_Swap16(((const Uint16 *)native)[k]);
+                } else {
+                    ((Uint32 *)swapped)[k] = SDL_Swap32(((const Uint32 *)native)[k]);
+                }
+            }
+
+            src_spec.format = format;
+            src_spec.channels = cases[i].src_channels;
+            src_spec.freq = cases[i].src_rate;
+            SDL_copyp(&swapped_spec, &src_spec);
+            swapped_spec.format = format ^ SDL_AUDIO_MASK_BIG_ENDIAN;
+            dst_spec.format = SDL_AUDIO_F32;
+            dst_spec.channels = cases[i].dst_channels;
+            dst_spec.freq = cases[i].dst_rate;
+
+            /* The foreign byte order takes the unfused path through the whole work buffer. */
+            ret = SDL_ConvertAudioSamples(&swapped_spec, swapped, num_samples * sample_size, &dst_spec, &expected, &expected_len);
+            SDLTest_AssertCheck(ret == 0, "Expected SDL_ConvertAudioSamples(byteswapped) to succeed");
+
+            /* The native byte order gets resampled in blocks; read it back in odd-sized pieces. */
+            stream = SDL_CreateAudioStream(&src_spec, &dst_spec);
+            SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed");
+            if (ret == 0 && stream) {
+                const int dst_frame_size = SDL_AUDIO_FRAMESIZE(dst_spec);
+
+                ret = SDL_PutAudioStreamData(stream, native, num_samples * sample_size);
+                SDLTest_AssertCheck(ret == 0, "Expected SDL_PutAudioStreamData to succeed");
+                ret = SDL_FlushAudioStream(stream);
+                SDLTest_AssertCheck(ret == 0, "Expected SDL_FlushAudioStream to succeed");
+
+                actual = (Uint8 *)SDL_malloc(expected_len + dst_frame_size);
+                while (actual && actual_len < expected_len + dst_frame_size) {
+                    const int request = SDLTest_RandomIntegerInRange(1, 1000) * dst_frame_size;
+                    ret = SDL_GetAudioStreamData(stream, actual + actual_len, SDL_min(request, expected_len + dst_frame_size - actual_len));
+                    if (ret <= 0) {
+                        break;
+                    }
+                    actual_len += ret;
+                }
+
+                SDLTest_AssertCheck(actual_len == expected_len, "Expected %d bytes, got %d", expected_len, actual_len);
+                SDLTest_AssertCheck(actual && actual_len == expected_len && SDL_memcmp(actual, expected, expected_len) == 0,
+                                    "%s %d ch @ %d Hz -> F32 %d ch @ %d Hz should match the unfused conversion exactly",
+                                    (format == SDL_AUDIO_F32) ? "F32" : "S16", cases[i].src_channels, cases[i].src_rate,
+                                    cases[i].dst_channels, cases[i].dst_rate);
+            }
+
+            SDL_DestroyAudioStream(stream);
+            SDL_free(expected);
+            SDL_free(actual);
+        }
+    }
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    SDL_free(native);
+    SDL_free(swapped);
+
+    return status;
+}
+
+/**
+ * Check each resampler quality level against a sine wave, and for exact 2x upsampling.
+ *
+ * \sa SDL_GetAudioStreamProperties
+ */
+static int audio_resampleQuality(void *arg)
+{
+    static const struct {
+        SDL_AudioResampleQuality quality;
+        const char *name;
+        double signal_to_noise;
+    } levels[] = {
+        { SDL_AUDIO_RESAMPLE_QUALITY_ZERO_ORDER_HOLD, "zero-order hold", 20 },
+        { SDL_AUDIO_RESAMPLE_QUALITY_LINEAR, "linear", 55 },
+        { SDL_AUDIO_RESAMPLE_QUALITY_CUBIC, "cubic", 70 },
+        { SDL_AUDIO_RESAMPLE_QUALITY_HIGH, "high", 75 },
+    };
+    const int rate_in = 44100;
+    const int rate_out = 48000;
+    const int frames_in = 2 * rate_in;
+    const int frames_out = 2 * rate_out;
+    float *buf_in = (float *)SDL_malloc(frames_in * 2 * sizeof(float));
+    float *buf_out = (float *)SDL_malloc(frames_out * 4 * sizeof(float));
+    int status = TEST_ABORTED;
+    int i, j;
+
+    SDLTest_AssertCheck(buf_in && buf_out, "Expected buffers to be created.");
+    if (!buf_in || !buf_out) {
+        goto cleanup;
+    }
+
+    for (i = 0; i < SDL_arraysize(levels); ++i) {
+        SDL_AudioSpec src_spec, dst_spec;
+        SDL_AudioStream *stream;
+        double sum_squared_error = 0;
+        double sum_squared_value = 0;
+        double signal_to_noise;
+        int len_out;
+        int ret;
+
+        /* 44100 Hz to 48000 Hz stereo, with a slightly different tone on each channel */
+        for (j = 0; j < frames_in; ++j) {
+            buf_in[j * 2 + 0] = (float)sine_wave_sample(j, rate_in, 440, 0);
+            buf_in[j * 2 + 1] = (float)sine_wave_sample(j, rate_in, 660, SDL_PI_D / 2);
+        }
+
+        src_spec.format = SDL_AUDIO_F32;
+        src_spec.channels = 2;
+        src_spec.freq = rate_in;
+        dst_spec.format = SDL_AUDIO_F32;
+        dst_spec.channels = 2;
+        dst_spec.freq = rate_out;
+
+        stream = SDL_CreateAudioStream(&src_spec, &dst_spec);
+        SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed.");
+        if (!stream) {
+            goto cleanup;
+        }
+        ret = SDL_SetNumberProperty(SDL_GetAudioStreamProperties(stream), SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER, levels[i].quality);
+        SDLTest_AssertCheck(ret == 0, "Expected SDL_SetNumberProperty to succeed.");
+        ret = SDL_PutAudioStreamData(stream, buf_in, frames_in * 2 * sizeof(float));
+        SDLTest_AssertCheck(ret == 0, "Expected SDL_PutAudioStreamData to succeed.");
+        ret = SDL_FlushAudioStream(stream);
+        SDLTest_AssertCheck(ret == 0, "Expected SDL_FlushAudioStream to succeed.");
+        len_out = SDL_GetAudioStreamData(stream, buf_out, frames_out * 4 * sizeof(float));
+        SDLTest_AssertCheck(len_out >= frames_out * 2 * (int)sizeof(float), "Expected at least %d bytes of %s resampled output, got %d.",
+                            frames_out * 2 * (int)sizeof(float), levels[i].name, len_out);
+        SDL_DestroyAudioStream(stream);
+
+        if (len_out < frames_out * 2 * (int)sizeof(float)) {
+            continue;
+        }
+
+        /* Skip the last few frames, where the flushed stream runs into silence */
+        for (j = 0; j < frames_out - 16; ++j) {
+            const double target0 = sine_wave_sample(j, rate_out, 440, 0);
+            const double target1 = sine_wave_sample(j, rate_out, 660, SDL_PI_D / 2);
+            sum_squared_error += (target0 - buf_out[j * 2 + 0]) * (target0 - buf_out[j * 2 + 0]);
+            sum_squared_error += (target1 - buf_out[j * 2 + 1]) * (target1 - buf_out[j * 2 + 1]);
+            sum_squared_value += (target0 * target0) + (target1 * target1);
+        }
+        signal_to_noise = 10 * SDL_log10(sum_squared_value / sum_squared_error);
+        SDLTest_AssertCheck(signal_to_noise >= levels[i].signal_to_noise, "%s resampling signal-to-noise ratio %f dB should be no less than %f dB.",
+                            levels[i].name, signal_to_noise, levels[i].signal_to_noise);
+
+        /* Upsampling exactly 2x lands on (or exactly halfway between) input frames */
+        if (levels[i].quality == SDL_AUDIO_RESAMPLE_QUALITY_HIGH) {
+            continue;
+        }
+
+        for (j = 0; j < frames_in * 2; ++j) {
+            buf_in[j] = (float)SDLTest_RandomSint16() / 32768.0f;
+        }
+
+        src_spec.freq = 22050;
+        dst_spec.freq = 44100;
+        stream = SDL_CreateAudioStream(&src_spec, &dst_spec);
+        SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed.");
+        if (!stream) {
+            goto cleanup;
+        }
+        SDL_SetNumberProperty(SDL_GetAudioStreamProperties(stream), SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER, levels[i].quality);
+        SDL_PutAudioStreamData(stream, buf_in, frames_in * 2 * sizeof(float));
+        SDL_FlushAudioStream(stream);
+        len_out = SDL_GetAudioStreamData(stream, buf_out, frames_out * 4 * sizeof(float));
+        SDLTest_AssertCheck(len_out == frames_in * 4 * (int)sizeof(float), "Expected %d bytes of %s 2x upsampled output, got %d.",
+                            frames_in * 4 * (int)sizeof(float), levels[i].name, len_out);
+        SDL_DestroyAudioStream(stream);
+
+        if (len_out == frames_in * 4 * (int)sizeof(float)) {
+            int mismatches = 0;
+            for (j = 0; j < (frames_in - 1) * 2; ++j) {
+                const int frame = j / 2;
+                const int chan = j % 2;
+                const float a = buf_in[frame * 2 + chan];
+                const float b = buf_in[(frame + 1) * 2 + chan];
+                const float between = buf_out[(frame * 2 + 1) * 2 + chan];
+
+                mismatches += (buf_out[(frame * 2) * 2 + chan] != a);
+                if (levels[i].quality == SDL_AUDIO_RESAMPLE_QUALITY_ZERO_ORDER_HOLD) {
+                    mismatches += (between != a);
+                } else if (levels[i].quality == SDL_AUDIO_RESAMPLE_QUALITY_LINEAR) {
+                    mismatches += (SDL_fabsf(between - ((a + b) * 0.5f)) > 1e-6f);
+                }
+            }
+            SDLTest_AssertCheck(mismatches == 0, "%s 2x upsampling should reproduce the input frames; %d samples differ", levels[i].name, mismatches);
+        }
+    }
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    SDL_free(buf_in);
+    SDL_free(buf_out);
+
+    return status;
+}
+
+typedef struct mix_threads_result_t
+{
+    SDL_AtomicInt calls;
+    int mismatches;
+    int samples;
+} mix_threads_result_t;
+
+static void SDLCALL audio_mixThreadsPostmix(void *userdata, const SDL_AudioSpec *spec, float *buffer, int buflen)
+{
+    mix_threads_result_t *result = (mix_threads_result_t *)userdata;
+    const float expected = 21.0f / 64.0f; /* 1/64 + 2/64 + ... + 6/64 */
+    int i;
+
+    if (SDL_AtomicGet(&result->calls) == 0) {
+        result->samples = buflen / (int)sizeof(float);
+        for (i = 0; i < result->samples; ++i) {
+            result->mismatches += (buffer[i] != expected);
+        }
+    }
+    SDL_AtomicIncRef(&result->calls);
+}
+
+/**
+ * Check that mixing bound streams gives the same result with and without worker threads.
+ *
+ * \sa SDL_HINT_AUDIO_DEVICE_MIX_THREADS
+ */
+static int audio_mixThreads(void *arg)
+{
+    static const char *thread_counts[] = { "0", "3" };
+    const int num_frames = 48000;
+    float *data = (float *)SDL_malloc(num_frames * 8 * sizeof(float));
+    int status = TEST_ABORTED;
+    int i, j, k;
+
+    SDLTest_AssertCheck(data != NULL, "Expected buffer to be created.");
+    if (!data) {
+        return TEST_ABORTED;
+    }
+
+    for (i = 0; i < SDL_arraysize(thread_counts); ++i) {
+        SDL_AudioStream *streams[6];
+        mix_threads_result_t result;
+        SDL_AudioSpec spec;
+        SDL_AudioDeviceID devid;
+        int ret;
+
+        SDL_zeroa(streams);
+        SDL_zero(result);
+
+        /* Restart the audio subsystem, so the physical device gets opened again with the new hint.
+           The test harness holds the default device open, too, so quit all the way. */
+        while (SDL_WasInit(SDL_INIT_AUDIO)) {
+            SDL_QuitSubSystem(SDL_INIT_AUDIO);
+        }
+        SDL_SetHint(SDL_HINT_AUDIO_DEVICE_MIX_THREADS, thread_counts[i]);
+        ret = SDL_InitSubSystem(SDL_INIT_AUDIO);
+        SDLTest_AssertCheck(ret == 0, "Expected SDL_InitSubSystem(SDL_INIT_AUDIO) to succeed.");
+        devid = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_OUTPUT, NULL);
+        SDL_ResetHint(SDL_HINT_AUDIO_DEVICE_MIX_THREADS);
+        SDLTest_AssertCheck(devid != 0, "Expected SDL_OpenAudioDevice to succeed with %s mix threads.", thread_counts[i]);
+        if (!devid) {
+            goto cleanup;
+        }
+
+        /* Set everything up while paused, so the first mix has every stream in it */
+        SDL_PauseAudioDevice(devid);
+        ret = SDL_GetAudioDeviceFormat(devid, &spec, NULL);
+        SDLTest_AssertCheck(ret == 0, "Expected SDL_GetAudioDeviceFormat to succeed.");
+        spec.format = SDL_AUDIO_F32;
+        SDLTest_AssertCheck(spec.channels <= 8, "Expected no more than 8 channels, got %d.", spec.channels);
+
+        for (j = 0; ret == 0 && spec.channels <= 8 && j < SDL_arraysize(streams); ++j) {
+            for (k = 0; k < num_frames * spec.channels; ++k) {
+                data[k] = (float)(j + 1) / 64.0f;
+            }
+            streams[j] = SDL_CreateAudioStream(&spec, &spec);
+            SDLTest_AssertCheck(streams[j] != NULL, "Expected SDL_CreateAudioStream to succeed.");
+            if (!streams[j]) {
+                break;
+            }
+            SDL_PutAudioStreamData(streams[j], data, num_frames * spec.channels * sizeof(float));
+            ret = SDL_BindAudioStream(devid, streams[j]);
+            SDLTest_AssertCheck(ret == 0, "Expected SDL_BindAudioStream to succeed.");
+        }
+
+        if (ret == 0 && j == SDL_arraysize(streams)) {
+            SDL_SetAudioPostmixCallback(devid, audio_mixThreadsPostmix, &result);
+            SDL_ResumeAudioDevice(devid);
+            for (k = 0; k < 200 && SDL_AtomicGet(&result.calls) == 0; ++k) {
+                SDL_Delay(10);
+            }
+            SDL_PauseAudioDevice(devid);
+
+            SDLTest_AssertCheck(SDL_AtomicGet(&result.calls) > 0, "Expected the postmix callback to run with %s mix threads.", thread_counts[i]);
+            SDLTest_AssertCheck(result.samples > 0 && result.mismatches == 0, "Expected every mixed sample to be the sum of all streams with %s mix threads; %d of %d differ.",
+                                thread_counts[i], result.mismatches, result.samples);
+        }
+
+        SDL_CloseAudioDevice(devid);
+        for (j = 0; j < SDL_arraysize(streams); ++j) {
+            SDL_DestroyAudioStream(streams[j]);
+        }
+    }
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    SDL_free(data);
+
+    return status;
+}
+
+typedef struct gain_pan_result_t
+{
+    SDL_AtomicInt calls;
+    int channels;
+    int samples[2];
+    float buffers[2][8192];
+} gain_pan_result_t;
+
+static void SDLCALL audio_gainAndPanPostmix(void *userdata, const SDL_AudioSpec *spec, float *buffer, int buflen)
+{
+    gain_pan_result_t *result = (gain_pan_result_t *)userdata;
+    const int call = SDL_AtomicGet(&result->calls);
+
+    if (call < 2) {
+        result->channels = spec->channels;
+        result->samples[call] = SDL_min(buflen / (int)sizeof(float), (int)SDL_arraysize(result->buffers[call]));
+        SDL_memcpy(result->buffers[call], buffer, result->samples[call] * sizeof(float));
+    }
+    SDL_AtomicIncRef(&result->calls);
+}
+
+/**
+ * Check that a stream's gain and pan get applied when it is mixed, ramping to new values while it's bound.
+ *
+ * \sa SDL_SetAudioStreamGain
+ * \sa SDL_SetAudioStreamPan
+ */
+static int audio_gainAndPan(void *arg)
+{
+    const int num_frames = 48000;
+    const float value = 0.5f;
+    gain_pan_result_t *result = (gain_pan_result_t *)SDL_calloc(1, sizeof(*result));
+    float *data = (float *)SDL_malloc(num_frames * 8 * sizeof(float));
+    SDL_AudioStream *stream = NULL;
+    SDL_AudioDeviceID devid = 0;
+    SDL_AudioSpec spec;
+    static const float unity[8] = { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+    float gains[8];
+    int status = TEST_ABORTED;
+    int ret, i, j, phase;
+
+    SDLTest_AssertCheck(result != NULL && data != NULL, "Expected buffers to be created.");
+    if (!result || !data) {
+        goto cleanup;
+    }
+
+    stream = SDL_CreateAudioStream(NULL, NULL);
+    SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed.");
+    if (!stream) {
+        goto cleanup;
+    }
+
+    /* Check the parameters */
+    SDLTest_AssertCheck(SDL_GetAudioStreamGain(stream) == 1.0f, "Expected the default gain to be 1.0.");
+    SDLTest_AssertCheck(SDL_GetAudioStreamPan(stream) == 0.0f, "Expected the default pan to be 0.0.");
+    SDLTest_AssertCheck(SDL_SetAudioStreamGain(stream, -0.5f) < 0, "Expected a negative gain to be rejected.");
+    SDLTest_AssertCheck(SDL_SetAudioStreamPan(stream, 1.5f) < 0, "Expected a pan greater than 1.0 to be rejected.");
+    SDLTest_AssertCheck(SDL_SetAudioStreamPan(stream, -1.5f) < 0, "Expected a pan less than -1.0 to be rejected.");
+    SDLTest_AssertCheck(SDL_GetAudioStreamGain(NULL) < 0.0f, "Expected SDL_GetAudioStreamGain(NULL) to fail.");
+    SDLTest_AssertCheck(SDL_SetAudioStreamGain(stream, 0.5f) == 0, "Expected SDL_SetAudioStreamGain to succeed.");
+    SDLTest_AssertCheck(SDL_SetAudioStreamPan(stream, 0.5f) == 0, "Expected SDL_SetAudioStreamPan to succeed.");
+    SDLTest_AssertCheck(SDL_GetAudioStreamGain(stream) == 0.5f, "Expected the gain to be 0.5.");
+    SDLTest_AssertCheck(SDL_GetAudioStreamPan(stream) == 0.5f, "Expected the pan to be 0.5.");
+
+    devid = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_OUTPUT, NULL);
+    SDLTest_AssertCheck(devid != 0, "Expected SDL_OpenAudioDevice to succeed.");
+    if (!devid) {
+        goto cleanup;
+    }
+
+    /* Set everything up while paused, so the first mix has the stream in it */
+    SDL_PauseAudioDevice(devid);
+    ret = SDL_GetAudioDeviceFormat(devid, &spec, NULL);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_GetAudioDeviceFormat to succeed.");
+    SDLTest_AssertCheck(spec.channels <= 8, "Expected no more than 8 channels, got %d.", spec.channels);
+    if (ret != 0 || spec.channels > 8) {
+        goto cleanup;
+    }
+    spec.format = SDL_AUDIO_F32;
+
+    /* The gains for the left and right channels are balanced by the pan; anything else only gets the gain */
+    for (i = 0; i < spec.channels; ++i) {
+        gains[i] = 0.5f;
+    }
+    if (spec.channels == 2) {
+        gains[0] = 0.25f;
+    }
+
+    for (i = 0; i < num_frames * spec.channels; ++i) {
+        data[i] = value;
+    }
+    SDL_SetAudioStreamFormat(stream, &spec, NULL);
+
+    /* A stream starts at its own gains when bound, and ramps when they change while it's bound.
+       Every phase starts from the gains above, the second one ramps back to unity gain. */
+    for (phase = 0; phase < 3; ++phase) {
+        const float *to = (phase == 1) ? unity : gains;
+
+        if (phase == 1) {
+            SDL_SetAudioStreamGain(stream, 1.0f);
+            SDL_SetAudioStreamPan(stream, 0.0f);
+        } else if (phase == 2) {
+            /* Rebinding mustn't ramp from what the stream was last mixed with */
+            SDL_UnbindAudioStream(stream);
+            SDL_SetAudioStreamGain(stream, 0.5f);
+            SDL_SetAudioStreamPan(stream, 0.5f);
+        }
+        if (phase != 1) {
+            ret = SDL_BindAudioStream(devid, stream);
+            SDLTest_AssertCheck(ret == 0, "Expected SDL_BindAudioStream to succeed.");
+            if (ret != 0) {
+                goto cleanup;
+            }
+        }
+        if (phase == 0) {
+            ret = SDL_PutAudioStreamData(stream, data, num_frames * spec.channels * sizeof(float));
+            SDLTest_AssertCheck(ret == 0, "Expected SDL_PutAudioStreamData to succeed.");
+            if (ret != 0) {
+                goto cleanup;
+            }
+        }
+
+        SDL_AtomicSet(&result->calls, 0);
+        SDL_SetAudioPostmixCallback(devid, audio_gainAndPanPostmix, result);
+        SDL_ResumeAudioDevice(devid);
+        for (i = 0; i < 200 && SDL_AtomicGet(&result->calls) < 2; ++i) {
+            SDL_Delay(10);
+        }
+        SDL_PauseAudioDevice(devid);
+        SDL_SetAudioPostmixCallback(devid, NULL, NULL);
+
+        SDLTest_AssertCheck(SDL_AtomicGet(&result->calls) >= 2, "Expected the postmix callback to run at least twice.");
+        if (SDL_AtomicGet(&result->calls) < 2) {
+            goto cleanup;
+        }
+        SDLTest_AssertCheck(result->channels == spec.channels, "Expected the postmix callback to get %d channels, got %d.", spec.channels, result->channels);
+        SDLTest_AssertCheck(result->samples[0] >= 2 * spec.channels && result->samples[1] >= spec.channels, "Expected the postmix callback to get at least two frames.");
+
+        /* The first buffer ramps from the old gains to the new ones, the second holds them */
+        for (j = 0; j < spec.channels; ++j) {
+            const float start = value * gains[j];
+            const float end = value * to[j];
+            int mismatches = 0;
+            SDLTest_AssertCheck(result->buffers[0][j] == start, "Expected the ramp on channel %d to start at %f, got %f.", j, start, result->buffers[0][j]);
+            for (i = j + spec.channels; i < result->samples[0]; i += spec.channels) {
+                const float prev = result->buffers[0][i - spec.channels];
+                if (end <= start) {
+                    mismatches += (result->buffers[0][i] > prev || result->buffers[0][i] < end);
+                } else {
+                    mismatches += (result->buffers[0][i] < prev || result->buffers[0][i] > end);
+                }
+            }
+            SDLTest_AssertCheck(mismatches == 0, "Expected the ramp on channel %d to go from %f toward %f; %d samples didn't.", j, start, end, mismatches);
+
+            mismatches = 0;
+            for (i = j; i < result->samples[1]; i += spec.channels) {
+                mismatches += (result->buffers[1][i] != end);
+            }
+            SDLTest_AssertCheck(mismatches == 0, "Expected channel %d to be mixed at %f after the ramp; %d samples weren't.", j, end, mismatches);
+        }
+    }
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    if (devid) {
+        SDL_CloseAudioDevice(devid);
+    }
+    SDL_DestroyAudioStream(stream);
+    SDL_free(data);
+    SDL_free(result);
+
+    return status;
+}
+
+typedef struct spsc_producer_t
+{
+    SDL_AudioStream *stream;
+    int num_frames;
+    int failures;
+} spsc_producer_t;
+
+static int SDLCALL audio_spscProducer(void *userdata)
+{
+    spsc_producer_t *producer = (spsc_producer_t *)userdata;
+    Sint32 block[4096];
+    int frame = 0;
+
+    while (frame < producer->num_frames) {
+        /* Mix up blocks that fit in the ring with ones that don't */
+        int len = SDLTest_RandomIntegerInRange(1, SDL_arraysize(block));
+        int i;
+
+        len = SDL_min(len, producer->num_frames - frame);
+
+        for (i = 0; i < len; ++i) {
+            block[i] = frame++;
+        }
+        if (SDL_PutAudioStreamData(producer->stream, block, len * sizeof(Sint32)) != 0) {
+            producer->failures++;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Check that an SPSC stream passes everything through in order, with a thread putting data while another gets it.
+ *
+ * \sa SDL_CreateAudioStreamWithProperties
+ */
+static int audio_spscStream(void *arg)
+{
+    const SDL_AudioSpec spec = { SDL_AUDIO_S32, 1, 48000 };
+    const int num_frames = 500000;
+    Sint32 block[2048];
+    spsc_producer_t producer;
+    SDL_PropertiesID props;
+    SDL_AudioStream *stream;
+    SDL_Thread *thread;
+    int frame = 0;
+    int mismatches = 0;
+    int i;
+
+    props = SDL_CreateProperties();
+    SDL_SetBooleanProperty(props, SDL_PROP_AUDIOSTREAM_CREATE_SPSC_BOOLEAN, SDL_TRUE);
+    SDL_SetNumberProperty(props, SDL_PROP_AUDIOSTREAM_CREATE_SPSC_BUFFER_SIZE_NUMBER, -1);
+    stream = SDL_CreateAudioStreamWithProperties(props);
+    SDLTest_AssertCheck(stream == NULL, "Expected SDL_CreateAudioStreamWithProperties to reject a negative ring size.");
+    SDL_DestroyAudioStream(stream);
+
+    /* Smaller than the producer's biggest blocks, so it has to take the lock now and then */
+    SDL_SetNumberProperty(props, SDL_PROP_AUDIOSTREAM_CREATE_SPSC_BUFFER_SIZE_NUMBER, 10000);
+    SDL_SetProperty(props, SDL_PROP_AUDIOSTREAM_CREATE_SRC_SPEC_POINTER, (void *)&spec);
+    SDL_SetProperty(props, SDL_PROP_AUDIOSTREAM_CREATE_DST_SPEC_POINTER, (void *)&spec);
+    stream = SDL_CreateAudioStreamWithProperties(props);
+    SDL_DestroyProperties(props);
+    SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStreamWithProperties to succeed.");
+    if (!stream) {
+        return TEST_ABORTED;
+    }
+
+    /* Partial frames go down the locked path, and fail there */
+    SDLTest_AssertCheck(SDL_PutAudioStreamData(stream, block, 3) < 0, "Expected putting a partial frame to fail.");
+
+    /* Data put in the ring counts as queued */
+    block[0] = 0;
+    SDLTest_AssertCheck(SDL_PutAudioStreamData(stream, block, sizeof(Sint32)) == 0, "Expected SDL_PutAudioStreamData to succeed.");
+    SDLTest_AssertCheck(SDL_GetAudioStreamQueued(stream) == sizeof(Sint32), "Expected one frame to be queued, got %d bytes.", SDL_GetAudioStreamQueued(stream));
+    SDLTest_AssertCheck(SDL_ClearAudioStream(stream) == 0, "Expected SDL_ClearAudioStream to succeed.");
+
+    producer.stream = stream;
+    producer.num_frames = num_frames;
+    producer.failures = 0;
+    thread = SDL_CreateThread(audio_spscProducer, "audio_spscProducer", &producer);
+    SDLTest_AssertCheck(thread != NULL, "Expected SDL_CreateThread to succeed.");
+    if (!thread) {
+        SDL_DestroyAudioStream(stream);
+        return TEST_ABORTED;
+    }
+
+    while (frame < num_frames) {
+        const int br = SDL_GetAudioStreamData(stream, block, sizeof(block));
+        if (br < 0) {
+            break;
+        } else if (br == 0) {
+            SDL_Delay(0);
+            continue;
+        }
+        for (i = 0; i < br / (int)sizeof(Sint32); ++i) {
+            mismatches += (block[i] != frame++);
+        }
+    }
+    SDL_WaitThread(thread, NULL);
+
+    SDLTest_AssertCheck(producer.failures == 0, "Expected every put to succeed; %d failed.", producer.failures);
+    SDLTest_AssertCheck(frame == num_frames, "Expected to get %d frames, got %d.", num_frames, frame);
+    SDLTest_AssertCheck(mismatches == 0, "Expected frames to come out in order; %d didn't.", mismatches);
+    SDLTest_AssertCheck(SDL_GetAudioStreamAvailable(stream) == 0, "Expected nothing to be left in the stream.");
+
+    SDL_DestroyAudioStream(stream);
+
+    return TEST_COMPLETED;
+}
+
+typedef struct nocopy_result_t
+{
+    int releases;
+    const void *released[4];
+    int released_len[4];
+} nocopy_result_t;
+
+static void SDLCALL audio_noCopyRelease(void *userdata, const void *buf, int buflen)
+{
+    nocopy_result_t *result = (nocopy_result_t *)userdata;
+
+    if (result->releases < SDL_arraysize(result->released)) {
+        result->released[result->releases] = buf;
+        result->released_len[result->releases] = buflen;
+    }
+    result->releases++;
+}
+
+/**
+ * Check that data put without copying comes back out, and that the buffers are released when the stream is done with them.
+ *
+ * \sa SDL_PutAudioStreamDataNoCopy
+ */
+static int audio_putNoCopy(void *arg)
+{
+    const SDL_AudioSpec spec = { SDL_AUDIO_S16, 2, 22050 };
+    const int num_samples = 1000;
+    Sint16 *buffers[3];
+    Sint16 *output;
+    nocopy_result_t result;
+    SDL_AudioStream *stream;
+    int status = TEST_ABORTED;
+    int mismatches = 0;
+    int ret, i, j;
+
+    SDL_zero(result);
+    SDL_zeroa(buffers);
+    output = (Sint16 *)SDL_malloc(num_samples * 4 * sizeof(Sint16));
+    stream = SDL_CreateAudioStream(&spec, &spec);
+    SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed.");
+    SDLTest_AssertCheck(output != NULL, "Expected output buffer to be created.");
+    if (!stream || !output) {
+        goto cleanup;
+    }
+
+    for (i = 0; i < SDL_arraysize(buffers); ++i) {
+        buffers[i] = (Sint16 *)SDL_malloc(num_samples * sizeof(Sint16));
+        SDLTest_AssertCheck(buffers[i] != NULL, "Expected input buffer to be created.");
+        if (!buffers[i]) {
+            goto cleanup;
+        }
+        for (j = 0; j < num_samples; ++j) {
+            buffers[i][j] = (Sint16)(i * num_samples + j);
+        }
+    }
+
+    /* Partial frames are refused, and the callback doesn't fire */
+    ret = SDL_PutAudioStreamDataNoCopy(stream, buffers[0], 2, audio_noCopyRelease, &result);
+    SDLTest_AssertCheck(ret < 0 && result.releases == 0, "Expected putting a partial frame to fail without a release.");
+
+    /* Buffer, copy, buffer: they have to come back out in order */
+    ret = SDL_PutAudioStreamDataNoCopy(stream, buffers[0], num_samples * sizeof(Sint16), audio_noCopyRelease, &result);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_PutAudioStreamDataNoCopy to succeed.");
+    ret = SDL_PutAudioStreamData(stream, buffers[1], num_samples * sizeof(Sint16));
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_PutAudioStreamData to succeed.");
+    ret = SDL_PutAudioStreamDataNoCopy(stream, buffers[2], num_samples * sizeof(Sint16), audio_noCopyRelease, &result);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_PutAudioStreamDataNoCopy to succeed.");
+    SDLTest_AssertCheck(result.releases == 0, "Expected no buffers to be released before reading, got %d.", result.releases);
+    SDLTest_AssertCheck(SDL_GetAudioStreamQueued(stream) == 3 * num_samples * sizeof(Sint16), "Expected all the data to be queued.");
+    SDL_FlushAudioStream(stream);
+
+    /* Reading exactly the first buffer releases it */
+    ret = SDL_GetAudioStreamData(stream, output, num_samples * sizeof(Sint16));
+    SDLTest_AssertCheck(ret == num_samples * sizeof(Sint16), "Expected to get the first buffer back, got %d bytes.", ret);
+    SDLTest_AssertCheck(result.releases == 1 && result.released[0] == buffers[0] && result.released_len[0] == num_samples * sizeof(Sint16),
+                        "Expected the first buffer to be released once it was read.");
+
+    ret = SDL_GetAudioStreamData(stream, &output[num_samples], 3 * num_samples * sizeof(Sint16));
+    SDLTest_AssertCheck(ret == 2 * num_samples * sizeof(Sint16), "Expected to get the rest back, got %d bytes.", ret);
+    SDLTest_AssertCheck(result.releases == 2 && result.released[1] == buffers[2], "Expected the last buffer to be released once it was read.");
+    for (i = 0; i < 3 * num_samples; ++i) {
+        mismatches += (output[i] != (Sint16)i);
+    }
+    SDLTest_AssertCheck(mismatches == 0, "Expected the data to come back out in order; %d samples didn't.", mismatches);
+
+    /* Clearing the stream releases buffers that weren't read */
+    ret = SDL_PutAudioStreamDataNoCopy(stream, buffers[0], num_samples * sizeof(Sint16), audio_noCopyRelease, &result);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_PutAudioStreamDataNoCopy to succeed.");
+    SDL_ClearAudioStream(stream);
+    SDLTest_AssertCheck(result.releases == 3 && result.released[2] == buffers[0], "Expected SDL_ClearAudioStream to release the buffer.");
+
+    /* So does destroying it */
+    ret = SDL_PutAudioStreamDataNoCopy(stream, buffers[1], num_samples * sizeof(Sint16), audio_noCopyRelease, &result);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_PutAudioStreamDataNoCopy to succeed.");
+    SDL_DestroyAudioStream(stream);
+    stream = NULL;
+    SDLTest_AssertCheck(result.releases == 4 && result.released[3] == buffers[1], "Expected SDL_DestroyAudioStream to release the buffer.");
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    SDL_DestroyAudioStream(stream);
+    for (i = 0; i < SDL_arraysize(buffers); ++i) {
+        SDL_free(buffers[i]);
+    }
+    SDL_free(output);
+
+    return status;
+}
+
+/**
+ * Check that a stream reuses the memory for queued data, and reports it in its properties.
+ *
+ * \sa SDL_GetAudioStreamProperties
+ */
+static int audio_chunkPool(void *arg)
+{
+    const SDL_AudioSpec spec = { SDL_AUDIO_S16, 2, 22050 };
+    const int block_size = 8192;
+    Uint8 *block;
+    SDL_AudioStream *stream;
+    SDL_PropertiesID props;
+    Sint64 allocations = 0;
+    int failures = 0;
+    int status = TEST_ABORTED;
+    int i;
+
+    block = (Uint8 *)SDL_calloc(1, block_size);
+    stream = SDL_CreateAudioStream(&spec, &spec);
+    SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed.");
+    SDLTest_AssertCheck(block != NULL, "Expected buffer to be created.");
+    if (!stream || !block) {
+        goto cleanup;
+    }
+
+    /* After the first few blocks, putting and getting a steady amount shouldn't need any more memory */
+    for (i = 0; i < 100; ++i) {
+        failures += (SDL_PutAudioStreamData(stream, block, block_size) != 0);
+        failures += (SDL_GetAudioStreamData(stream, block, block_size) != block_size);
+        if (i == 9) {
+            props = SDL_GetAudioStreamProperties(stream);
+            allocations = SDL_GetNumberProperty(props, SDL_PROP_AUDIOSTREAM_CHUNK_POOL_ALLOCATIONS_NUMBER, -1);
+        }
+    }
+    SDLTest_AssertCheck(failures == 0, "Expected every put and get to succeed; %d failed.", failures);
+
+    props = SDL_GetAudioStreamProperties(stream);
+    SDLTest_AssertCheck(allocations > 0, "Expected some chunks to be allocated at first, got %" SDL_PRIs64 ".", allocations);
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_AUDIOSTREAM_CHUNK_POOL_ALLOCATIONS_NUMBER, -1) == allocations,
+                        "Expected no more chunks to be allocated after warming up.");
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_AUDIOSTREAM_CHUNK_POOL_REUSES_NUMBER, -1) > 0, "Expected chunks to be reused.");
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_AUDIOSTREAM_CHUNK_POOL_POOLED_BYTES_NUMBER, -1) > 0, "Expected chunks to be pooled.");
+
+    /* Without a pool, read chunks go straight back to the heap */
+    SDL_SetNumberProperty(props, SDL_PROP_AUDIOSTREAM_CHUNK_POOL_MAX_BYTES_NUMBER, 0);
+    failures += (SDL_PutAudioStreamData(stream, block, block_size) != 0);
+    failures += (SDL_GetAudioStreamData(stream, block, block_size) != block_size);
+    SDLTest_AssertCheck(failures == 0, "Expected put and get to succeed without a pool.");
+    props = SDL_GetAudioStreamProperties(stream);
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_AUDIOSTREAM_CHUNK_POOL_POOLED_BYTES_NUMBER, -1) == 0, "Expected nothing to be pooled.");
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_AUDIOSTREAM_CHUNK_POOL_FREES_NUMBER, -1) > 0, "Expected chunks to be freed.");
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    SDL_DestroyAudioStream(stream);
+    SDL_free(block);
+
+    return status;
+}
+
+/**
+ * Check the performance counters on audio devices and streams.
+ *
+ * \sa SDL_GetAudioDeviceProperties
+ * \sa SDL_GetAudioStreamProperties
+ */
+static int audio_deviceStats(void *arg)
+{
+    const SDL_AudioSpec spec = { SDL_AUDIO_F32, 2, 48000 };
+    const int data_size = 4096 * 2 * sizeof(float);
+    float *data = (float *)SDL_calloc(1, data_size);
+    SDL_AudioStream *stream = NULL;
+    SDL_AudioDeviceID devid = 0;
+    SDL_PropertiesID props;
+    Sint64 iterations = 0, underruns = 0, total, min_value, avg_value, max_value;
+    char name[128];
+    int status = TEST_ABORTED;
+    int ret, i;
+
+    SDLTest_AssertCheck(SDL_GetAudioDeviceProperties(0) == 0, "Expected SDL_GetAudioDeviceProperties(0) to fail.");
+
+    stream = SDL_CreateAudioStream(&spec, NULL);
+    SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed.");
+    SDLTest_AssertCheck(data != NULL, "Expected buffer to be created.");
+    if (!stream || !data) {
+        goto cleanup;
+    }
+
+    devid = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_OUTPUT, NULL);
+    SDLTest_AssertCheck(devid != 0, "Expected SDL_OpenAudioDevice to succeed.");
+    if (!devid) {
+        goto cleanup;
+    }
+
+    ret = SDL_BindAudioStream(devid, stream);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_BindAudioStream to succeed.");
+    ret = SDL_PutAudioStreamData(stream, data, data_size);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_PutAudioStreamData to succeed.");
+    if (ret != 0) {
+        goto cleanup;
+    }
+
+    /* Let the device thread play everything, and then run dry for a while */
+    for (i = 0; i < 200; ++i) {
+        props = SDL_GetAudioDeviceProperties(devid);
+        iterations = SDL_GetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_STATS_ITERATIONS_NUMBER, 0);
+        underruns = SDL_GetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_STATS_UNDERRUNS_NUMBER, 0);
+        if (iterations >= 4 && underruns >= 2 && SDL_GetAudioStreamAvailable(stream) == 0) {
+            break;
+        }
+        SDL_Delay(10);
+    }
+    SDLTest_AssertCheck(iterations >= 4, "Expected the device thread to iterate, got %" SDL_PRIs64 " iterations.", iterations);
+    SDLTest_AssertCheck(underruns >= 2, "Expected the device to run out of data, got %" SDL_PRIs64 " underruns.", underruns);
+
+    /* Read the stream's counters before the device's, since the device thread keeps going */
+    props = SDL_GetAudioStreamProperties(stream);
+    total = SDL_GetNumberProperty(props, SDL_PROP_AUDIOSTREAM_STATS_BYTES_CONVERTED_NUMBER, -1);
+    SDLTest_AssertCheck(total > 0, "Expected the stream to have converted some data, got %" SDL_PRIs64 " bytes.", total);
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_AUDIOSTREAM_STATS_UNDERRUNS_NUMBER, -1) > 0, "Expected the stream to have underrun.");
+
+    props = SDL_GetAudioDeviceProperties(devid);
+    SDLTest_AssertCheck(props != 0, "Expected SDL_GetAudioDeviceProperties to succeed.");
+    iterations = SDL_GetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_STATS_ITERATIONS_NUMBER, 0);
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_STATS_BYTES_CONVERTED_NUMBER, -1) >= total,
+                        "Expected the device to have pulled everything the stream converted.");
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_STATS_STREAMS_MAX_NUMBER, -1) >= 1, "Expected a stream to be mixed.");
+
+    min_value = SDL_GetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_STATS_ITERATE_TIME_MIN_NUMBER, -1);
+    avg_value = SDL_GetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_STATS_ITERATE_TIME_AVG_NUMBER, -1);
+    max_value = SDL_GetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_STATS_ITERATE_TIME_MAX_NUMBER, -1);
+    SDLTest_AssertCheck(min_value >= 0 && min_value <= avg_value && avg_value <= max_value,
+                        "Expected iterate times to be ordered: min %" SDL_PRIs64 ", avg %" SDL_PRIs64 ", max %" SDL_PRIs64 ".", min_value, avg_value, max_value);
+
+    min_value = SDL_GetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_STATS_WAIT_TIME_MIN_NUMBER, -1);
+    avg_value = SDL_GetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_STATS_WAIT_TIME_AVG_NUMBER, -1);
+    max_value = SDL_GetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_STATS_WAIT_TIME_MAX_NUMBER, -1);
+    SDLTest_AssertCheck(max_value > 0 && min_value <= avg_value && avg_value <= max_value,
+                        "Expected wait times to be ordered: min %" SDL_PRIs64 ", avg %" SDL_PRIs64 ", max %" SDL_PRIs64 ".", min_value, avg_value, max_value);
+
+    /* Every iteration lands in exactly one histogram bucket */
+    total = 0;
+    for (i = 0; i < 16; ++i) {
+        SDL_snprintf(name, sizeof(name), "%s%d", SDL_PROP_AUDIO_DEVICE_STATS_ITERATE_TIME_HISTOGRAM_PREFIX, i);
+        total += SDL_GetNumberProperty(props, name, -1);
+    }
+    SDLTest_AssertCheck(total == iterations, "Expected the histogram to add up to %" SDL_PRIs64 " iterations, got %" SDL_PRIs64 ".", iterations, total);
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    SDL_CloseAudioDevice(devid);
+    SDL_DestroyAudioStream(stream);
+    SDL_free(data);
+
+    return status;
+}
+
+/**
+ * Check the pacing of the dummy driver, in real time and as fast as possible.
+ *
+ * \sa SDL_HINT_AUDIO_DUMMY_TIMESCALE
+ * \sa SDL_GetAudioDeviceProperties
+ */
+static int audio_dummyTimescale(void *arg)
+{
+    static const char *timescales[] = { "1", "0" };
+    const char *driver = SDL_GetCurrentAudioDriver();
+    int status = TEST_ABORTED;
+    int i;
+
+    if (!driver || SDL_strcmp(driver, "dummy") != 0) {
+        SDLTest_Log("Skipping, this needs the dummy audio driver.");
+        return TEST_SKIPPED;
+    }
+
+    for (i = 0; i < (int)SDL_arraysize(timescales); ++i) {
+        SDL_AudioDeviceID devid;
+        SDL_AudioSpec spec;
+        SDL_PropertiesID props;
+        Uint64 start, elapsed;
+        Sint64 frames, expected;
+        float ratio;
+        int ret;
+
+        /* The timescale is read when the physical device opens, and the test harness holds it open */
+        while (SDL_WasInit(SDL_INIT_AUDIO)) {
+            SDL_QuitSubSystem(SDL_INIT_AUDIO);
+        }
+        SDL_SetHint(SDL_HINT_AUDIO_DUMMY_TIMESCALE, timescales[i]);
+        ret = SDL_InitSubSystem(SDL_INIT_AUDIO);
+        SDLTest_AssertCheck(ret == 0, "Expected SDL_InitSubSystem(SDL_INIT_AUDIO) to succeed.");
+        start = SDL_GetTicksNS();
+        devid = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_OUTPUT, NULL);
+        SDL_ResetHint(SDL_HINT_AUDIO_DUMMY_TIMESCALE);
+        SDLTest_AssertCheck(devid != 0, "Expected SDL_OpenAudioDevice to succeed with timescale %s.", timescales[i]);
+        if (!devid) {
+            goto cleanup;
+        }
+        ret = SDL_GetAudioDeviceFormat(devid, &spec, NULL);
+        SDLTest_AssertCheck(ret == 0, "Expected SDL_GetAudioDeviceFormat to succeed.");
+
+        SDL_Delay(500);
+
+        props = SDL_GetAudioDeviceProperties(devid);
+        elapsed = SDL_GetTicksNS() - start;
+        frames = SDL_GetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_STATS_FRAMES_NUMBER, -1);
+        ratio = SDL_GetFloatProperty(props, SDL_PROP_AUDIO_DEVICE_STATS_REALTIME_RATIO_FLOAT, -1.0f);
+        expected = (Sint64)((elapsed * spec.freq) / SDL_NS_PER_SECOND);
+        SDLTest_Log("Timescale %s: %" SDL_PRIs64 " frames in %d ms, realtime ratio %f, %" SDL_PRIs64 " overruns", timescales[i], frames,
+                    (int)SDL_NS_TO_MS(elapsed), ratio, SDL_GetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_STATS_OVERRUNS_NUMBER, -1));
+
+        if (i == 0) {
+            /* Generous limits, this might run on a busy machine */
+            SDLTest_AssertCheck(frames > expected / 2 && frames < expected * 3 / 2, "Expected about %" SDL_PRIs64 " frames, got %" SDL_PRIs64 ".", expected, frames);
+            SDLTest_AssertCheck(ratio > 0.5f && ratio < 1.5f, "Expected a realtime ratio near 1, got %f.", ratio);
+        } else {
+            SDLTest_AssertCheck(frames > expected * 2, "Expected more than %" SDL_PRIs64 " frames, got %" SDL_PRIs64 ".", expected * 2, frames);
+            SDLTest_AssertCheck(ratio > 2.0f, "Expected a realtime ratio above 2, got %f.", ratio);
+            SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_STATS_OVERRUNS_NUMBER, -1) == 0, "Expected no overruns without pacing.");
+        }
+
+        SDL_CloseAudioDevice(devid);
+    }
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    SDL_ResetHint(SDL_HINT_AUDIO_DUMMY_TIMESCALE);
+
+    return status;
+}
+
+/**
+ * Check remixing a stream's channels with a custom matrix.
+ *
+ * \sa SDL_SetAudioStreamChannelMatrix
+ */
+static int audio_channelMatrix(void *arg)
+{
+    /* Each output channel of the 6 -> 2 mix uses a different weight for each input channel */
+    static const float swap_matrix[2 * 2] = {
+        0.0f, 1.0f,
+        1.0f, 0.0f
+    };
+    static const float downmix_matrix[2 * 6] = {
+        0.5f, 0.0f, 0.25f, 0.125f, 0.0625f, 0.0f,
+        0.0f, 0.5f, 0.25f, 0.125f, 0.0f, 0.0625f
+    };
+    const int num_frames = 1000;
+    SDL_AudioSpec spec1, spec2;
+    SDL_AudioStream *stream = NULL;
+    float *src = NULL;
+    float *dst = NULL;
+    int status = TEST_ABORTED;
+    int ret, i, j, k, freq;
+    float expected;
+    SDL_bool matches;
+
+    src = (float *)SDL_malloc(num_frames * 6 * sizeof(float));
+    dst = (float *)SDL_malloc(num_frames * 6 * sizeof(float));
+    if (!src || !dst) {
+        goto cleanup;
+    }
+    for (i = 0; i < num_frames * 6; ++i) {
+        src[i] = (float)((i * 37) % 101) / 101.0f - 0.5f;
+    }
+
+    ret = SDL_SetAudioStreamChannelMatrix(NULL, 2, 2, swap_matrix);
+    SDLTest_AssertCheck(ret < 0, "Expected SDL_SetAudioStreamChannelMatrix to fail without a stream.");
+
+    spec1.format = SDL_AUDIO_F32;
+    spec1.channels = 2;
+    spec1.freq = 48000;
+    stream = SDL_CreateAudioStream(&spec1, &spec1);
+    SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed.");
+    if (!stream) {
+        goto cleanup;
+    }
+
+    ret = SDL_SetAudioStreamChannelMatrix(stream, 0, 2, swap_matrix);
+    SDLTest_AssertCheck(ret < 0, "Expected SDL_SetAudioStreamChannelMatrix to reject 0 input channels.");
+    ret = SDL_SetAudioStreamChannelMatrix(stream, 2, 9, swap_matrix);
+    SDLTest_AssertCheck(ret < 0, "Expected SDL_SetAudioStreamChannelMatrix to reject 9 output channels.");
+
+    /* Swap left and right, even though the channel counts match */
+    ret = SDL_SetAudioStreamChannelMatrix(stream, 2, 2, swap_matrix);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_SetAudioStreamChannelMatrix to succeed.");
+    ret = SDL_PutAudioStreamData(stream, src, num_frames * 2 * sizeof(float));
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_PutAudioStreamData to succeed.");
+    ret = SDL_GetAudioStreamData(stream, dst, num_frames * 2 * sizeof(float));
+    SDLTest_AssertCheck(ret == num_frames * 2 * sizeof(float), "Expected %d bytes, got %d.", (int)(num_frames * 2 * sizeof(float)), ret);
+    matches = SDL_TRUE;
+    for (i = 0; i < num_frames; ++i) {
+        if (dst[i * 2] != src[i * 2 + 1] || dst[i * 2 + 1] != src[i * 2]) {
+            matches = SDL_FALSE;
+            break;
+        }
+    }
+    SDLTest_AssertCheck(matches, "Expected the left and right channels to be swapped.");
+
+    /* Going back to the default matrix makes this a straight copy again */
+    ret = SDL_SetAudioStreamChannelMatrix(stream, 2, 2, NULL);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_SetAudioStreamChannelMatrix to succeed with a NULL matrix.");
+    ret = SDL_PutAudioStreamData(stream, src, num_frames * 2 * sizeof(float));
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_PutAudioStreamData to succeed.");
+    ret = SDL_GetAudioStreamData(stream, dst, num_frames * 2 * sizeof(float));
+    SDLTest_AssertCheck(ret == num_frames * 2 * sizeof(float), "Expected %d bytes, got %d.", (int)(num_frames * 2 * sizeof(float)), ret);
+    SDLTest_AssertCheck(SDL_memcmp(dst, src, num_frames * 2 * sizeof(float)) == 0, "Expected the data to be unchanged.");
+
+    /* A custom 5.1 to stereo mix, with and without resampling */
+    for (freq = 48000; freq >= 24000; freq /= 2) {
+        spec1.channels = 6;
+        spec2.format = SDL_AUDIO_F32;
+        spec2.channels = 2;
+        spec2.freq = freq;
+        ret = SDL_SetAudioStreamFormat(stream, &spec1, &spec2);
+        SDLTest_AssertCheck(ret == 0, "Expected SDL_SetAudioStreamFormat to succeed.");
+        ret = SDL_SetAudioStreamChannelMatrix(stream, 6, 2, downmix_matrix);
+        SDLTest_AssertCheck(ret == 0, "Expected SDL_SetAudioStreamChannelMatrix to succeed.");
+
+        /* A constant signal comes out of the resampler unchanged, so the expected output is easy to compute */
+        for (i = 0; i < num_frames; ++i) {
+            for (k = 0; k < 6; ++k) {
+                src[i * 6 + k] = (freq == spec1.freq) ? (float)(((i + k) * 37) % 101) / 101.0f - 0.5f : 0.1f * (float)(k + 1);
+            }
+        }
+        ret = SDL_PutAudioStreamData(stream, src, num_frames * 6 * sizeof(float));
+        SDLTest_AssertCheck(ret == 0, "Expected SDL_PutAudioStreamData to succeed.");
+        ret = SDL_FlushAudioStream(stream);
+        SDLTest_AssertCheck(ret == 0, "Expected SDL_FlushAudioStream to succeed.");
+
+        /* Skip the edges when resampling, where the filter runs off the end of the data */
+        ret = SDL_GetAudioStreamData(stream, dst, num_frames * 2 * sizeof(float)) / (2 * sizeof(float));
+        SDLTest_AssertCheck(ret > num_frames * freq / spec1.freq / 2, "Expected %d frames, got %d.", num_frames * freq / spec1.freq, ret);
+        matches = SDL_TRUE;
+        for (i = (freq == spec1.freq) ? 0 : 50; i < ret - ((freq == spec1.freq) ? 0 : 50); ++i) {
+            for (j = 0; j < 2; ++j) {
+                const float *frame = &src[((freq == spec1.freq) ? i : 0) * 6];
+                expected = 0.0f;
+                for (k = 0; k < 6; ++k) {
+                    expected += frame[k] * downmix_matrix[j * 6 + k];
+                }
+                if (SDL_fabsf(dst[i * 2 + j] - expected) > 0.0001f) {
+                    SDLTest_AssertCheck(SDL_FALSE, "Expected %f at frame %d channel %d, got %f.", expected, i, j, dst[i * 2 + j]);
+                    matches = SDL_FALSE;
+                    break;
+                }
+            }
+            if (!matches) {
+                break;
+            }
+        }
+        SDLTest_AssertCheck(matches, "Expected the stream to use the custom matrix at %d Hz.", freq);
+        SDL_ClearAudioStream(stream);
+    }
+
+    /* The matrix is ignored when the input doesn't have the same number of channels */
+    spec1.channels = 1;
+    ret = SDL_SetAudioStreamFormat(stream, &spec1, &spec1);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_SetAudioStreamFormat to succeed.");
+    ret = SDL_PutAudioStreamData(stream, src, num_frames * sizeof(float));
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_PutAudioStreamData to succeed.");
+    ret = SDL_GetAudioStreamData(stream, dst, num_frames * sizeof(float));
+    SDLTest_AssertCheck(ret == num_frames * sizeof(float), "Expected %d bytes, got %d.", (int)(num_frames * sizeof(float)), ret);
+    SDLTest_AssertCheck(SDL_memcmp(dst, src, num_frames * sizeof(float)) == 0, "Expected the data to be unchanged.");
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    SDL_DestroyAudioStream(stream);
+    SDL_free(src);
+    SDL_free(dst);
+
+    return status;
+}
+
+static void audio_putLE16(Uint8 **p, Uint16 v)
+{
+    (*p)[0] = (Uint8)v;
+    (*p)[1] = (Uint8)(v >> 8);
+    *p += 2;
+}
+
+static void audio_putLE32(Uint8 **p, Uint32 v)
+{
+    audio_putLE16(p, (Uint16)v);
+    audio_putLE16(p, (Uint16)(v >> 16));
+}
+
+/* Builds a WAVE file in memory, with pseudo-random audio data */
+static Uint8 *audio_makeWAV(Uint16 formattag, Uint16 channels, Uint16 bitspersample, Uint16 blockalign,
+                            const Uint16 *fmtext, Uint16 fmtextcount, Uint32 datalen, size_t *wavlen)
+{
+    const Uint32 fmtlen = 16 + (fmtextcount ? 2 + fmtextcount * 2 : 0);
+    const Uint32 rifflen = 4 + 8 + fmtlen + 8 + datalen + (datalen & 1);
+    Uint8 *wav = (Uint8 *)SDL_calloc(1, 8 + rifflen);
+    Uint8 *p = wav;
+    Uint32 seed = 12345;
+    Uint32 i;
+
+    if (!wav) {
+        return NULL;
+    }
+
+    audio_putLE32(&p, 0x46464952); /* "RIFF" */
+    audio_putLE32(&p, rifflen);
+    audio_putLE32(&p, 0x45564157); /* "WAVE" */
+    audio_putLE32(&p, 0x20746D66); /* "fmt " */
+    audio_putLE32(&p, fmtlen);
+    audio_putLE16(&p, formattag);
+    audio_putLE16(&p, channels);
+    audio_putLE32(&p, 22050);
+    audio_putLE32(&p, 22050 * blockalign);
+    audio_putLE16(&p, blockalign);
+    audio_putLE16(&p, bitspersample);
+    if (fmtextcount) {
+        audio_putLE16(&p, fmtextcount * 2);
+        for (i = 0; i < fmtextcount; i++) {
+            audio_putLE16(&p, fmtext[i]);
+        }
+    }
+    audio_putLE32(&p, 0x61746164); /* "data" */
+    audio_putLE32(&p, datalen);
+    for (i = 0; i < datalen; i++) {
+        seed = seed * 1103515245 + 12345;
+        p[i] = (Uint8)(seed >> 16);
+    }
+
+    /* Keep the ADPCM block headers valid */
+    if (formattag == 0x0002 || formattag == 0x0011) {
+        for (i = 0; i < datalen; i += blockalign) {
+            Uint32 c;
+            for (c = 0; c < channels; c++) {
+                if (formattag == 0x0002) {
+                    p[i + c] = (Uint8)(c % 7); /* coefficient index */
+                } else {
+                    p[i + c * 4 + 2] = (Uint8)((i / blockalign + c) % 89); /* step index */
+                    p[i + c * 4 + 3] = 0;
+                }
+            }
+        }
+    }
+
+    *wavlen = 8 + rifflen;
+    return wav;
+}
+
+/**
+ * Check decoding WAVE files through an audio stream, a block at a time.
+ *
+ * \sa SDL_OpenWAVStream_IO
+ * \sa SDL_LoadWAV_IO
+ */
+static int audio_wavStream(void *arg)
+{
+    static const Uint16 ms_adpcm_ext[] = { 244, 7, 256, 0, 512, 0xff00, 0, 0, 192, 64, 240, 0, 460, 0xff30, 392, 0xff18 };
+    static const Uint16 ima_adpcm_ext[] = { 249 };
+    static const struct
+    {
+        const char *name;
+        Uint16 formattag;
+        Uint16 channels;
+        Uint16 bitspersample;
+        Uint16 blockalign;
+        const Uint16 *fmtext;
+        Uint16 fmtextcount;
+        Uint32 datalen;
+    } files[] = {
+        { "16-bit PCM", 0x0001, 2, 16, 4, NULL, 0, 300000 },
+        { "24-bit PCM", 0x0001, 1, 24, 3, NULL, 0, 300000 },
+        { "mu-law", 0x0007, 2, 8, 2, NULL, 0, 200001 },
+        { "MS ADPCM", 0x0002, 2, 4, 256, ms_adpcm_ext, SDL_arraysize(ms_adpcm_ext), 100000 },
+        { "IMA ADPCM", 0x0011, 2, 4, 256, ima_adpcm_ext, SDL_arraysize(ima_adpcm_ext), 100000 }
+    };
+    static const Uint8 not_a_wav[64] = { 0 };
+    SDL_AudioStream *stream = NULL;
+    Uint8 *wav = NULL;
+    Uint8 *expected = NULL;
+    Uint8 *buf = NULL;
+    Uint32 expected_len = 0;
+    SDL_AudioSpec spec1, spec2;
+    size_t wavlen;
+    int status = TEST_ABORTED;
+    int i, ret, total, chunk_size;
+
+    stream = SDL_OpenWAVStream_IO(SDL_IOFromConstMem(not_a_wav, sizeof(not_a_wav)), SDL_TRUE, &spec1);
+    SDLTest_AssertCheck(stream == NULL, "Expected SDL_OpenWAVStream_IO to fail on something that isn't a WAVE file.");
+
+    for (i = 0; i < (int)SDL_arraysize(files); ++i) {
+        SDLTest_Log("Testing %s", files[i].name);
+
+        wav = audio_makeWAV(files[i].formattag, files[i].channels, files[i].bitspersample, files[i].blockalign,
+                            files[i].fmtext, files[i].fmtextcount, files[i].datalen, &wavlen);
+        if (!wav) {
+            goto cleanup;
+        }
+
+        ret = SDL_LoadWAV_IO(SDL_IOFromConstMem(wav, wavlen), SDL_TRUE, &spec1, &expected, &expected_len);
+        SDLTest_AssertCheck(ret == 0, "Expected SDL_LoadWAV_IO to succeed, got: %s", ret == 0 ? "success" : SDL_GetError());
+        if (ret != 0) {
+            goto cleanup;
+        }
+
+        stream = SDL_OpenWAVStream_IO(SDL_IOFromConstMem(wav, wavlen), SDL_TRUE, &spec2);
+        SDLTest_AssertCheck(stream != NULL, "Expected SDL_OpenWAVStream_IO to succeed, got: %s", stream ? "success" : SDL_GetError());
+        if (!stream) {
+            goto cleanup;
+        }
+        SDLTest_AssertCheck(spec1.format == spec2.format && spec1.channels == spec2.channels && spec1.freq == spec2.freq,
+                            "Expected the same format as SDL_LoadWAV_IO.");
+        SDLTest_AssertCheck(SDL_GetAudioStreamAvailable(stream) == 0, "Expected nothing to be decoded before it's needed.");
+
+        buf = (Uint8 *)SDL_malloc(expected_len + 4096);
+        if (!buf) {
+            goto cleanup;
+        }
+
+        /* Read a little at a time, and make sure the decoder doesn't get far ahead */
+        chunk_size = SDL_AUDIO_FRAMESIZE(spec2) * 1000;
+        total = 0;
+        while (total <= (int)expected_len) {
+            ret = SDL_GetAudioStreamData(stream, buf + total, chunk_size);
+            if (ret <= 0) {
+                break;
+            }
+            if (total == 0) {
+                SDLTest_AssertCheck(SDL_GetAudioStreamAvailable(stream) < (int)expected_len / 2,
+                                    "Expected only a few blocks to be decoded, got %d of %d bytes.",
+                                    ret + SDL_GetAudioStreamAvailable(stream), (int)expected_len);
+            }
+            total += ret;
+        }
+        SDLTest_AssertCheck(ret == 0, "Expected the stream to end cleanly.");
+        SDLTest_AssertCheck(total == (int)expected_len, "Expected %d bytes, got %d.", (int)expected_len, total);
+        SDLTest_AssertCheck(total == (int)expected_len && SDL_memcmp(buf, expected, expected_len) == 0,
+                            "Expected the same data as SDL_LoadWAV_IO.");
+
+        SDL_DestroyAudioStream(stream);
+        stream = NULL;
+        SDL_free(buf);
+        buf = NULL;
+        SDL_free(expected);
+        expected = NULL;
+        SDL_free(wav);
+        wav = NULL;
+    }
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    SDL_DestroyAudioStream(stream);
+    SDL_free(buf);
+    SDL_free(expected);
+    SDL_free(wav);
+
+    return status;
+}
+
+/**
+ * Check loading WAVE files without copying the audio data.
+ *
+ * \sa SDL_LoadWAVMapped_IO
+ * \sa SDL_LoadWAVMapped
+ * \sa SDL_FreeMappedWAV
+ */
+static int audio_wavMapped(void *arg)
+{
+    const char *filename = "wavmapped.wav";
+    SDL_IOStream *io = NULL;
+    Uint8 *wav = NULL;
+    Uint8 *expected = NULL;
+    Uint8 *mapped = NULL;
+    Uint32 expected_len = 0;
+    Uint32 mapped_len = 0;
+    SDL_AudioSpec spec1, spec2;
+    size_t wavlen;
+    int status = TEST_ABORTED;
+    int ret;
+
+    /* Memory streams give out a pointer into their memory */
+    wav = audio_makeWAV(0x0001, 2, 16, 4, NULL, 0, 40000, &wavlen);
+    if (!wav) {
+        goto cleanup;
+    }
+    ret = SDL_LoadWAV_IO(SDL_IOFromConstMem(wav, wavlen), SDL_TRUE, &spec1, &expected, &expected_len);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_LoadWAV_IO to succeed.");
+    ret = SDL_LoadWAVMapped_IO(SDL_IOFromConstMem(wav, wavlen), SDL_TRUE, &spec2, &mapped, &mapped_len);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_LoadWAVMapped_IO to succeed, got: %s", ret == 0 ? "success" : SDL_GetError());
+    if (ret != 0 || !expected) {
+        goto cleanup;
+    }
+    SDLTest_AssertCheck(mapped == wav + 44, "Expected the audio data to point into the memory stream.");
+    SDLTest_AssertCheck(spec1.format == spec2.format && spec1.channels == spec2.channels && spec1.freq == spec2.freq,
+                        "Expected the same format as SDL_LoadWAV_IO.");
+    SDLTest_AssertCheck(mapped_len == expected_len && SDL_memcmp(mapped, expected, expected_len) == 0,
+                        "Expected the same data as SDL_LoadWAV_IO.");
+    SDL_FreeMappedWAV(mapped);
+    mapped = NULL;
+    SDL_free(expected);
+    expected = NULL;
+
+    /* Files get mapped, and the mapping outlives the file being closed and removed */
+    io = SDL_IOFromFile(filename, "wb");
+    SDLTest_AssertCheck(io != NULL, "Expected SDL_IOFromFile to succeed.");
+    if (!io) {
+        goto cleanup;
+    }
+    SDLTest_AssertCheck(SDL_WriteIO(io, wav, wavlen) == wavlen, "Expected SDL_WriteIO to succeed.");
+    SDL_CloseIO(io);
+    ret = SDL_LoadWAV(filename, &spec1, &expected, &expected_len);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_LoadWAV to succeed.");
+    ret = SDL_LoadWAVMapped(filename, &spec2, &mapped, &mapped_len);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_LoadWAVMapped to succeed, got: %s", ret == 0 ? "success" : SDL_GetError());
+    (void)remove(filename);
+    if (ret != 0 || !expected) {
+        goto cleanup;
+    }
+    SDLTest_AssertCheck(mapped_len == expected_len && SDL_memcmp(mapped, expected, expected_len) == 0,
+                        "Expected the same data as SDL_LoadWAV.");
+    SDL_FreeMappedWAV(mapped);
+    mapped = NULL;
+    SDL_free(expected);
+    expected = NULL;
+
+    /* A truncated data chunk only uses what's there */
+    ret = SDL_LoadWAV_IO(SDL_IOFromConstMem(wav, wavlen - 1001), SDL_TRUE, &spec1, &expected, &expected_len);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_LoadWAV_IO to succeed.");
+    ret = SDL_LoadWAVMapped_IO(SDL_IOFromConstMem(wav, wavlen - 1001), SDL_TRUE, &spec2, &mapped, &mapped_len);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_LoadWAVMapped_IO to succeed.");
+    if (ret != 0 || !expected) {
+        goto cleanup;
+    }
+    SDLTest_AssertCheck(mapped_len == expected_len && mapped_len == 40000 - 1004 && SDL_memcmp(mapped, expected, expected_len) == 0,
+                        "Expected %d bytes, got %d.", (int)expected_len, (int)mapped_len);
+    SDL_FreeMappedWAV(mapped);
+    mapped = NULL;
+    SDL_free(expected);
+    expected = NULL;
+    SDL_free(wav);
+
+    /* Formats that need decoding are loaded the regular way */
+    wav = audio_makeWAV(0x0001, 1, 24, 3, NULL, 0, 30000, &wavlen);
+    if (!wav) {
+        goto cleanup;
+    }
+    ret = SDL_LoadWAV_IO(SDL_IOFromConstMem(wav, wavlen), SDL_TRUE, &spec1, &expected, &expected_len);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_LoadWAV_IO to succeed.");
+    ret = SDL_LoadWAVMapped_IO(SDL_IOFromConstMem(wav, wavlen), SDL_TRUE, &spec2, &mapped, &mapped_len);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_LoadWAVMapped_IO to succeed.");
+    if (ret != 0 || !expected) {
+        goto cleanup;
+    }
+    SDLTest_AssertCheck(mapped < wav || mapped >= wav + wavlen, "Expected 24-bit data to be decoded into a new buffer.");
+    SDLTest_AssertCheck(mapped_len == expected_len && SDL_memcmp(mapped, expected, expected_len) == 0,
+                        "Expected the same data as SDL_LoadWAV_IO.");
+
+    SDL_FreeMappedWAV(NULL);
+    SDLTest_AssertPass("Call to SDL_FreeMappedWAV(NULL)");
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    SDL_FreeMappedWAV(mapped);
+    SDL_free(expected);
+    SDL_free(wav);
+
+    return status;
+}
+
+/**
+ * Check decoding ADPCM WAVE files with several threads.
+ *
+ * \sa SDL_LoadWAV_IO
+ * \sa SDL_OpenWAVStream_IO
+ */
+static int audio_wavADPCMThreads(void *arg)
+{
+    static const Uint16 ms_mono_ext[] = { 500, 7, 256, 0, 512, 0xff00, 0, 0, 192, 64, 240, 0, 460, 0xff30, 392, 0xff18 };
+    static const Uint16 ms_stereo_ext[] = { 244, 7, 256, 0, 512, 0xff00, 0, 0, 192, 64, 240, 0, 460, 0xff30, 392, 0xff18 };
+    static const Uint16 ima_mono_ext[] = { 505 };
+    static const Uint16 ima_stereo_ext[] = { 249 };
+    static const Uint16 ima_3ch_ext[] = { 161 };
+    static const Uint16 ima_4ch_ext[] = { 121 };
+    static const struct
+    {
+        const char *name;
+        Uint16 formattag;
+        Uint16 channels;
+        const Uint16 *fmtext;
+        Uint16 fmtextcount;
+    } files[] = {
+        { "MS ADPCM mono", 0x0002, 1, ms_mono_ext, SDL_arraysize(ms_mono_ext) },
+        { "MS ADPCM stereo", 0x0002, 2, ms_stereo_ext, SDL_arraysize(ms_stereo_ext) },
+        { "IMA ADPCM mono", 0x0011, 1, ima_mono_ext, SDL_arraysize(ima_mono_ext) },
+        { "IMA ADPCM stereo", 0x0011, 2, ima_stereo_ext, SDL_arraysize(ima_stereo_ext) },
+        { "IMA ADPCM 3 channels", 0x0011, 3, ima_3ch_ext, SDL_arraysize(ima_3ch_ext) },
+        { "IMA ADPCM 4 channels", 0x0011, 4, ima_4ch_ext, SDL_arraysize(ima_4ch_ext) }
+    };
+    static const char *thread_counts[] = { "1", "3", "16" };
+    const Uint16 blockalign = 256;
+    /* Enough blocks to split, and a truncated one at the end */
+    const Uint32 datalen = blockalign * 101 + 100;
+    SDL_AudioStream *stream = NULL;
+    Uint8 *wav = NULL;
+    Uint8 *expected = NULL;
+    Uint8 *decoded = NULL;
+    Uint32 decoded_len = 0;
+    SDL_AudioSpec spec;
+    size_t wavlen;
+    int status = TEST_ABORTED;
+    int i, j, ret, total;
+
+    for (i = 0; i < (int)SDL_arraysize(files); ++i) {
+        SDLTest_Log("Testing %s", files[i].name);
+
+        wav = audio_makeWAV(files[i].formattag, files[i].channels, 4, blockalign,
+                            files[i].fmtext, files[i].fmtextcount, datalen, &wavlen);
+        if (!wav) {
+            goto cleanup;
+        }
+
+        /* The stream decodes one block at a time on this thread, which makes a good reference */
+        stream = SDL_OpenWAVStream_IO(SDL_IOFromConstMem(wav, wavlen), SDL_TRUE, &spec);
+        SDLTest_AssertCheck(stream != NULL, "Expected SDL_OpenWAVStream_IO to succeed, got: %s", stream ? "success" : SDL_GetError());
+        expected = (Uint8 *)SDL_malloc(datalen * 4 + 4096);
+        if (!stream || !expected) {
+            goto cleanup;
+        }
+        total = 0;
+        while ((ret = SDL_GetAudioStreamData(stream, expected + total, 4096)) > 0) {
+            total += ret;
+        }
+        SDL_DestroyAudioStream(stream);
+        stream = NULL;
+        SDLTest_AssertCheck(total > 0, "Expected the stream to decode something.");
+
+        for (j = 0; j < (int)SDL_arraysize(thread_counts); ++j) {
+            SDL_SetHint(SDL_HINT_WAVE_DECODE_THREADS, thread_counts[j]);
+            ret = SDL_LoadWAV_IO(SDL_IOFromConstMem(wav, wavlen), SDL_TRUE, &spec, &decoded, &decoded_len);
+            SDL_ResetHint(SDL_HINT_WAVE_DECODE_THREADS);
+            SDLTest_AssertCheck(ret == 0, "Expected SDL_LoadWAV_IO to succeed with %s threads, got: %s", thread_counts[j], ret == 0 ? "success" : SDL_GetError());
+            if (ret != 0) {
+                goto cleanup;
+            }
+            SDLTest_AssertCheck(decoded_len == (Uint32)total && SDL_memcmp(decoded, expected, total) == 0,
+                                "Expected the same data as the stream with %s threads.", thread_counts[j]);
+            SDL_free(decoded);
+            decoded = NULL;
+        }
+
+        /* A broken block in the middle still fails the whole file */
+        if (files[i].formattag == 0x0002) {
+            wav[wavlen - datalen + blockalign * 60] = 100;
+            for (j = 0; j < (int)SDL_arraysize(thread_counts); ++j) {
+                SDL_SetHint(SDL_HINT_WAVE_DECODE_THREADS, thread_counts[j]);
+                ret = SDL_LoadWAV_IO(SDL_IOFromConstMem(wav, wavlen), SDL_TRUE, &spec, &decoded, &decoded_len);
+                SDL_ResetHint(SDL_HINT_WAVE_DECODE_THREADS);
+                SDLTest_AssertCheck(ret == -1, "Expected SDL_LoadWAV_IO to fail with %s threads.", thread_counts[j]);
+                if (ret == 0) {
+                    SDL_free(decoded);
+                    decoded = NULL;
+                } else {
+                    SDLTest_AssertCheck(SDL_strstr(SDL_GetError(), "coefficient index") != NULL,
+                                        "Expected an error about the coefficient index, got: %s", SDL_GetError());
+                }
+            }
+        }
+
+        SDL_free(expected);
+        expected = NULL;
+        SDL_free(wav);
+        wav = NULL;
+    }
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    SDL_ResetHint(SDL_HINT_WAVE_DECODE_THREADS);
+    SDL_DestroyAudioStream(stream);
+    SDL_free(decoded);
+    SDL_free(expected);
+    SDL_free(wav);
+
+    return status;
+}
+
+static void SDLCALL batch_put_callback(void *userdata, SDL_AudioStream *stream, int additional_amount, int total_amount)
+{
+    int *count = (int *)userdata;
+    *count += 1;
+}
+
+/**
+ * Check putting and getting data on several streams with one call.
+ *
+ * \sa SDL_PutAudioStreamDataBatch
+ * \sa SDL_GetAudioStreamDataBatch
+ */
+static int audio_streamBatch(void *arg)
+{
+    const SDL_AudioSpec src_spec = { SDL_AUDIO_S16, 2, 44100 };
+    const SDL_AudioSpec dst_spec = { SDL_AUDIO_F32, 2, 48000 };
+    const int num_frames = 1000;
+    const int out_size = 8192;
+    SDL_AudioStream *batched[3] = { NULL, NULL, NULL };
+    SDL_AudioStream *single[3] = { NULL, NULL, NULL };
+    SDL_AudioStreamBuffer buffers[6];
+    Sint16 *input = NULL;
+    Uint8 *batched_out = NULL;
+    Uint8 *single_out = NULL;
+    int status = TEST_ABORTED;
+    int callbacks = 0;
+    int ret;
+    int i;
+
+    input = (Sint16 *)SDL_malloc(num_frames * 2 * sizeof(Sint16));
+    batched_out = (Uint8 *)SDL_calloc(3, out_size);
+    single_out = (Uint8 *)SDL_calloc(3, out_size);
+    SDLTest_AssertCheck(input && batched_out && single_out, "Expected the buffers to be allocated.");
+    if (!input || !batched_out || !single_out) {
+        goto cleanup;
+    }
+    for (i = 0; i < num_frames * 2; ++i) {
+        input[i] = (Sint16)(SDLTest_RandomSint16());
+    }
+
+    for (i = 0; i < 3; ++i) {
+        batched[i] = SDL_CreateAudioStream(&src_spec, &dst_spec);
+        single[i] = SDL_CreateAudioStream(&src_spec, &dst_spec);
+        SDLTest_AssertCheck(batched[i] && single[i], "Expected SDL_CreateAudioStream to succeed.");
+        if (!batched[i] || !single[i]) {
+            goto cleanup;
+        }
+    }
+    SDL_SetAudioStreamPutCallback(batched[0], batch_put_callback, &callbacks);
+
+    /* Two runs of entries for the first and last streams, and a partial frame for the middle one */
+    buffers[0].stream = batched[0], buffers[0].buf = input, buffers[0].len = 400 * 4;
+    buffers[1].stream = batched[0], buffers[1].buf = input + 400 * 2, buffers[1].len = 600 * 4;
+    buffers[2].stream = batched[1], buffers[2].buf = input, buffers[2].len = 3;
+    buffers[3].stream = batched[1], buffers[3].buf = input, buffers[3].len = num_frames * 4;
+    buffers[4].stream = batched[2], buffers[4].buf = input, buffers[4].len = 0;
+    buffers[5].stream = batched[2], buffers[5].buf = input + 10 * 2, buffers[5].len = 500 * 4;
+    for (i = 0; i < (int)SDL_arraysize(buffers); ++i) {
+        buffers[i].result = 12345;
+    }
+    ret = SDL_PutAudioStreamDataBatch(buffers, SDL_arraysize(buffers));
+    SDLTest_AssertCheck(ret == -1, "Expected SDL_PutAudioStreamDataBatch to report the partial frame, got %d.", ret);
+    SDLTest_AssertCheck(buffers[2].result == -1, "Expected the partial frame entry to fail, got %d.", buffers[2].result);
+    for (i = 0; i < (int)SDL_arraysize(buffers); ++i) {
+        if (i != 2) {
+            SDLTest_AssertCheck(buffers[i].result == 0, "Expected entry %d to succeed, got %d.", i, buffers[i].result);
+        }
+    }
+    SDLTest_AssertCheck(callbacks == 1, "Expected one put callback for the first stream, got %d.", callbacks);
+
+    SDL_PutAudioStreamData(single[0], input, num_frames * 4);
+    SDL_PutAudioStreamData(single[1], input, num_frames * 4);
+    SDL_PutAudioStreamData(single[2], input + 10 * 2, 500 * 4);
+
+    for (i = 0; i < 3; ++i) {
+        SDL_FlushAudioStream(batched[i]);
+        SDL_FlushAudioStream(single[i]);
+        SDLTest_AssertCheck(SDL_GetAudioStreamAvailable(batched[i]) == SDL_GetAudioStreamAvailable(single[i]),
+                            "Expected stream %d to have the same amount of data available.", i);
+    }
+
+    /* Read each stream in two pieces */
+    for (i = 0; i < 3; ++i) {
+        buffers[i * 2].stream = batched[i], buffers[i * 2].buf = batched_out + i * out_size, buffers[i * 2].len = 1001;
+        buffers[i * 2 + 1].stream = batched[i], buffers[i * 2 + 1].buf = batched_out + i * out_size + 1000, buffers[i * 2 + 1].len = out_size - 1000;
+    }
+    ret = SDL_GetAudioStreamDataBatch(buffers, SDL_arraysize(buffers));
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_GetAudioStreamDataBatch to succeed, got %d.", ret);
+    for (i = 0; i < 3; ++i) {
+        const int expected = SDL_GetAudioStreamData(single[i], single_out + i * out_size, out_size);
+        const int total = buffers[i * 2].result + buffers[i * 2 + 1].result;
+        SDLTest_AssertCheck(buffers[i * 2].result == 1000, "Expected the first read of stream %d to stop at a whole frame, got %d.", i, buffers[i * 2].result);
+        SDLTest_AssertCheck(total == expected, "Expected stream %d to give %d bytes, got %d.", i, expected, total);
+        SDLTest_AssertCheck(SDL_memcmp(batched_out + i * out_size, single_out + i * out_size, expected) == 0,
+                            "Expected stream %d to give the same data as separate calls.", i);
+    }
+
+    /* Bad entries fail on their own */
+    buffers[0].stream = NULL, buffers[0].buf = batched_out, buffers[0].len = 16;
+    buffers[1].stream = batched[0], buffers[1].buf = NULL, buffers[1].len = 16;
+    buffers[2].stream = batched[0], buffers[2].buf = batched_out, buffers[2].len = 16;
+    ret = SDL_GetAudioStreamDataBatch(buffers, 3);
+    SDLTest_AssertCheck(ret == -1, "Expected SDL_GetAudioStreamDataBatch to fail, got %d.", ret);
+    SDLTest_AssertCheck(buffers[0].result == -1 && buffers[1].result == -1, "Expected the bad entries to fail.");
+    SDLTest_AssertCheck(buffers[2].result >= 0, "Expected the good entry to succeed, got %d.", buffers[2].result);
+    ret = SDL_PutAudioStreamDataBatch(NULL, 1);
+    SDLTest_AssertCheck(ret == -1, "Expected SDL_PutAudioStreamDataBatch(NULL, 1) to fail, got %d.", ret);
+    ret = SDL_GetAudioStreamDataBatch(NULL, 0);
+    SDLTest_AssertCheck(ret == 0, "Expected an empty batch to succeed, got %d.", ret);
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    for (i = 0; i < 3; ++i) {
+        SDL_DestroyAudioStream(batched[i]);
+        SDL_DestroyAudioStream(single[i]);
+    }
+    SDL_free(single_out);
+    SDL_free(batched_out);
+    SDL_free(input);
+
+    return status;
+}
+
+/**
+ * Check that converting a stream's data ahead of time gives the same output.
+ *
+ * \sa SDL_PROP_AUDIOSTREAM_LOOKAHEAD_BYTES_NUMBER
+ * \sa SDL_GetAudioStreamProperties
+ */
+static int audio_streamLookahead(void *arg)
+{
+    const SDL_AudioSpec src_spec = { SDL_AUDIO_S16, 1, 22050 };
+    SDL_AudioSpec dst_spec = { SDL_AUDIO_F32, 2, 48000 };
+    const int num_frames = 2000;
+    const int num_puts = 4;
+    const int read_size = 4000;
+    const int out_size = 256 * 1024;
+    SDL_AudioStream *lookahead = NULL;
+    SDL_AudioStream *plain = NULL;
+    Sint16 *input = NULL;
+    Uint8 *lookahead_out = NULL;
+    Uint8 *plain_out = NULL;
+    int lookahead_total = 0;
+    int plain_total = 0;
+    int status = TEST_ABORTED;
+    int ret;
+    int i, j;
+
+    input = (Sint16 *)SDL_malloc(num_frames * sizeof(Sint16));
+    lookahead_out = (Uint8 *)SDL_malloc(out_size);
+    plain_out = (Uint8 *)SDL_malloc(out_size);
+    SDLTest_AssertCheck(input && lookahead_out && plain_out, "Expected the buffers to be allocated.");
+    if (!input || !lookahead_out || !plain_out) {
+        goto cleanup;
+    }
+
+    lookahead = SDL_CreateAudioStream(&src_spec, &dst_spec);
+    plain = SDL_CreateAudioStream(&src_spec, &dst_spec);
+    SDLTest_AssertCheck(lookahead && plain, "Expected SDL_CreateAudioStream to succeed.");
+    if (!lookahead || !plain) {
+        goto cleanup;
+    }
+    ret = SDL_SetNumberProperty(SDL_GetAudioStreamProperties(lookahead), SDL_PROP_AUDIOSTREAM_LOOKAHEAD_BYTES_NUMBER, 16384);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_SetNumberProperty to succeed.");
+
+    for (i = 0; i < num_puts; ++i) {
+        Sint64 ready = 0;
+
+        for (j = 0; j < num_frames; ++j) {
+            input[j] = SDLTest_RandomSint16();
+        }
+        ret = SDL_PutAudioStreamData(lookahead, input, num_frames * sizeof(Sint16));
+        SDLTest_AssertCheck(ret == 0, "Expected SDL_PutAudioStreamData to succeed.");
+        ret = SDL_PutAudioStreamData(plain, input, num_frames * sizeof(Sint16));
+        SDLTest_AssertCheck(ret == 0, "Expected SDL_PutAudioStreamData to succeed.");
+
+        /* Give the worker a chance to run */
+        for (j = 0; (j < 100) && (ready == 0); ++j) {
+            SDL_Delay(10);
+            ready = SDL_GetNumberProperty(SDL_GetAudioStreamProperties(lookahead), SDL_PROP_AUDIOSTREAM_STATS_LOOKAHEAD_BYTES_NUMBER, -1);
+        }
+        SDLTest_AssertCheck(ready > 0, "Expected data to be converted ahead of time, got %" SDL_PRIs64 " bytes.", ready);
+        SDLTest_AssertCheck(SDL_GetAudioStreamAvailable(lookahead) == SDL_GetAudioStreamAvailable(plain), "Expected both streams to have the same amount of data available.");
+
+        if (i == num_puts / 2) {
+            /* Data that's already converted has to follow a change of output format */
+            dst_spec.format = SDL_AUDIO_S16;
+            SDL_SetAudioStreamFormat(lookahead, NULL, &dst_spec);
+            SDL_SetAudioStreamFormat(plain, NULL, &dst_spec);
+        }
+
+        ret = SDL_GetAudioStreamData(lookahead, lookahead_out + lookahead_total, read_size);
+        SDLTest_AssertCheck(ret == read_size, "Expected to read %d bytes, got %d.", read_size, ret);
+        lookahead_total += SDL_max(ret, 0);
+        ret = SDL_GetAudioStreamData(plain, plain_out + plain_total, read_size);
+        SDLTest_AssertCheck(ret == read_size, "Expected to read %d bytes, got %d.", read_size, ret);
+        plain_total += SDL_max(ret, 0);
+    }
+
+    SDL_FlushAudioStream(lookahead);
+    SDL_FlushAudioStream(plain);
+    ret = SDL_GetAudioStreamData(lookahead, lookahead_out + lookahead_total, out_size - lookahead_total);
+    lookahead_total += SDL_max(ret, 0);
+    ret = SDL_GetAudioStreamData(plain, plain_out + plain_total, out_size - plain_total);
+    plain_total += SDL_max(ret, 0);
+
+    SDLTest_AssertCheck(lookahead_total == plain_total, "Expected the same amount of output, got %d and %d bytes.", lookahead_total, plain_total);
+    SDLTest_AssertCheck(SDL_memcmp(lookahead_out, plain_out, SDL_min(lookahead_total, plain_total)) == 0, "Expected the same output with and without look-ahead.");
+
+    /* Clearing the stream throws away what was converted, too */
+    SDL_PutAudioStreamData(lookahead, input, num_frames * sizeof(Sint16));
+    SDL_Delay(50);
+    SDL_ClearAudioStream(lookahead);
+    ret = SDL_GetAudioStreamAvailable(lookahead);
+    SDLTest_AssertCheck(ret == 0, "Expected nothing available after SDL_ClearAudioStream, got %d.", ret);
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    SDL_DestroyAudioStream(lookahead);
+    SDL_DestroyAudioStream(plain);
+    SDL_free(plain_out);
+    SDL_free(lookahead_out);
+    SDL_free(input);
+
+    return status;
+}
+
+/**
+ * Check that the dummy driver shrinks its buffer while it plays smoothly.
+ *
+ * \sa SDL_HINT_AUDIO_DEVICE_ADAPTIVE_SAMPLE_FRAMES
+ * \sa SDL_GetAudioDeviceFormat
+ */
+static int audio_adaptiveSampleFrames(void *arg)
+{
+    const char *driver = SDL_GetCurrentAudioDriver();
+    SDL_AudioDeviceID devid = 0;
+    SDL_AudioSpec spec;
+    int opened_frames = 0;
+    int sample_frames = 0;
+    Sint64 resizes;
+    int status = TEST_ABORTED;
+    int ret;
+
+    if (!driver || SDL_strcmp(driver, "dummy") != 0) {
+        SDLTest_Log("Skipping, this needs the dummy audio driver.");
+        return TEST_SKIPPED;
+    }
+
+    /* The hints are read when the physical device opens, and the test harness holds it open */
+    while (SDL_WasInit(SDL_INIT_AUDIO)) {
+        SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    }
+    SDL_SetHint(SDL_HINT_AUDIO_DEVICE_ADAPTIVE_SAMPLE_FRAMES, "1");
+    SDL_SetHint(SDL_HINT_AUDIO_DEVICE_MIN_SAMPLE_FRAMES, "128");
+    ret = SDL_InitSubSystem(SDL_INIT_AUDIO);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_InitSubSystem(SDL_INIT_AUDIO) to succeed.");
+    devid = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_OUTPUT, NULL);
+    SDLTest_AssertCheck(devid != 0, "Expected SDL_OpenAudioDevice to succeed.");
+    if (!devid) {
+        goto cleanup;
+    }
+    ret = SDL_GetAudioDeviceFormat(devid, &spec, &opened_frames);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_GetAudioDeviceFormat to succeed.");
+
+    SDL_Delay(2000);
+
+    ret = SDL_GetAudioDeviceFormat(devid, &spec, &sample_frames);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_GetAudioDeviceFormat to succeed.");
+    resizes = SDL_GetNumberProperty(SDL_GetAudioDeviceProperties(devid), SDL_PROP_AUDIO_DEVICE_STATS_BUFFER_RESIZES_NUMBER, -1);
+    SDLTest_Log("Opened with %d sample frames, now using %d after %" SDL_PRIs64 " resizes", opened_frames, sample_frames, resizes);
+    SDLTest_AssertCheck(resizes > 0, "Expected the buffer size to change, got %" SDL_PRIs64 " resizes.", resizes);
+    /* It might have grown back on a busy machine, but never past what it opened with */
+    SDLTest_AssertCheck(sample_frames >= 128 && sample_frames <= opened_frames, "Expected between 128 and %d sample frames, got %d.", opened_frames, sample_frames);
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    SDL_CloseAudioDevice(devid);
+    SDL_ResetHint(SDL_HINT_AUDIO_DEVICE_ADAPTIVE_SAMPLE_FRAMES);
+    SDL_ResetHint(SDL_HINT_AUDIO_DEVICE_MIN_SAMPLE_FRAMES);
+
+    return status;
+}
+
+typedef struct
+{
+    SDL_AudioDeviceID devid;
+    Sint64 first_frame;
+    Sint64 last_frame;
+    int wrong_samples;
+    float value;
+} audio_scheduleResult;
+
+static void SDLCALL audio_schedulePostmix(void *userdata, const SDL_AudioSpec *spec, float *buffer, int buflen)
+{
+    audio_scheduleResult *result = (audio_scheduleResult *)userdata;
+    const int num_frames = buflen / (int)(sizeof(float) * spec->channels);
+    const Sint64 position = SDL_GetAudioDevicePosition(result->devid); /* this buffer starts here */
+    int i, j;
+
+    for (i = 0; i < num_frames; ++i) {
+        const float sample = buffer[i * spec->channels];
+        if (sample != 0.0f) {
+            if (result->first_frame < 0) {
+                result->first_frame = position + i;
+            }
+            result->last_frame = position + i;
+            for (j = 0; j < spec->channels; ++j) {
+                result->wrong_samples += (buffer[i * spec->channels + j] != result->value);
+            }
+        }
+    }
+}
+
+/**
+ * Check that a scheduled stream starts and stops at exact device frames.
+ *
+ * \sa SDL_SetAudioStreamSchedule
+ * \sa SDL_GetAudioDevicePosition
+ */
+static int audio_streamSchedule(void *arg)
+{
+    const int num_frames = 8192;
+    const float value = 0.5f;
+    audio_scheduleResult result;
+    SDL_AudioStream *stream = NULL;
+    SDL_AudioDeviceID devid = 0;
+    SDL_AudioSpec spec;
+    float *data = NULL;
+    Sint64 position, start, stop;
+    int sample_frames;
+    int status = TEST_ABORTED;
+    int ret;
+    int i;
+
+    SDL_zero(result);
+    result.first_frame = -1;
+    result.last_frame = -1;
+    result.value = value;
+
+    stream = SDL_CreateAudioStream(NULL, NULL);
+    SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed.");
+    if (!stream) {
+        goto cleanup;
+    }
+    SDLTest_AssertCheck(SDL_SetAudioStreamSchedule(stream, 100, 50) < 0, "Expected a stop before the start to be rejected.");
+    SDLTest_AssertCheck(SDL_SetAudioStreamSchedule(stream, -2, -1) < 0, "Expected a negative start to be rejected.");
+    SDLTest_AssertCheck(SDL_SetAudioStreamSchedule(NULL, -1, -1) < 0, "Expected SDL_SetAudioStreamSchedule(NULL) to fail.");
+
+    devid = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_OUTPUT, NULL);
+    SDLTest_AssertCheck(devid != 0, "Expected SDL_OpenAudioDevice to succeed.");
+    if (!devid) {
+        goto cleanup;
+    }
+    result.devid = devid;
+    ret = SDL_GetAudioDeviceFormat(devid, &spec, &sample_frames);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_GetAudioDeviceFormat to succeed.");
+    if (ret != 0) {
+        goto cleanup;
+    }
+    spec.format = SDL_AUDIO_F32;
+
+    data = (float *)SDL_malloc(num_frames * spec.channels * sizeof(float));
+    SDLTest_AssertCheck(data != NULL, "Expected the buffer to be allocated.");
+    if (!data) {
+        goto cleanup;
+    }
+    for (i = 0; i < num_frames * spec.channels; ++i) {
+        data[i] = value;
+    }
+
+    /* Start and stop in the middle of device buffers, a few buffers from now */
+    position = SDL_GetAudioDevicePosition(devid);
+    SDLTest_AssertCheck(position >= 0, "Expected SDL_GetAudioDevicePosition to succeed, got %" SDL_PRIs64 ".", position);
+    start = position + (sample_frames * 4) + (sample_frames / 3);
+    stop = start + (sample_frames * 2) + 17;
+    ret = SDL_SetAudioStreamSchedule(stream, start, stop);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_SetAudioStreamSchedule to succeed.");
+
+    SDL_SetAudioStreamFormat(stream, &spec, &spec);
+    SDL_PutAudioStreamData(stream, data, num_frames * spec.channels * sizeof(float));
+    SDL_SetAudioPostmixCallback(devid, audio_schedulePostmix, &result);
+    ret = SDL_BindAudioStream(devid, stream);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_BindAudioStream to succeed.");
+    if (ret != 0) {
+        goto cleanup;
+    }
+
+    for (i = 0; (i < 500) && (SDL_GetAudioDevicePosition(devid) < stop + sample_frames); ++i) {
+        SDL_Delay(10);
+    }
+    SDL_SetAudioPostmixCallback(devid, NULL, NULL);
+
+    SDLTest_AssertCheck(result.first_frame == start, "Expected the stream to start at frame %" SDL_PRIs64 ", got %" SDL_PRIs64 ".", start, result.first_frame);
+    SDLTest_AssertCheck(result.last_frame == stop - 1, "Expected the stream to stop before frame %" SDL_PRIs64 ", got %" SDL_PRIs64 ".", stop, result.last_frame + 1);
+    SDLTest_AssertCheck(result.wrong_samples == 0, "Expected every played sample to be %f, %d weren't.", value, result.wrong_samples);
+    /* Binding may have changed the output side to the device's own format */
+    SDL_GetAudioStreamFormat(stream, NULL, &spec);
+    ret = SDL_GetAudioStreamAvailable(stream) / SDL_AUDIO_FRAMESIZE(spec);
+    SDLTest_AssertCheck(ret == num_frames - (int)(stop - start), "Expected the rest of the data to stay in the stream, got %d frames.", ret);
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    SDL_CloseAudioDevice(devid);
+    SDL_DestroyAudioStream(stream);
+    SDL_free(data);
+
+    return status;
+}
+
+/**
+ * Check 24-bit WAVE expansion and byte order conversion against simple per-sample reference versions.
+ *
+ * \sa SDL_LoadWAV_IO
+ * \sa SDL_ConvertAudioSamples
+ */
+static int audio_unpackAndByteswap(void *arg)
+{
+    static const int lengths[] = { 1, 3, 7, 8, 15, 16, 17, 31, 33, 64, 100, 1001 };
+    static const SDL_AudioFormat formats[] = { SDL_AUDIO_S16LE, SDL_AUDIO_S16BE, SDL_AUDIO_S32LE, SDL_AUDIO_S32BE, SDL_AUDIO_F32LE, SDL_AUDIO_F32BE };
+    const Uint32 num_frames = 1237;
+    const Uint32 datalen = num_frames * 2 * 3;
+    SDL_AudioSpec spec1, spec2;
+    Uint8 *wav = NULL;
+    Uint8 *audio_buf = NULL;
+    Uint8 *src = NULL;
+    Uint8 *dst = NULL;
+    Uint32 audio_len = 0;
+    size_t wavlen;
+    int status = TEST_ABORTED;
+    int i, j, k, ret, dst_len;
+    int mismatches;
+
+    /* Stereo 24-bit PCM, with an odd number of samples so a partial block is left over */
+    wav = audio_makeWAV(0x0001, 2, 24, 6, NULL, 0, datalen, &wavlen);
+    if (!wav) {
+        goto cleanup;
+    }
+    ret = SDL_LoadWAV_IO(SDL_IOFromConstMem(wav, wavlen), SDL_TRUE, &spec1, &audio_buf, &audio_len);
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_LoadWAV_IO to succeed, got: %s", ret == 0 ? "success" : SDL_GetError());
+    if (ret != 0) {
+        goto cleanup;
+    }
+    SDLTest_AssertCheck(spec1.format == SDL_AUDIO_S32LE, "Expected 24-bit samples to load as SDL_AUDIO_S32LE.");
+    SDLTest_AssertCheck(audio_len == num_frames * 2 * 4, "Expected %d bytes, got %d.", (int)(num_frames * 2 * 4), (int)audio_len);
+    if (audio_len != num_frames * 2 * 4) {
+        goto cleanup;
+    }
+    mismatches = 0;
+    for (i = 0; i < (int)(num_frames * 2); i++) {
+        const Uint8 *in = wav + 44 + i * 3; /* the data chunk starts right after a plain 16 byte fmt chunk */
+        const Uint8 *out = audio_buf + i * 4;
+        mismatches += (out[0] != 0 || out[1] != in[0] || out[2] != in[1] || out[3] != in[2]);
+    }
+    SDLTest_AssertCheck(mismatches == 0, "Expected every 24-bit sample to be shifted into the top of 32 bits, %d weren't.", mismatches);
+
+    /* Byte order conversion, at sizes that end in the middle of a SIMD block */
+    src = (Uint8 *)SDL_malloc(1001 * 4);
+    if (!src) {
+        goto cleanup;
+    }
+    for (i = 0; i < 1001 * 4; i++) {
+        src[i] = (Uint8)(i * 7 + 3);
+    }
+    for (i = 0; i < (int)SDL_arraysize(formats); i++) {
+        spec1.format = formats[i];
+        spec1.channels = 1;
+        spec1.freq = 22050;
+        spec2 = spec1;
+        spec2.format = formats[i] ^ SDL_AUDIO_MASK_BIG_ENDIAN;
+
+        for (j = 0; j < (int)SDL_arraysize(lengths); j++) {
+            const int bytes = SDL_AUDIO_BYTESIZE(spec1.format);
+            const int len = lengths[j] * bytes;
+
+            ret = SDL_ConvertAudioSamples(&spec1, src, len, &spec2, &dst, &dst_len);
+            SDLTest_AssertCheck(ret == 0, "Expected SDL_ConvertAudioSamples to succeed.");
+            if (ret != 0) {
+                goto cleanup;
+            }
+            mismatches = (dst_len == len) ? 0 : -1;
+            for (k = 0; (k < len) && (mismatches >= 0); k++) {
+                mismatches += (dst[k] != src[(k - (k % bytes)) + (bytes - 1 - (k % bytes))]);
+            }
+            SDLTest_AssertCheck(mismatches == 0, "Expected %d byteswapped %d-bit samples, got %d bytes and %d mismatches.",
+                                lengths[j], bytes * 8, dst_len, mismatches);
+            SDL_free(dst);
+            dst = NULL;
+        }
+    }
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    SDL_free(dst);
+    SDL_free(src);
+    SDL_free(audio_buf);
+    SDL_free(wav);
+
+    return status;
+}
+
 /* ================= Test Case References ================== */
 
 /* Audio test cases */
@@ -1342,12 +3640,95 @@ static const SDLTest_TestCaseReference audioTest18 = {
     audio_formatChange, "audio_formatChange", "Check handling of format changes.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference audioTest19 = {
+    audio_mixAudioFormat, "audio_mixAudioFormat", "Check saturation and volume scaling of audio mixing.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest20 = {
+    audio_convertConformance, "audio_convertConformance", "Check that audio format conversion matches the scalar converters exactly.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest21 = {
+    audio_resampleBlocks, "audio_resampleBlocks", "Check that block-wise resampling matches resampling the whole buffer.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest22 = {
+    audio_resampleQuality, "audio_resampleQuality", "Check each of the resampler quality levels.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest23 = {
+    audio_mixThreads, "audio_mixThreads", "Check mixing bound streams with worker threads.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest24 = {
+    audio_gainAndPan, "audio_gainAndPan", "Check applying gain and pan to bound streams.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest25 = {
+    audio_spscStream, "audio_spscStream", "Check putting and getting data on different threads with an SPSC stream.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest26 = {
+    audio_putNoCopy, "audio_putNoCopy", "Check putting data into a stream without copying it.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest27 = {
+    audio_chunkPool, "audio_chunkPool", "Check reusing the memory for queued data.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest28 = {
+    audio_deviceStats, "audio_deviceStats", "Check the performance counters on audio devices and streams.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest29 = {
+    audio_channelMatrix, "audio_channelMatrix", "Check remixing channels with a custom matrix.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest30 = {
+    audio_wavStream, "audio_wavStream", "Check decoding WAVE files through an audio stream.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest31 = {
+    audio_wavMapped, "audio_wavMapped", "Check loading WAVE files without copying the audio data.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest32 = {
+    audio_wavADPCMThreads, "audio_wavADPCMThreads", "Check decoding ADPCM WAVE files with several threads.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest33 = {
+    audio_dummyTimescale, "audio_dummyTimescale", "Check the pacing of the dummy driver.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest34 = {
+    audio_streamBatch, "audio_streamBatch", "Check putting and getting data on several streams with one call.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest35 = {
+    audio_streamLookahead, "audio_streamLookahead", "Check converting a stream's data ahead of time.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest36 = {
+    audio_adaptiveSampleFrames, "audio_adaptiveSampleFrames", "Check adapting the device buffer size while playing.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest37 = {
+    audio_streamSchedule, "audio_streamSchedule", "Check starting and stopping a stream at exact device frames.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest38 = {
+    audio_unpackAndByteswap, "audio_unpackAndByteswap", "Check 24-bit WAVE expansion and byteswapping against reference versions.", TEST_ENABLED
+};
+
 /* Sequence of Audio test cases */
 static const SDLTest_TestCaseReference *audioTests[] = {
     &audioTest1, &audioTest2, &audioTest3, &audioTest4, &audioTest5, &audioTest6,
     &audioTest7, &audioTest8, &audioTest9, &audioTest10, &audioTest11,
     &audioTest12, &audioTest13, &audioTest14, &audioTest15, &audioTest16,
-    &audioTest17, &audioTest18, NULL
+    &audioTest17, &audioTest18, &audioTest19, &audioTest20, &audioTest21, &audioTest22, &audioTest23,
+    &audioTest24, &audioTest25, &audioTest26, &audioTest27, &audioTest28, &audioTest29, &audioTest30, &audioTest31,
+    &audioTest32, &audioTest33, &audioTest34, &audioTest35,
+    &audioTest36, &audioTest37, &audioTest38, NULL
 };
 
 /* Audio test suite (global) */
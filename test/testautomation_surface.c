@@ -855,6 +855,645 @@ static int surface_testFlip(void *arg)
 }
 
 
+/* Blends one pixel the way BlitNtoNPixelAlpha and BlitNtoNSurfaceAlpha do, with a division by 255 */
+static Uint32 blendReference8888(Uint32 s, Uint32 d, const SDL_PixelFormat *sf, const SDL_PixelFormat *df, int surface_alpha)
+{
+    const int sR = (s >> sf->Rshift) & 0xFF, sG = (s >> sf->Gshift) & 0xFF, sB = (s >> sf->Bshift) & 0xFF;
+    const int sA = (surface_alpha >= 0) ? surface_alpha : (int)((s >> sf->Ashift) & 0xFF);
+    int dR = (d >> df->Rshift) & 0xFF, dG = (d >> df->Gshift) & 0xFF, dB = (d >> df->Bshift) & 0xFF;
+    int dA = df->Amask ? (int)((d >> df->Ashift) & 0xFF) : 255;
+
+    if (sA == 0) {
+        return d;
+    }
+    dR = (((sR - dR) * sA) / 255) + dR;
+    dG = (((sG - dG) * sA) / 255) + dG;
+    dB = (((sB - dB) * sA) / 255) + dB;
+    dA = sA + dA - (sA * dA) / 255;
+    return ((Uint32)dR << df->Rshift) | ((Uint32)dG << df->Gshift) | ((Uint32)dB << df->Bshift) | (df->Amask ? ((Uint32)dA << df->Ashift) : 0);
+}
+
+/**
+ * Tests alpha blending between all the 8888 formats against a per-pixel reference.
+ */
+static int surface_testBlitAlpha8888(void *arg)
+{
+    static const SDL_PixelFormatEnum alpha_formats[] = {
+        SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGRA8888
+    };
+    static const SDL_PixelFormatEnum opaque_formats[] = {
+        SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_RGBX8888, SDL_PIXELFORMAT_BGRX8888
+    };
+    static const int alpha_mods[] = { -1, 1, 128, 200, 255 };
+    const int w = 37, h = 3;
+    SDL_Rect rect = { 1, 1, 37, 3 };
+    SDL_Surface *src = NULL, *dst = NULL, *orig = NULL;
+    int i, j, k, m, x, y;
+    int worst = 0, failures = 0;
+
+    /* Only the SSE4.1 and AVX2 blitters are exact for every pair, the other fast paths shift by 8 instead of dividing by 255 */
+    if (!SDL_HasSSE41() && !SDL_HasAVX2()) {
+        SDLTest_Log("Skipping, the SSE4.1 and AVX2 alpha blitters aren't available");
+        return TEST_SKIPPED;
+    }
+
+    for (i = 0; i < (int)SDL_arraysize(alpha_mods); i++) {
+        const int surface_alpha = alpha_mods[i];
+        const SDL_PixelFormatEnum *src_formats = (surface_alpha < 0) ? alpha_formats : opaque_formats;
+
+        for (j = 0; j < 4; j++) {
+            for (k = 0; k < 8; k++) {
+                const SDL_PixelFormatEnum dst_format = (k < 4) ? alpha_formats[k] : opaque_formats[k - 4];
+
+                src = SDL_CreateSurface(w, h, src_formats[j]);
+                dst = SDL_CreateSurface(w + 2, h + 2, dst_format);
+                SDLTest_AssertCheck(src && dst, "Verify surfaces were created");
+                if (!src || !dst) {
+                    goto done;
+                }
+                for (y = 0; y < h; y++) {
+                    Uint32 *row = (Uint32 *)((Uint8 *)src->pixels + y * src->pitch);
+                    for (x = 0; x < w; x++) {
+                        row[x] = SDLTest_RandomUint32();
+                        if (src->format->Amask && (x % 5) < 2) {
+                            /* Plenty of fully transparent and opaque pixels */
+                            row[x] = (x % 5) ? (row[x] | src->format->Amask) : (row[x] & ~src->format->Amask);
+                        }
+                    }
+                }
+                for (y = 0; y < h + 2; y++) {
+                    Uint32 *row = (Uint32 *)((Uint8 *)dst->pixels + y * dst->pitch);
+                    for (x = 0; x < w + 2; x++) {
+                        row[x] = SDLTest_RandomUint32();
+                    }
+                }
+                orig = SDL_DuplicateSurface(dst);
+                if (!orig) {
+                    goto done;
+                }
+
+                CHECK_FUNC(SDL_SetSurfaceBlendMode, (src, SDL_BLENDMODE_BLEND));
+                if (surface_alpha >= 0) {
+                    CHECK_FUNC(SDL_SetSurfaceAlphaMod, (src, (Uint8)surface_alpha));
+                }
+                CHECK_FUNC(SDL_BlitSurface, (src, NULL, dst, &rect));
+
+                for (y = 0; y < h; y++) {
+                    const Uint32 *srow = (const Uint32 *)((const Uint8 *)src->pixels + y * src->pitch);
+                    const Uint32 *orow = (const Uint32 *)((const Uint8 *)orig->pixels + (y + 1) * orig->pitch) + 1;
+                    const Uint32 *drow = (const Uint32 *)((const Uint8 *)dst->pixels + (y + 1) * dst->pitch) + 1;
+                    for (x = 0; x < w; x++) {
+                        const Uint32 expected = blendReference8888(srow[x], orow[x], src->format, dst->format, surface_alpha);
+                        int error = 0;
+                        for (m = 0; m < 32; m += 8) {
+                            error = SDL_max(error, SDL_abs((int)((expected >> m) & 0xFF) - (int)((drow[x] >> m) & 0xFF)));
+                        }
+                        worst = SDL_max(worst, error);
+                        if (error && failures++ == 0) {
+                            SDLTest_LogError("%s -> %s, alpha mod %d: expected 0x%.8" SDL_PRIx32 ", got 0x%.8" SDL_PRIx32,
+                                             SDL_GetPixelFormatName(src_formats[j]), SDL_GetPixelFormatName(dst_format), surface_alpha,
+                                             expected, drow[x]);
+                        }
+                    }
+                }
+                /* Pixels around the blit rectangle must not be touched */
+                SDLTest_AssertCheck(SDL_memcmp(orig->pixels, dst->pixels, dst->pitch) == 0, "Verify the row above the blit is untouched");
+                SDLTest_AssertCheck(SDL_memcmp((Uint8 *)orig->pixels + (h + 1) * orig->pitch, (Uint8 *)dst->pixels + (h + 1) * dst->pitch, dst->pitch) == 0,
+                                    "Verify the row below the blit is untouched");
+
+                SDL_DestroySurface(src);
+                SDL_DestroySurface(dst);
+                SDL_DestroySurface(orig);
+                src = dst = orig = NULL;
+            }
+        }
+    }
+    SDLTest_AssertCheck(failures == 0, "Verify blended pixels match the reference, %d didn't (worst error %d)", failures, worst);
+
+done:
+    SDL_DestroySurface(src);
+    SDL_DestroySurface(dst);
+    SDL_DestroySurface(orig);
+
+    return TEST_COMPLETED;
+}
+
+/* Computes one pixel the way the generated blitters in SDL_blit_auto.c do */
+static Uint32 autoBlitReference(Uint32 s, Uint32 d, const SDL_PixelFormat *sf, const SDL_PixelFormat *df, const SDL_Color *mod, SDL_BlendMode blendMode)
+{
+    int sR = (s >> sf->Rshift) & 0xFF, sG = (s >> sf->Gshift) & 0xFF, sB = (s >> sf->Bshift) & 0xFF;
+    int sA = sf->Amask ? (int)((s >> sf->Ashift) & 0xFF) : 255;
+    int dR = (d >> df->Rshift) & 0xFF, dG = (d >> df->Gshift) & 0xFF, dB = (d >> df->Bshift) & 0xFF;
+    int dA = df->Amask ? (int)((d >> df->Ashift) & 0xFF) : 255;
+
+    sR = (sR * mod->r) / 255;
+    sG = (sG * mod->g) / 255;
+    sB = (sB * mod->b) / 255;
+    sA = (sA * mod->a) / 255;
+    if (blendMode == SDL_BLENDMODE_BLEND || blendMode == SDL_BLENDMODE_ADD) {
+        sR = (sR * sA) / 255;
+        sG = (sG * sA) / 255;
+        sB = (sB * sA) / 255;
+    }
+    switch (blendMode) {
+    case SDL_BLENDMODE_BLEND:
+        dR = sR + ((255 - sA) * dR) / 255;
+        dG = sG + ((255 - sA) * dG) / 255;
+        dB = sB + ((255 - sA) * dB) / 255;
+        dA = sA + ((255 - sA) * dA) / 255;
+        break;
+    case SDL_BLENDMODE_ADD:
+        dR = SDL_min(sR + dR, 255);
+        dG = SDL_min(sG + dG, 255);
+        dB = SDL_min(sB + dB, 255);
+        break;
+    case SDL_BLENDMODE_MOD:
+        dR = (sR * dR) / 255;
+        dG = (sG * dG) / 255;
+        dB = (sB * dB) / 255;
+        break;
+    case SDL_BLENDMODE_MUL:
+        dR = SDL_min(((sR * dR) + (dR * (255 - sA))) / 255, 255);
+        dG = SDL_min(((sG * dG) + (dG * (255 - sA))) / 255, 255);
+        dB = SDL_min(((sB * dB) + (dB * (255 - sA))) / 255, 255);
+        break;
+    default:
+        dR = sR;
+        dG = sG;
+        dB = sB;
+        dA = sA;
+        break;
+    }
+    return ((Uint32)dR << df->Rshift) | ((Uint32)dG << df->Gshift) | ((Uint32)dB << df->Bshift) | (df->Amask ? ((Uint32)dA << df->Ashift) : 0);
+}
+
+/**
+ * Tests the generated modulate, blend and scale blitters against a per-pixel reference.
+ */
+static int surface_testBlitAuto(void *arg)
+{
+    static const SDL_PixelFormatEnum src_formats[] = {
+        SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888,
+        SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGRA8888
+    };
+    static const SDL_PixelFormatEnum dst_formats[] = {
+        SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888
+    };
+    static const SDL_BlendMode blend_modes[] = {
+        SDL_BLENDMODE_NONE, SDL_BLENDMODE_BLEND, SDL_BLENDMODE_ADD, SDL_BLENDMODE_MOD, SDL_BLENDMODE_MUL
+    };
+    static const SDL_Color mods[] = {
+        { 255, 255, 255, 255 }, { 255, 255, 255, 100 }, { 200, 100, 50, 255 }, { 200, 100, 50, 100 }
+    };
+    const int w = 37, h = 3;
+    SDL_Surface *src = NULL, *dst = NULL, *orig = NULL;
+    int i, j, k, m, scaled, x, y;
+    int failures = 0;
+
+    for (i = 0; i < (int)SDL_arraysize(src_formats); i++) {
+        for (j = 0; j < (int)SDL_arraysize(dst_formats); j++) {
+            for (k = 0; k < (int)SDL_arraysize(blend_modes); k++) {
+                for (m = 0; m < (int)SDL_arraysize(mods); m++) {
+                    for (scaled = 0; scaled <= 1; scaled++) {
+                        const SDL_BlendMode blendMode = blend_modes[k];
+                        const SDL_Color *mod = &mods[m];
+                        const SDL_bool color_mod = (mod->r != 255 || mod->g != 255 || mod->b != 255);
+                        SDL_Rect rect = { 1, 1, w, h };
+                        Uint64 incx, incy;
+
+                        /* Only these combinations are routed to the generated blitters */
+                        if (!color_mod && blendMode != SDL_BLENDMODE_ADD && blendMode != SDL_BLENDMODE_MOD && blendMode != SDL_BLENDMODE_MUL &&
+                            (!scaled || (blendMode == SDL_BLENDMODE_NONE && mod->a == 255))) {
+                            continue;
+                        }
+                        if (scaled) {
+                            rect.w = (m & 1) ? 29 : 45;
+                            rect.h = 5;
+                        }
+
+                        src = SDL_CreateSurface(w, h, src_formats[i]);
+                        dst = SDL_CreateSurface(45 + 2, 5 + 2, dst_formats[j]);
+                        SDLTest_AssertCheck(src && dst, "Verify surfaces were created");
+                        if (!src || !dst) {
+                            goto done;
+                        }
+                        for (y = 0; y < h; y++) {
+                            Uint32 *row = (Uint32 *)((Uint8 *)src->pixels + y * src->pitch);
+                            for (x = 0; x < w; x++) {
+                                row[x] = SDLTest_RandomUint32();
+                            }
+                        }
+                        for (y = 0; y < dst->h; y++) {
+                            Uint32 *row = (Uint32 *)((Uint8 *)dst->pixels + y * dst->pitch);
+                            for (x = 0; x < dst->w; x++) {
+                                row[x] = SDLTest_RandomUint32();
+                            }
+                        }
+                        orig = SDL_DuplicateSurface(dst);
+                        if (!orig) {
+                            goto done;
+                        }
+
+                        CHECK_FUNC(SDL_SetSurfaceBlendMode, (src, blendMode));
+                        CHECK_FUNC(SDL_SetSurfaceColorMod, (src, mod->r, mod->g, mod->b));
+                        CHECK_FUNC(SDL_SetSurfaceAlphaMod, (src, mod->a));
+                        if (scaled) {
+                            CHECK_FUNC(SDL_BlitSurfaceScaled, (src, NULL, dst, &rect, SDL_SCALEMODE_NEAREST));
+                        } else {
+                            CHECK_FUNC(SDL_BlitSurface, (src, NULL, dst, &rect));
+                        }
+
+                        incx = ((Uint64)w << 16) / rect.w;
+                        incy = ((Uint64)h << 16) / rect.h;
+                        for (y = 0; y < dst->h; y++) {
+                            const Uint32 *orow = (const Uint32 *)((const Uint8 *)orig->pixels + y * orig->pitch);
+                            const Uint32 *drow = (const Uint32 *)((const Uint8 *)dst->pixels + y * dst->pitch);
+                            for (x = 0; x < dst->w; x++) {
+                                Uint32 expected = orow[x];
+
+                                if (x >= rect.x && x < rect.x + rect.w && y >= rect.y && y < rect.y + rect.h) {
+                                    const int srcx = (int)(((x - rect.x) * incx + incx / 2) >> 16);
+                                    const int srcy = (int)(((y - rect.y) * incy + incy / 2) >> 16);
+                                    const Uint32 s = ((const Uint32 *)((const Uint8 *)src->pixels + srcy * src->pitch))[scaled ? srcx : x - rect.x];
+
+                                    expected = autoBlitReference(s, orow[x], src->format, dst->format, mod, blendMode);
+                                }
+                                if (drow[x] != expected && failures++ == 0) {
+                                    SDLTest_LogError("%s -> %s, blend mode %d, mod %d,%d,%d,%d, %s: expected 0x%.8" SDL_PRIx32 " at %d,%d, got 0x%.8" SDL_PRIx32,
+                                                     SDL_GetPixelFormatName(src_formats[i]), SDL_GetPixelFormatName(dst_formats[j]), (int)blendMode,
+                                                     mod->r, mod->g, mod->b, mod->a, scaled ? "scaled" : "unscaled", expected, x, y, drow[x]);
+                                }
+                            }
+                        }
+
+                        SDL_DestroySurface(src);
+                        SDL_DestroySurface(dst);
+                        SDL_DestroySurface(orig);
+                        src = dst = orig = NULL;
+                    }
+                }
+            }
+        }
+    }
+    SDLTest_AssertCheck(failures == 0, "Verify blitted pixels match the reference, %d didn't", failures);
+
+done:
+    SDL_DestroySurface(src);
+    SDL_DestroySurface(dst);
+    SDL_DestroySurface(orig);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests that blits split between worker threads match single threaded ones.
+ */
+static int surface_testBlitThreads(void *arg)
+{
+    static const struct
+    {
+        SDL_PixelFormatEnum src_format;
+        SDL_PixelFormatEnum dst_format;
+        SDL_BlendMode blendMode;
+        Uint8 r, g, b, a;
+        SDL_bool scaled;
+    } cases[] = {
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, SDL_BLENDMODE_BLEND, 255, 255, 255, 255, SDL_FALSE },
+        { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_ADD, 200, 100, 50, 128, SDL_FALSE },
+        { SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_XBGR8888, SDL_BLENDMODE_NONE, 255, 255, 255, 255, SDL_FALSE },
+        { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, SDL_BLENDMODE_MUL, 200, 100, 50, 128, SDL_TRUE },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565, SDL_BLENDMODE_BLEND, 255, 255, 255, 255, SDL_TRUE },
+    };
+    SDL_Rect rect = { 3, 2, 1021, 383 };
+    SDL_Surface *src = NULL, *dst = NULL, *expected = NULL;
+    int i, y;
+
+    for (i = 0; i < (int)SDL_arraysize(cases); i++) {
+        src = SDL_CreateSurface(cases[i].scaled ? 700 : rect.w, cases[i].scaled ? 211 : rect.h, cases[i].src_format);
+        dst = SDL_CreateSurface(1030, 390, cases[i].dst_format);
+        SDLTest_AssertCheck(src && dst, "Verify surfaces were created");
+        if (!src || !dst) {
+            goto done;
+        }
+        for (y = 0; y < src->h * src->pitch; y++) {
+            ((Uint8 *)src->pixels)[y] = (Uint8)SDLTest_RandomUint8();
+        }
+        for (y = 0; y < dst->h * dst->pitch; y++) {
+            ((Uint8 *)dst->pixels)[y] = (Uint8)SDLTest_RandomUint8();
+        }
+        expected = SDL_DuplicateSurface(dst);
+        if (!expected) {
+            goto done;
+        }
+        CHECK_FUNC(SDL_SetSurfaceBlendMode, (src, cases[i].blendMode));
+        CHECK_FUNC(SDL_SetSurfaceColorMod, (src, cases[i].r, cases[i].g, cases[i].b));
+        CHECK_FUNC(SDL_SetSurfaceAlphaMod, (src, cases[i].a));
+
+        SDL_SetHint(SDL_HINT_SURFACE_BLIT_THREADS, "0");
+        if (cases[i].scaled) {
+            CHECK_FUNC(SDL_BlitSurfaceScaled, (src, NULL, expected, &rect, SDL_SCALEMODE_NEAREST));
+        } else {
+            CHECK_FUNC(SDL_BlitSurface, (src, NULL, expected, &rect));
+        }
+        SDL_SetHint(SDL_HINT_SURFACE_BLIT_THREADS, "3");
+        if (cases[i].scaled) {
+            CHECK_FUNC(SDL_BlitSurfaceScaled, (src, NULL, dst, &rect, SDL_SCALEMODE_NEAREST));
+        } else {
+            CHECK_FUNC(SDL_BlitSurface, (src, NULL, dst, &rect));
+        }
+        SDL_ResetHint(SDL_HINT_SURFACE_BLIT_THREADS);
+
+        SDLTest_AssertCheck(SDL_memcmp(expected->pixels, dst->pixels, dst->h * dst->pitch) == 0,
+                            "Verify %s -> %s%s blit matches on several threads", SDL_GetPixelFormatName(cases[i].src_format),
+                            SDL_GetPixelFormatName(cases[i].dst_format), cases[i].scaled ? " scaled" : "");
+
+        SDL_DestroySurface(src);
+        SDL_DestroySurface(dst);
+        SDL_DestroySurface(expected);
+        src = dst = expected = NULL;
+    }
+
+    /* Blitting a surface onto itself has to copy the rows in order, so it isn't split */
+    dst = SDL_CreateSurface(1024, 600, SDL_PIXELFORMAT_XRGB8888);
+    SDLTest_AssertCheck(dst != NULL, "Verify surface was created");
+    if (!dst) {
+        goto done;
+    }
+    for (y = 0; y < dst->h * dst->pitch; y++) {
+        ((Uint8 *)dst->pixels)[y] = (Uint8)SDLTest_RandomUint8();
+    }
+    expected = SDL_DuplicateSurface(dst);
+    if (!expected) {
+        goto done;
+    }
+    {
+        const SDL_Rect srcrect = { 0, 0, 1024, 500 };
+        SDL_Rect dstrect = { 0, 100, 1024, 500 };
+
+        SDL_SetHint(SDL_HINT_SURFACE_BLIT_THREADS, "0");
+        CHECK_FUNC(SDL_BlitSurface, (expected, &srcrect, expected, &dstrect));
+        SDL_SetHint(SDL_HINT_SURFACE_BLIT_THREADS, "3");
+        CHECK_FUNC(SDL_BlitSurface, (dst, &srcrect, dst, &dstrect));
+        SDL_ResetHint(SDL_HINT_SURFACE_BLIT_THREADS);
+    }
+    SDLTest_AssertCheck(SDL_memcmp(expected->pixels, dst->pixels, dst->h * dst->pitch) == 0,
+                        "Verify overlapping blit of a surface onto itself matches on several threads");
+
+done:
+    SDL_ResetHint(SDL_HINT_SURFACE_BLIT_THREADS);
+    SDL_DestroySurface(src);
+    SDL_DestroySurface(dst);
+    SDL_DestroySurface(expected);
+
+    return TEST_COMPLETED;
+}
+
+/* An 8-bit sRGB value converted to linear light, which is what a blit to a linear surface gives */
+static int remapLinearReference(int value)
+{
+    const double v = value / 255.0;
+    const double linear = (v <= 0.04045) ? (v / 12.92) : SDL_pow((v + 0.055) / 1.055, 2.4);
+
+    return (int)(linear * 255.0 + 0.5);
+}
+
+/**
+ * Tests alternating blits of one surface onto several destinations, which remaps it each time.
+ * Destinations that share a format pair but differ in flags or colorspace must not reuse each other's blitter.
+ */
+static int surface_testBlitRemap(void *arg)
+{
+    static const struct
+    {
+        SDL_PixelFormatEnum format;
+        SDL_Colorspace colorspace;
+        SDL_BlendMode blendMode;
+    } targets[] = {
+        { SDL_PIXELFORMAT_XRGB8888, SDL_COLORSPACE_SRGB, SDL_BLENDMODE_BLEND },
+        { SDL_PIXELFORMAT_ABGR8888, SDL_COLORSPACE_SRGB, SDL_BLENDMODE_ADD },
+        { SDL_PIXELFORMAT_XRGB8888, SDL_COLORSPACE_SRGB, SDL_BLENDMODE_MUL },
+        { SDL_PIXELFORMAT_XRGB8888, SDL_COLORSPACE_SRGB, SDL_BLENDMODE_NONE },
+        { SDL_PIXELFORMAT_XRGB8888, SDL_COLORSPACE_SRGB_LINEAR, SDL_BLENDMODE_NONE },
+    };
+    SDL_Surface *src = NULL, *dst = NULL, *orig = NULL;
+    int i, pass, x, y;
+
+    src = SDL_CreateSurface(16, 16, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(src != NULL, "Verify source surface was created");
+    if (!src) {
+        goto done;
+    }
+    for (i = 0; i < src->h * src->pitch; i++) {
+        ((Uint8 *)src->pixels)[i] = SDLTest_RandomUint8();
+    }
+
+    for (pass = 0; pass < 3; pass++) {
+        for (i = 0; i < (int)SDL_arraysize(targets); i++) {
+            const SDL_bool linear = (targets[i].colorspace == SDL_COLORSPACE_SRGB_LINEAR);
+            const SDL_Color mod = { 255, (Uint8)(linear ? 255 : 200 - pass * 60), 255, 255 };
+            Uint32 mask;
+            int mismatches = 0;
+
+            dst = SDL_CreateSurface(16, 16, targets[i].format);
+            SDLTest_AssertCheck(dst != NULL, "Verify destination surface was created");
+            if (!dst) {
+                goto done;
+            }
+            CHECK_FUNC(SDL_SetSurfaceColorspace, (dst, targets[i].colorspace));
+            for (y = 0; y < dst->h * dst->pitch; y++) {
+                ((Uint8 *)dst->pixels)[y] = SDLTest_RandomUint8();
+            }
+            orig = SDL_DuplicateSurface(dst);
+            if (!orig) {
+                goto done;
+            }
+            mask = dst->format->Rmask | dst->format->Gmask | dst->format->Bmask | dst->format->Amask;
+
+            CHECK_FUNC(SDL_SetSurfaceColorMod, (src, mod.r, mod.g, mod.b));
+            CHECK_FUNC(SDL_SetSurfaceBlendMode, (src, targets[i].blendMode));
+            CHECK_FUNC(SDL_BlitSurface, (src, NULL, dst, NULL));
+
+            for (y = 0; y < dst->h; y++) {
+                const Uint32 *srow = (const Uint32 *)((const Uint8 *)src->pixels + y * src->pitch);
+                const Uint32 *orow = (const Uint32 *)((const Uint8 *)orig->pixels + y * orig->pitch);
+                const Uint32 *drow = (const Uint32 *)((const Uint8 *)dst->pixels + y * dst->pitch);
+                for (x = 0; x < dst->w; x++) {
+                    if (linear) {
+                        const Uint32 s = srow[x];
+                        const int r = remapLinearReference((s >> 16) & 0xFF);
+                        const int g = remapLinearReference((s >> 8) & 0xFF);
+                        const int b = remapLinearReference(s & 0xFF);
+                        const Uint32 d = drow[x];
+                        mismatches += (SDL_abs((int)((d >> 16) & 0xFF) - r) > 1 ||
+                                       SDL_abs((int)((d >> 8) & 0xFF) - g) > 1 ||
+                                       SDL_abs((int)(d & 0xFF) - b) > 1);
+                    } else {
+                        const Uint32 expected = autoBlitReference(srow[x], orow[x], src->format, dst->format, &mod, targets[i].blendMode);
+                        mismatches += ((drow[x] & mask) != (expected & mask));
+                    }
+                }
+            }
+            SDLTest_AssertCheck(mismatches == 0, "Verify blit %d onto %s%s with blend mode %d matches, expected 0 mismatches, got %d",
+                                pass, SDL_GetPixelFormatName(targets[i].format), linear ? " (linear)" : "", (int)targets[i].blendMode, mismatches);
+
+            SDL_DestroySurface(dst);
+            SDL_DestroySurface(orig);
+            dst = orig = NULL;
+        }
+    }
+
+done:
+    SDL_DestroySurface(dst);
+    SDL_DestroySurface(orig);
+    SDL_DestroySurface(src);
+
+    return TEST_COMPLETED;
+}
+
+/* Source pixel and 7-bit weight of the next one for a destination row or column of a linear SDL_SoftStretch() */
+static void stretchLinearCoordinate(int src_nb, int dst_nb, int i, int *index, int *frac, SDL_bool vertical)
+{
+    const int step = (int)(((Uint32)src_nb << 16) / (Uint32)dst_nb);
+    const Sint64 x0 = (((Sint64)step * 0x8000 + 0x8000) >> 16) - 0x8000;
+    const Sint64 fp = x0 + (Sint64)step * i;
+
+    if (fp < 0) {
+        *index = 0;
+        *frac = 0;
+    } else if ((int)(fp >> 16) > src_nb - 2) {
+        *index = vertical ? src_nb - 1 : src_nb - 2;
+        *frac = vertical ? 0 : 128;
+    } else {
+        *index = (int)(fp >> 16);
+        *frac = (int)((fp >> 9) & 127);
+    }
+}
+
+/* The SIMD versions keep the vertical pass at full precision, the C version rounds it down */
+static Uint32 stretchLinearReference(SDL_Surface *src, int dst_w, int dst_h, int x, int y, SDL_bool simd)
+{
+    int index_h, frac_h, index_w, frac_w, c;
+    const Uint32 *row0, *row1;
+    Uint32 pixel = 0;
+
+    stretchLinearCoordinate(src->h, dst_h, y, &index_h, &frac_h, SDL_TRUE);
+    stretchLinearCoordinate(src->w, dst_w, x, &index_w, &frac_w, SDL_FALSE);
+    row0 = (const Uint32 *)((const Uint8 *)src->pixels + index_h * src->pitch) + index_w;
+    row1 = frac_h ? (const Uint32 *)((const Uint8 *)row0 + src->pitch) : row0;
+    for (c = 0; c < 32; c += 8) {
+        const int j0 = (int)((row0[0] >> c) & 0xFF) * (128 - frac_h) + (int)((row1[0] >> c) & 0xFF) * frac_h;
+        const int j1 = (int)((row0[1] >> c) & 0xFF) * (128 - frac_h) + (int)((row1[1] >> c) & 0xFF) * frac_h;
+        const int value = simd ? (j0 * (128 - frac_w) + j1 * frac_w) >> 14 : ((j0 >> 7) * (128 - frac_w) + (j1 >> 7) * frac_w) >> 7;
+        pixel |= (Uint32)value << c;
+    }
+    return pixel;
+}
+
+/**
+ * Tests SDL_SoftStretch() against a reference, on one thread and split between worker threads.
+ */
+static int surface_testSoftStretch(void *arg)
+{
+    static const struct
+    {
+        int w, h;
+    } sizes[] = {
+        { 97, 61 }, { 301, 199 }, { 713, 457 }, { 1024, 31 }, { 1500, 300 }
+    };
+    static const char *threads[] = { "0", "3" };
+    const SDL_bool simd = SDL_HasSSE2() || SDL_HasNEON();
+    SDL_Surface *src = NULL, *dst = NULL, *expected = NULL;
+    int i, j, mode, x, y;
+
+    src = SDL_CreateSurface(301, 199, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(src != NULL, "Verify source surface was created");
+    if (!src) {
+        goto done;
+    }
+    for (y = 0; y < src->h * src->pitch; y++) {
+        ((Uint8 *)src->pixels)[y] = (Uint8)SDLTest_RandomUint8();
+    }
+
+    for (i = 0; i < (int)SDL_arraysize(sizes); i++) {
+        dst = SDL_CreateSurface(sizes[i].w, sizes[i].h, SDL_PIXELFORMAT_ARGB8888);
+        SDLTest_AssertCheck(dst != NULL, "Verify destination surface was created");
+        if (!dst) {
+            goto done;
+        }
+        for (mode = 0; mode < 2; mode++) {
+            const SDL_ScaleMode scaleMode = mode ? SDL_SCALEMODE_LINEAR : SDL_SCALEMODE_NEAREST;
+            for (j = 0; j < (int)SDL_arraysize(threads); j++) {
+                int mismatches = 0;
+
+                SDL_SetHint(SDL_HINT_SURFACE_BLIT_THREADS, threads[j]);
+                SDL_FillSurfaceRect(dst, NULL, 0);
+                CHECK_FUNC(SDL_SoftStretch, (src, NULL, dst, NULL, scaleMode));
+                for (y = 0; y < dst->h; y++) {
+                    const Uint32 *row = (const Uint32 *)((const Uint8 *)dst->pixels + y * dst->pitch);
+                    for (x = 0; x < dst->w; x++) {
+                        Uint32 pixel;
+                        if (scaleMode == SDL_SCALEMODE_NEAREST) {
+                            const Uint64 incx = ((Uint64)src->w << 16) / dst->w;
+                            const Uint64 incy = ((Uint64)src->h << 16) / dst->h;
+                            const int src_x = (int)((incx / 2 + incx * x) >> 16);
+                            const int src_y = (int)((incy / 2 + incy * y) >> 16);
+                            pixel = ((const Uint32 *)((const Uint8 *)src->pixels + src_y * src->pitch))[src_x];
+                        } else {
+                            pixel = stretchLinearReference(src, dst->w, dst->h, x, y, simd);
+                        }
+                        if (row[x] != pixel) {
+                            mismatches++;
+                        }
+                    }
+                }
+                SDLTest_AssertCheck(mismatches == 0, "Verify %s stretch 301x199 -> %dx%d with %s worker threads, expected 0 mismatches, got %d",
+                                    mode ? "linear" : "nearest", dst->w, dst->h, threads[j], mismatches);
+            }
+        }
+        SDL_DestroySurface(dst);
+        dst = NULL;
+    }
+
+    /* Stretching part of a surface over itself depends on the row order, so it isn't split */
+    for (mode = 0; mode < 2; mode++) {
+        const SDL_ScaleMode scaleMode = mode ? SDL_SCALEMODE_LINEAR : SDL_SCALEMODE_NEAREST;
+        const SDL_Rect srcrect = { 0, 0, 400, 300 };
+        const SDL_Rect dstrect = { 0, 100, 800, 500 };
+
+        dst = SDL_CreateSurface(800, 600, SDL_PIXELFORMAT_ARGB8888);
+        SDLTest_AssertCheck(dst != NULL, "Verify surface was created");
+        if (!dst) {
+            goto done;
+        }
+        for (y = 0; y < dst->h * dst->pitch; y++) {
+            ((Uint8 *)dst->pixels)[y] = (Uint8)SDLTest_RandomUint8();
+        }
+        expected = SDL_DuplicateSurface(dst);
+        if (!expected) {
+            goto done;
+        }
+        SDL_SetHint(SDL_HINT_SURFACE_BLIT_THREADS, "0");
+        CHECK_FUNC(SDL_SoftStretch, (expected, &srcrect, expected, &dstrect, scaleMode));
+        SDL_SetHint(SDL_HINT_SURFACE_BLIT_THREADS, "3");
+        CHECK_FUNC(SDL_SoftStretch, (dst, &srcrect, dst, &dstrect, scaleMode));
+        SDL_ResetHint(SDL_HINT_SURFACE_BLIT_THREADS);
+        SDLTest_AssertCheck(SDL_memcmp(expected->pixels, dst->pixels, dst->h * dst->pitch) == 0,
+                            "Verify overlapping %s stretch of a surface onto itself matches on several threads", mode ? "linear" : "nearest");
+
+        SDL_DestroySurface(dst);
+        SDL_DestroySurface(expected);
+        dst = expected = NULL;
+    }
+
+done:
+    SDL_ResetHint(SDL_HINT_SURFACE_BLIT_THREADS);
+    SDL_DestroySurface(src);
+    SDL_DestroySurface(dst);
+    SDL_DestroySurface(expected);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Surface test cases */
@@ -917,11 +1556,33 @@ static const SDLTest_TestCaseReference surfaceTestFlip = {
     surface_testFlip, "surface_testFlip", "Test surface flipping.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference surfaceTestBlitAlpha8888 = {
+    surface_testBlitAlpha8888, "surface_testBlitAlpha8888", "Tests alpha blending between 8888 formats.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestBlitAuto = {
+    surface_testBlitAuto, "surface_testBlitAuto", "Tests the generated modulate, blend and scale blitters.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestBlitThreads = {
+    surface_testBlitThreads, "surface_testBlitThreads", "Tests blits split between worker threads.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestBlitRemap = {
+    surface_testBlitRemap, "surface_testBlitRemap", "Tests blitting one surface onto several destinations in turn.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestSoftStretch = {
+    surface_testSoftStretch, "surface_testSoftStretch", "Tests nearest and linear stretching, on one and several threads.", TEST_ENABLED
+};
+
 /* Sequence of Surface test cases */
 static const SDLTest_TestCaseReference *surfaceTests[] = {
     &surfaceTest1, &surfaceTest2, &surfaceTest3, &surfaceTest4, &surfaceTest5,
     &surfaceTest6, &surfaceTest7, &surfaceTest8, &surfaceTest9, &surfaceTest10,
-    &surfaceTest11, &surfaceTest12, &surfaceTestOverflow, &surfaceTestFlip, NULL
+    &surfaceTest11, &surfaceTest12, &surfaceTestOverflow, &surfaceTestFlip,
+    &surfaceTestBlitAlpha8888, &surfaceTestBlitAuto,
+    &surfaceTestBlitThreads, &surfaceTestBlitRemap, &surfaceTestSoftStretch, NULL
 };
 
 /* Surface test suite (global) */